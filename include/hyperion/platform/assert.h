@@ -0,0 +1,342 @@
+/// @file assert.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Assertion macros with out-of-line, cold failure paths
+/// @version 0.4.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2024 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef HYPERION_PLATFORM_ASSERT_H
+#define HYPERION_PLATFORM_ASSERT_H
+
+#include <hyperion/platform.h>
+#include <hyperion/platform/def.h>
+#include <hyperion/platform/types.h>
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <string_view>
+
+#if HYPERION_STD_LIB_HAS_SOURCE_LOCATION
+    #include <source_location>
+#endif // HYPERION_STD_LIB_HAS_SOURCE_LOCATION
+
+/// @ingroup platform
+/// @{
+///	@defgroup assert Assertions
+/// Hyperion's assertion macros keep the code they add to the functions using them as small as
+/// possible: a failed assertion only calls an out-of-line, `HYPERION_COLD` function, passing it
+/// pointers to the assertion's text and source location, which are stored as static data. All
+/// reporting happens in that cold function, so hot functions using assertions are not bloated
+/// with formatting or I/O code.
+///
+/// - `HYPERION_ASSERT(condition, message)` is checked in every build mode.
+/// - `HYPERION_DEBUG_ASSERT(condition, message)` is checked when
+/// `HYPERION_PLATFORM_MODE_IS_DEBUG`, and compiled out otherwise.
+/// - `HYPERION_ASSUME_OR_ASSERT(condition, message)` is checked when
+/// `HYPERION_PLATFORM_MODE_IS_DEBUG`, and becomes a `HYPERION_ASSUME` optimizer hint otherwise.
+///
+/// Defining `HYPERION_ASSERT_ASSUME_IN_RELEASE` to `true` also turns `HYPERION_DEBUG_ASSERT`s
+/// into `HYPERION_ASSUME` hints in release builds. The message is optional and, if given, must
+/// be a string literal.
+///
+/// When an assertion fails, the installed `hyperion::assertion_handler` is invoked (by default,
+/// one that prints the failure to `stderr`), then the program is aborted.
+///
+/// # Example
+/// @code {.cpp}
+/// auto element(std::span<const i32> values, usize index) -> i32 {
+///     HYPERION_DEBUG_ASSERT(index < values.size(), "index out of bounds");
+///     return values[index];
+/// }
+/// @endcode
+/// @headerfile hyperion/platform/assert.h
+/// @}
+
+/// @def HYPERION_ASSERT_ASSUME_IN_RELEASE
+/// @brief Whether `HYPERION_DEBUG_ASSERT` becomes a `HYPERION_ASSUME` hint in release builds,
+/// instead of being compiled out. Defaults to false. Define this prior to including any Hyperion
+/// headers to change it.
+/// @ingroup assert
+/// @headerfile hyperion/platform/assert.h
+#ifndef HYPERION_ASSERT_ASSUME_IN_RELEASE
+    #define HYPERION_ASSERT_ASSUME_IN_RELEASE false // NOLINT(cppcoreguidelines-macro-usage)
+#endif // HYPERION_ASSERT_ASSUME_IN_RELEASE
+
+namespace hyperion {
+
+    /// @brief Describes a failed assertion
+    /// @ingroup assert
+    /// @headerfile hyperion/platform/assert.h
+    struct assertion_info {
+        /// @brief The text of the asserted condition
+        std::string_view condition;
+        /// @brief The assertion's message, or an empty string if it has none
+        std::string_view message;
+        /// @brief The source file of the assertion
+        std::string_view file;
+        /// @brief The function containing the assertion
+        std::string_view function;
+        /// @brief The source line of the assertion
+        u32 line;
+    };
+
+    /// @brief The type of the function invoked when an assertion fails, before the program is
+    /// aborted
+    /// @ingroup assert
+    /// @headerfile hyperion/platform/assert.h
+    using assertion_handler = void (*)(const assertion_info&) noexcept;
+
+    namespace detail::assert {
+        /// @brief The text of an assertion, known at compile time
+        struct expression {
+            std::string_view condition;
+            std::string_view message;
+        };
+
+        /// @brief A source location, for when `std::source_location` is unavailable
+        struct source_position {
+            const char* file;
+            const char* function;
+            u32 line;
+        };
+
+        inline auto print_failure(const assertion_info& info) noexcept -> void {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg, cert-err33-c)
+            std::fprintf(stderr,
+                         "Assertion failed: `%.*s`%s%.*s\n    at %.*s:%u in %.*s\n",
+                         static_cast<int>(info.condition.size()),
+                         info.condition.data(),
+                         info.message.empty() ? "" : ": ",
+                         static_cast<int>(info.message.size()),
+                         info.message.data(),
+                         static_cast<int>(info.file.size()),
+                         info.file.data(),
+                         info.line,
+                         static_cast<int>(info.function.size()),
+                         info.function.data());
+        }
+
+        // NOLINTNEXTLINE(*-avoid-non-const-global-variables)
+        inline constinit std::atomic<assertion_handler> g_handler = &print_failure;
+
+        /// @brief Reports a failed assertion and aborts
+        [[noreturn]] HYPERION_COLD inline auto failed(const assertion_info& info) noexcept -> void {
+            g_handler.load(std::memory_order_acquire)(info);
+            std::abort();
+        }
+
+#if HYPERION_STD_LIB_HAS_SOURCE_LOCATION
+        using location_type = std::source_location;
+
+        [[nodiscard]] constexpr auto
+        to_position(const std::source_location& location) noexcept -> source_position {
+            return {location.file_name(), location.function_name(), location.line()};
+        }
+#else
+        using location_type = source_position;
+
+        [[nodiscard]] constexpr auto
+        to_position(const source_position& location) noexcept -> source_position {
+            return location;
+        }
+#endif // HYPERION_STD_LIB_HAS_SOURCE_LOCATION
+
+        /// @brief The failure path of the assertion macros. `TExpression` is a closure type
+        /// unique to each assertion, returning its `expression`, so the assertion's text is
+        /// static data and the call site only passes its location.
+        template<typename TExpression>
+        [[noreturn]] HYPERION_COLD auto
+        fail(TExpression /*unused*/, location_type location) noexcept -> void {
+            static constexpr auto text = TExpression{}();
+            const auto position = to_position(location);
+            failed(assertion_info{text.condition,
+                                  text.message,
+                                  position.file,
+                                  position.function,
+                                  position.line});
+        }
+    } // namespace detail::assert
+
+    /// @brief Installs the function invoked when an assertion fails, before the program is
+    /// aborted
+    /// @param handler The new handler
+    /// @return The previously installed handler
+    /// @ingroup assert
+    /// @headerfile hyperion/platform/assert.h
+    inline auto set_assertion_handler(assertion_handler handler) noexcept -> assertion_handler {
+        return detail::assert::g_handler.exchange(handler, std::memory_order_acq_rel);
+    }
+
+} // namespace hyperion
+
+#if HYPERION_STD_LIB_HAS_SOURCE_LOCATION
+    #define HYPERION_ASSERT_LOCATION() /** NOLINT(cppcoreguidelines-macro-usage) **/ \
+        std::source_location::current()
+#else
+    #define HYPERION_ASSERT_LOCATION() /** NOLINT(cppcoreguidelines-macro-usage) **/ \
+        ::hyperion::detail::assert::source_position {                               \
+            __FILE__, static_cast<const char*>(__func__),                            \
+                static_cast<::hyperion::u32>(__LINE__)                               \
+        }
+#endif // HYPERION_STD_LIB_HAS_SOURCE_LOCATION
+
+/// @def HYPERION_ASSERT
+/// @brief Checks that `condition` is true in every build mode. If it is not, reports the
+/// failure and aborts.
+/// The optional second argument is a message, which must be a string literal.
+/// @ingroup assert
+/// @headerfile hyperion/platform/assert.h
+#define HYPERION_ASSERT(condition, ...) /** NOLINT(cppcoreguidelines-macro-usage) **/ \
+    do {                                                                              \
+        if(!static_cast<bool>(condition)) [[unlikely]] {                              \
+            ::hyperion::detail::assert::fail(                                         \
+                []() noexcept {                                                       \
+                    return ::hyperion::detail::assert::expression{#condition,         \
+                                                                  "" __VA_ARGS__};    \
+                },                                                                    \
+                HYPERION_ASSERT_LOCATION());                                          \
+        }                                                                             \
+    } while(false)
+
+/// @def HYPERION_DEBUG_ASSERT
+/// @brief Checks that `condition` is true when `HYPERION_PLATFORM_MODE_IS_DEBUG`, like
+/// `HYPERION_ASSERT`. Otherwise, `condition` is not evaluated, and is instead used as a
+/// `HYPERION_ASSUME` hint if `HYPERION_ASSERT_ASSUME_IN_RELEASE` is true.
+/// @ingroup assert
+/// @headerfile hyperion/platform/assert.h
+
+/// @def HYPERION_ASSUME_OR_ASSERT
+/// @brief Checks that `condition` is true when `HYPERION_PLATFORM_MODE_IS_DEBUG`, like
+/// `HYPERION_ASSERT`. Otherwise, `condition` is used as a `HYPERION_ASSUME` hint, so it must
+/// not have side effects.
+/// @ingroup assert
+/// @headerfile hyperion/platform/assert.h
+
+#if HYPERION_PLATFORM_MODE_IS_DEBUG
+    #define HYPERION_DEBUG_ASSERT(...) /** NOLINT(cppcoreguidelines-macro-usage) **/ \
+        HYPERION_ASSERT(__VA_ARGS__)
+    #define HYPERION_ASSUME_OR_ASSERT(...) /** NOLINT(cppcoreguidelines-macro-usage) **/ \
+        HYPERION_ASSERT(__VA_ARGS__)
+#else
+    #if HYPERION_ASSERT_ASSUME_IN_RELEASE
+        #define HYPERION_DEBUG_ASSERT(condition, ...) /** NOLINT **/ HYPERION_ASSUME(condition)
+    #else
+        #define HYPERION_DEBUG_ASSERT(condition, ...) /** NOLINT **/ \
+            static_cast<void>(sizeof(static_cast<bool>(condition)))
+    #endif // HYPERION_ASSERT_ASSUME_IN_RELEASE
+    #define HYPERION_ASSUME_OR_ASSERT(condition, ...) /** NOLINT **/ HYPERION_ASSUME(condition)
+#endif // HYPERION_PLATFORM_MODE_IS_DEBUG
+
+#if defined(HYPERION_ENABLE_TESTING) && HYPERION_ENABLE_TESTING
+
+    #include <boost/ut.hpp>
+    #include <hyperion/platform/ignore.h>
+
+    #if HYPERION_PLATFORM_IS_LINUX
+        #include <sys/wait.h>
+        #include <unistd.h>
+    #endif // HYPERION_PLATFORM_IS_LINUX
+
+namespace hyperion::_test::platform::assert {
+
+    // NOLINTNEXTLINE(google-build-using-namespace)
+    using namespace boost::ut;
+
+    [[nodiscard]] constexpr auto checked_divide(i32 lhs, i32 rhs) noexcept -> i32 {
+        HYPERION_ASSERT(rhs != 0, "division by zero");
+        HYPERION_DEBUG_ASSERT(lhs >= 0);
+        HYPERION_ASSUME_OR_ASSERT(rhs > 0);
+        return lhs / rhs;
+    }
+
+    // assertions may be used in constant expressions, and fail to compile when they fail
+    static_assert(checked_divide(10, 2) == 5);
+
+    #if HYPERION_PLATFORM_IS_LINUX
+    static constexpr auto k_handled_exit_code = 42;
+
+    /// @brief Runs `func` in a child process, returning its exit code, or -1 if it did not exit
+    template<typename TFunc>
+    [[nodiscard]] auto exit_code_of(TFunc&& func) -> int {
+        const auto child = fork();
+        if(child == 0) {
+            func();
+            std::_Exit(0);
+        }
+
+        auto status = 0;
+        hyperion::ignore(waitpid(child, &status, 0));
+        return WIFEXITED(status) ? WEXITSTATUS(status) : -1; // NOLINT(*-signed-bitwise)
+    }
+    #endif // HYPERION_PLATFORM_IS_LINUX
+
+    // NOLINTNEXTLINE(cert-err58-cpp)
+    static const suite<"hyperion::platform::assert"> assert_tests = [] {
+        "passing_assertions"_test = [] {
+            auto evaluations = 0;
+            HYPERION_ASSERT(++evaluations == 1);
+            HYPERION_DEBUG_ASSERT((++evaluations, true), "message");
+            expect(that % checked_divide(9, 3) == 3);
+
+            // debug assertions are not evaluated in release builds, unless they are assumed
+            if constexpr(HYPERION_PLATFORM_MODE_IS_DEBUG || !HYPERION_ASSERT_ASSUME_IN_RELEASE) {
+                expect(that % evaluations == (HYPERION_PLATFORM_MODE_IS_DEBUG ? 2 : 1));
+            }
+        };
+
+    #if HYPERION_PLATFORM_IS_LINUX
+        "failure_invokes_handler"_test = [] {
+            const auto code = exit_code_of([]() {
+                hyperion::ignore(set_assertion_handler([](const assertion_info& info) noexcept {
+                    const auto matches = info.condition == "value == 2"
+                                         && info.message == "value must be two"
+                                         && info.file.ends_with("assert.h") && info.line != 0U;
+                    std::_Exit(matches ? k_handled_exit_code : 1);
+                }));
+
+                auto value = 1;
+                HYPERION_ASSERT(value == 2, "value must be two");
+            });
+
+            expect(that % code == k_handled_exit_code);
+        };
+
+        "failure_aborts"_test = [] {
+            const auto code = exit_code_of([]() {
+                hyperion::ignore(set_assertion_handler([](const assertion_info&) noexcept {}));
+                auto value = 1;
+                HYPERION_ASSERT(value == 2);
+            });
+
+            // a handler that returns does not prevent the abort
+            expect(that % code == -1);
+        };
+    #endif // HYPERION_PLATFORM_IS_LINUX
+    };
+
+} // namespace hyperion::_test::platform::assert
+
+#endif // defined(HYPERION_ENABLE_TESTING) && HYPERION_ENABLE_TESTING
+
+#endif // HYPERION_PLATFORM_ASSERT_H
@@ -0,0 +1,532 @@
+/// @file atomic128.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Double-width (128-bit) atomic compare-and-swap
+/// @version 0.4.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2024 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef HYPERION_PLATFORM_ATOMIC128_H
+#define HYPERION_PLATFORM_ATOMIC128_H
+
+#include <hyperion/platform.h>
+#include <hyperion/platform/def.h>
+#include <hyperion/platform/futex.h>
+#include <hyperion/platform/ignore.h>
+#include <hyperion/platform/types.h>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <type_traits>
+
+#if HYPERION_PLATFORM_COMPILER_IS_MSVC
+    #include <intrin.h>
+#endif // HYPERION_PLATFORM_COMPILER_IS_MSVC
+
+/// @ingroup platform
+/// @{
+///	@defgroup atomic128 Double-Width Atomics
+/// `hyperion::atomic_u128` and `hyperion::atomic_pair<TFirst, TSecond>` provide atomic
+/// operations on 16-byte values, built on a double-width compare-and-swap.
+///
+/// Toolchains commonly implement `std::atomic` of a 16-byte type with a lock (or a call into
+/// `libatomic`) even on hardware that supports double-width CAS. These types instead select the
+/// instruction directly based on the target architecture:
+///
+/// - On x86_64, `lock cmpxchg16b`
+/// - On ARMv8, `casp` when LSE atomics are available, otherwise an exclusive load/store pair
+/// - Elsewhere, a striped lock table
+///
+/// `HYPERION_PLATFORM_ATOMIC128_IS_LOCK_FREE` reports which of these is in use.
+///
+/// # Example
+/// @code {.cpp}
+/// struct node {
+///     node* next;
+/// };
+///
+/// hyperion::atomic_pair<node*, u64> g_head{nullptr, 0_u64};
+///
+/// auto push(node* new_head) -> void {
+///     auto head = g_head.load();
+///     do {
+///         new_head->next = head.first;
+///     } while(!g_head.compare_exchange_weak(head, {new_head, head.second + 1_u64}));
+/// }
+/// @endcode
+/// @headerfile hyperion/platform/atomic128.h
+/// @}
+
+/// @def HYPERION_PLATFORM_ATOMIC128_IS_LOCK_FREE
+/// @brief Whether `hyperion::atomic_u128` and `hyperion::atomic_pair` are implemented with a
+/// native double-width compare-and-swap on the target architecture
+/// @ingroup atomic128
+/// @headerfile hyperion/platform/atomic128.h
+#if HYPERION_PLATFORM_IS_ARCHITECTURE(HYPERION_PLATFORM_X86_64) \
+    || HYPERION_PLATFORM_IS_ARCHITECTURE(HYPERION_PLATFORM_ARM_V8)
+    #define HYPERION_PLATFORM_ATOMIC128_IS_LOCK_FREE true
+#else
+    #define HYPERION_PLATFORM_ATOMIC128_IS_LOCK_FREE false
+#endif // HYPERION_PLATFORM_IS_ARCHITECTURE(HYPERION_PLATFORM_X86_64)
+       // || HYPERION_PLATFORM_IS_ARCHITECTURE(HYPERION_PLATFORM_ARM_V8)
+
+namespace hyperion {
+
+    /// @brief A 128-bit value, as two 64-bit halves
+    /// @ingroup atomic128
+    /// @headerfile hyperion/platform/atomic128.h
+    struct alignas(16) u128_value {
+        /// @brief The low 64 bits
+        u64 low = 0_u64;
+        /// @brief The high 64 bits
+        u64 high = 0_u64;
+
+        friend constexpr auto
+        operator==(const u128_value& lhs, const u128_value& rhs) noexcept -> bool = default;
+    };
+
+    namespace detail::atomic128 {
+        HYPERION_IGNORE_PADDING_WARNING_START;
+
+        struct alignas(HYPERION_PLATFORM_CACHE_LINE_SIZE) striped_lock {
+            platform::futex_mutex mutex;
+        };
+
+        HYPERION_IGNORE_PADDING_WARNING_STOP;
+
+        static inline constexpr auto k_lock_stripes = 64_usize;
+
+        [[nodiscard]] inline auto
+        lock_for(const void* address) noexcept -> platform::futex_mutex& {
+            static std::array<striped_lock, k_lock_stripes> locks;
+            // NOLINTNEXTLINE(*-reinterpret-cast)
+            const auto index = (reinterpret_cast<std::uintptr_t>(address) >> 4_usize)
+                               % k_lock_stripes;
+            // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+            return locks[index].mutex;
+        }
+
+        /// @brief Lock-based compare-and-swap, used where no native instruction is available
+        [[nodiscard]] inline auto locked_compare_exchange(u128_value* target,
+                                                          u128_value& expected,
+                                                          const u128_value& desired) noexcept
+            -> bool {
+            const auto guard = std::scoped_lock{lock_for(target)};
+            if(*target == expected) {
+                *target = desired;
+                return true;
+            }
+
+            expected = *target;
+            return false;
+        }
+
+        [[nodiscard]] constexpr auto
+        failure_order(std::memory_order order) noexcept -> std::memory_order {
+            switch(order) {
+                case std::memory_order_acq_rel: return std::memory_order_acquire;
+                case std::memory_order_release: return std::memory_order_relaxed;
+                default: return order;
+            }
+        }
+
+        /// @brief Atomically compares `*target` with `expected` and, if they are equal, replaces
+        /// it with `desired`. Otherwise, loads `*target` into `expected`.
+        [[nodiscard]] inline auto
+        compare_exchange(u128_value* target,
+                         u128_value& expected,
+                         const u128_value& desired,
+                         [[maybe_unused]] std::memory_order order) noexcept -> bool {
+#if HYPERION_PLATFORM_IS_ARCHITECTURE(HYPERION_PLATFORM_X86_64) \
+    && !HYPERION_PLATFORM_COMPILER_IS_MSVC
+            // `lock cmpxchg16b` is a full barrier, so it satisfies every memory order
+            bool success = false;
+            asm volatile("lock cmpxchg16b %[target]"
+                         : "=@ccz"(success),
+                           [target] "+m"(*target),
+                           "+a"(expected.low),
+                           "+d"(expected.high)
+                         : "b"(desired.low), "c"(desired.high)
+                         : "memory");
+            return success;
+#elif HYPERION_PLATFORM_COMPILER_IS_MSVC                                \
+    && (HYPERION_PLATFORM_IS_ARCHITECTURE(HYPERION_PLATFORM_X86_64) \
+        || HYPERION_PLATFORM_IS_ARCHITECTURE(HYPERION_PLATFORM_ARM_V8))
+            auto comparand = std::array<long long, 2>{static_cast<long long>(expected.low),
+                                                      static_cast<long long>(expected.high)};
+            const auto success = _InterlockedCompareExchange128(
+                                     // NOLINTNEXTLINE(*-reinterpret-cast)
+                                     reinterpret_cast<volatile long long*>(target),
+                                     static_cast<long long>(desired.high),
+                                     static_cast<long long>(desired.low),
+                                     comparand.data())
+                                 != 0;
+            expected = u128_value{static_cast<u64>(comparand[0]), static_cast<u64>(comparand[1])};
+            return success;
+#elif HYPERION_PLATFORM_IS_ARCHITECTURE(HYPERION_PLATFORM_ARM_V8)
+            // GCC and Clang lower this to `casp` when LSE atomics are enabled (or to a runtime
+            // LSE check with outline atomics), and to an `ldaxp`/`stlxp` loop otherwise
+            __extension__ using native_u128 = unsigned __int128 __attribute__((may_alias));
+            auto native_expected = (static_cast<native_u128>(expected.high) << 64U)
+                                   | static_cast<native_u128>(expected.low);
+            const auto native_desired = (static_cast<native_u128>(desired.high) << 64U)
+                                        | static_cast<native_u128>(desired.low);
+            const auto success
+                = __atomic_compare_exchange_n(reinterpret_cast<native_u128*>(target), // NOLINT
+                                              &native_expected,
+                                              native_desired,
+                                              false,
+                                              static_cast<int>(order),
+                                              static_cast<int>(failure_order(order)));
+            expected = u128_value{static_cast<u64>(native_expected),
+                                  static_cast<u64>(native_expected >> 64U)};
+            return success;
+#else
+            return locked_compare_exchange(target, expected, desired);
+#endif
+        }
+    } // namespace detail::atomic128
+
+    /// @brief An atomic 128-bit value.
+    ///
+    /// Every operation is implemented in terms of a double-width compare-and-swap, including
+    /// `load` (which is a compare-and-swap that leaves the value unchanged), so `atomic_u128`
+    /// must not be placed in read-only memory.
+    ///
+    /// @ingroup atomic128
+    /// @headerfile hyperion/platform/atomic128.h
+    class atomic_u128 {
+      public:
+        /// @brief Whether operations on `atomic_u128` are lock-free
+        static constexpr bool is_always_lock_free = HYPERION_PLATFORM_ATOMIC128_IS_LOCK_FREE;
+
+        /// @brief Constructs an `atomic_u128` holding `value`
+        /// @param value The initial value
+        constexpr explicit atomic_u128(u128_value value = {}) noexcept
+            : m_value{value} {
+        }
+
+        atomic_u128(const atomic_u128&) = delete;
+        atomic_u128(atomic_u128&&) = delete;
+        ~atomic_u128() noexcept = default;
+        auto operator=(const atomic_u128&) -> atomic_u128& = delete;
+        auto operator=(atomic_u128&&) -> atomic_u128& = delete;
+
+        /// @brief Atomically loads the current value
+        /// @param order The memory ordering of the operation
+        /// @return The current value
+        [[nodiscard]] auto
+        load(std::memory_order order = std::memory_order_seq_cst) const noexcept -> u128_value {
+            auto expected = u128_value{};
+            // if the value is zero, this "replaces" it with zero; otherwise it fails and loads it
+            ignore(detail::atomic128::compare_exchange(&m_value, expected, expected, order));
+            return expected;
+        }
+
+        /// @brief Atomically replaces the current value with `value`
+        /// @param value The new value
+        /// @param order The memory ordering of the operation
+        auto store(u128_value value, std::memory_order order = std::memory_order_seq_cst) noexcept
+            -> void {
+            ignore(exchange(value, order));
+        }
+
+        /// @brief Atomically replaces the current value with `value`
+        /// @param value The new value
+        /// @param order The memory ordering of the operation
+        /// @return The previous value
+        [[nodiscard]] auto
+        exchange(u128_value value, std::memory_order order = std::memory_order_seq_cst) noexcept
+            -> u128_value {
+            auto expected = u128_value{};
+            while(!detail::atomic128::compare_exchange(&m_value, expected, value, order)) {
+            }
+            return expected;
+        }
+
+        /// @brief Atomically replaces the current value with `desired` if it is equal to
+        /// `expected`. Otherwise, loads the current value into `expected`.
+        /// @param expected The expected current value
+        /// @param desired The new value
+        /// @param order The memory ordering of the operation
+        /// @return Whether the value was replaced
+        [[nodiscard]] auto
+        compare_exchange_strong(u128_value& expected,
+                                u128_value desired,
+                                std::memory_order order = std::memory_order_seq_cst) noexcept
+            -> bool {
+            return detail::atomic128::compare_exchange(&m_value, expected, desired, order);
+        }
+
+        /// @brief Equivalent to `compare_exchange_strong`. Provided for parity with `std::atomic`.
+        /// @param expected The expected current value
+        /// @param desired The new value
+        /// @param order The memory ordering of the operation
+        /// @return Whether the value was replaced
+        [[nodiscard]] auto
+        compare_exchange_weak(u128_value& expected,
+                              u128_value desired,
+                              std::memory_order order = std::memory_order_seq_cst) noexcept
+            -> bool {
+            return compare_exchange_strong(expected, desired, order);
+        }
+
+      private:
+        mutable u128_value m_value;
+    };
+
+    /// @brief An atomic pair of two 8-byte (or smaller) trivially copyable values, such as a
+    /// pointer and a version counter, that are loaded and compared-and-swapped together.
+    ///
+    /// Comparisons are bitwise, as with `std::atomic`.
+    ///
+    /// @tparam TFirst The type of the first element
+    /// @tparam TSecond The type of the second element
+    /// @ingroup atomic128
+    /// @headerfile hyperion/platform/atomic128.h
+    template<typename TFirst, typename TSecond>
+        requires std::is_trivially_copyable_v<TFirst> && std::is_trivially_copyable_v<TSecond>
+                 && (sizeof(TFirst) <= sizeof(u64)) && (sizeof(TSecond) <= sizeof(u64))
+    class atomic_pair {
+      public:
+        /// @brief The value held by an `atomic_pair`
+        struct value_type {
+            TFirst first;
+            TSecond second;
+        };
+
+        /// @brief Whether operations on `atomic_pair` are lock-free
+        static constexpr bool is_always_lock_free = atomic_u128::is_always_lock_free;
+
+        /// @brief Constructs an `atomic_pair` holding `first` and `second`
+        /// @param first The initial first element
+        /// @param second The initial second element
+        atomic_pair(TFirst first, TSecond second) noexcept
+            : m_value{pack(value_type{first, second})} {
+        }
+
+        atomic_pair(const atomic_pair&) = delete;
+        atomic_pair(atomic_pair&&) = delete;
+        ~atomic_pair() noexcept = default;
+        auto operator=(const atomic_pair&) -> atomic_pair& = delete;
+        auto operator=(atomic_pair&&) -> atomic_pair& = delete;
+
+        /// @brief Atomically loads the current value
+        /// @param order The memory ordering of the operation
+        /// @return The current value
+        [[nodiscard]] auto
+        load(std::memory_order order = std::memory_order_seq_cst) const noexcept -> value_type {
+            return unpack(m_value.load(order));
+        }
+
+        /// @brief Atomically replaces the current value with `value`
+        /// @param value The new value
+        /// @param order The memory ordering of the operation
+        auto store(value_type value, std::memory_order order = std::memory_order_seq_cst) noexcept
+            -> void {
+            m_value.store(pack(value), order);
+        }
+
+        /// @brief Atomically replaces the current value with `value`
+        /// @param value The new value
+        /// @param order The memory ordering of the operation
+        /// @return The previous value
+        [[nodiscard]] auto
+        exchange(value_type value, std::memory_order order = std::memory_order_seq_cst) noexcept
+            -> value_type {
+            return unpack(m_value.exchange(pack(value), order));
+        }
+
+        /// @brief Atomically replaces the current value with `desired` if it is bitwise equal to
+        /// `expected`. Otherwise, loads the current value into `expected`.
+        /// @param expected The expected current value
+        /// @param desired The new value
+        /// @param order The memory ordering of the operation
+        /// @return Whether the value was replaced
+        [[nodiscard]] auto
+        compare_exchange_strong(value_type& expected,
+                                value_type desired,
+                                std::memory_order order = std::memory_order_seq_cst) noexcept
+            -> bool {
+            auto packed = pack(expected);
+            if(m_value.compare_exchange_strong(packed, pack(desired), order)) {
+                return true;
+            }
+
+            expected = unpack(packed);
+            return false;
+        }
+
+        /// @brief Equivalent to `compare_exchange_strong`. Provided for parity with `std::atomic`.
+        /// @param expected The expected current value
+        /// @param desired The new value
+        /// @param order The memory ordering of the operation
+        /// @return Whether the value was replaced
+        [[nodiscard]] auto
+        compare_exchange_weak(value_type& expected,
+                              value_type desired,
+                              std::memory_order order = std::memory_order_seq_cst) noexcept
+            -> bool {
+            return compare_exchange_strong(expected, desired, order);
+        }
+
+      private:
+        atomic_u128 m_value;
+
+        [[nodiscard]] static auto pack(const value_type& value) noexcept -> u128_value {
+            auto packed = u128_value{};
+            std::memcpy(&packed.low, &value.first, sizeof(TFirst));
+            std::memcpy(&packed.high, &value.second, sizeof(TSecond));
+            return packed;
+        }
+
+        [[nodiscard]] static auto unpack(const u128_value& packed) noexcept -> value_type {
+            static_assert(std::is_trivially_default_constructible_v<value_type>
+                              || std::is_nothrow_default_constructible_v<value_type>,
+                          "atomic_pair elements must be default constructible");
+            auto value = value_type{};
+            std::memcpy(&value.first, &packed.low, sizeof(TFirst));
+            std::memcpy(&value.second, &packed.high, sizeof(TSecond));
+            return value;
+        }
+    };
+
+} // namespace hyperion
+
+#if defined(HYPERION_ENABLE_TESTING) && HYPERION_ENABLE_TESTING
+
+    #include <boost/ut.hpp>
+
+    #include <thread>
+    #include <vector>
+
+namespace hyperion::_test::platform::atomic128 {
+
+    // NOLINTNEXTLINE(google-build-using-namespace)
+    using namespace boost::ut;
+
+    static_assert(sizeof(hyperion::atomic_u128) == 16_usize);
+    static_assert(alignof(hyperion::atomic_u128) == 16_usize);
+
+    // NOLINTNEXTLINE(cert-err58-cpp)
+    static const suite<"hyperion::platform::atomic128"> atomic128_tests = [] {
+        "atomic_u128"_test = [] {
+            hyperion::atomic_u128 value{u128_value{1_u64, 2_u64}};
+            expect(that % value.load() == u128_value{1_u64, 2_u64});
+
+            auto expected = u128_value{1_u64, 3_u64};
+            expect(that % !value.compare_exchange_strong(expected, u128_value{4_u64, 5_u64}));
+            expect(that % expected == u128_value{1_u64, 2_u64});
+            expect(that % value.compare_exchange_strong(expected, u128_value{4_u64, 5_u64}));
+            expect(that % value.load() == u128_value{4_u64, 5_u64});
+
+            expect(that % value.exchange(u128_value{6_u64, 7_u64}) == u128_value{4_u64, 5_u64});
+            value.store(u128_value{});
+            expect(that % value.load() == u128_value{});
+        };
+
+        "locked_fallback"_test = [] {
+            auto target = u128_value{1_u64, 2_u64};
+            auto expected = u128_value{};
+            expect(that
+                   % !detail::atomic128::locked_compare_exchange(&target, expected, expected));
+            expect(that % expected == u128_value{1_u64, 2_u64});
+            expect(that
+                   % detail::atomic128::locked_compare_exchange(&target,
+                                                                expected,
+                                                                u128_value{3_u64, 4_u64}));
+            expect(that % target == u128_value{3_u64, 4_u64});
+        };
+
+        "concurrent_double_width_updates"_test = [] {
+            constexpr auto threads = 4_usize;
+            constexpr auto increments = 10000_u64;
+
+            // both halves are incremented together, so they must never be observed to differ
+            hyperion::atomic_u128 value;
+            std::atomic<bool> torn = false;
+            std::vector<std::thread> workers;
+            workers.reserve(threads);
+            for(auto index = 0_usize; index < threads; ++index) {
+                workers.emplace_back([&]() {
+                    for(auto increment = 0_u64; increment < increments; ++increment) {
+                        auto current = value.load(std::memory_order_relaxed);
+                        if(current.low != current.high) {
+                            torn.store(true, std::memory_order_relaxed);
+                        }
+                        while(!value.compare_exchange_weak(
+                            current,
+                            u128_value{current.low + 1_u64, current.high + 1_u64}))
+                        {
+                        }
+                    }
+                });
+            }
+
+            for(auto& worker : workers) {
+                worker.join();
+            }
+
+            const auto result = value.load();
+            expect(that % !torn.load());
+            expect(that % result.low == threads * increments);
+            expect(that % result.high == threads * increments);
+        };
+
+        "atomic_pair"_test = [] {
+            auto storage = 0;
+            hyperion::atomic_pair<int*, u64> pair{nullptr, 0_u64};
+            expect(that % pair.load().first == nullptr);
+
+            auto expected = pair.load();
+            expect(that % pair.compare_exchange_strong(expected, {&storage, 1_u64}));
+            expect(that % pair.load().first == &storage);
+            expect(that % pair.load().second == 1_u64);
+
+            // a stale version fails even though the pointer matches
+            expected = {&storage, 0_u64};
+            expect(that % !pair.compare_exchange_strong(expected, {nullptr, 2_u64}));
+            expect(that % expected.second == 1_u64);
+
+            const auto previous = pair.exchange({nullptr, 3_u64});
+            expect(that % previous.first == &storage);
+            expect(that % pair.load().second == 3_u64);
+
+            hyperion::atomic_pair<u32, i16> small{7_u32, static_cast<i16>(-1)};
+            auto small_expected = small.load();
+            expect(that % small_expected.first == 7_u32);
+            expect(that % small_expected.second == static_cast<i16>(-1));
+            expect(that
+                   % small.compare_exchange_strong(small_expected,
+                                                   {8_u32, static_cast<i16>(0)}));
+            expect(that % small.load().first == 8_u32);
+        };
+    };
+
+} // namespace hyperion::_test::platform::atomic128
+
+#endif // defined(HYPERION_ENABLE_TESTING) && HYPERION_ENABLE_TESTING
+
+#endif // HYPERION_PLATFORM_ATOMIC128_H
@@ -0,0 +1,967 @@
+/// @file btree.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief A cache-conscious in-memory B+tree for integer and floating point keys
+/// @version 0.4.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2024 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef HYPERION_PLATFORM_BTREE_H
+#define HYPERION_PLATFORM_BTREE_H
+
+#include <hyperion/platform.h>
+#include <hyperion/platform/assert.h>
+#include <hyperion/platform/compare.h>
+#include <hyperion/platform/cpu.h>
+#include <hyperion/platform/def.h>
+#include <hyperion/platform/flat_map.h>
+#include <hyperion/platform/types.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__AVX2__)
+    #include <immintrin.h>
+#endif // defined(__AVX2__)
+
+/// @ingroup platform
+/// @{
+///	@defgroup btree B+tree
+/// `hyperion::btree_map<K, V>` is an ordered map from integer or floating point keys to values,
+/// implemented as an in-memory B+tree. Its nodes are aligned to, and sized in multiples of,
+/// `HYPERION_PLATFORM_CACHE_LINE_SIZE`, and each holds four cache lines of keys (e.g. 32
+/// `u64` keys, or 64 `f32` keys). A lookup touches one node per level, and with such wide
+/// nodes a tree of a million entries is only four levels deep, where a red-black tree like
+/// `std::map` would be around twenty.
+///
+/// Within a node, the position of a key is found by comparing it against every key in the node
+/// and counting the smaller ones. On AVX2 targets this uses 4- or 8-lane vector comparisons for
+/// 32- and 64-bit keys; otherwise it is a loop with no data-dependent branches that compilers
+/// readily vectorize.
+///
+/// Entries are stored in the leaves, which are linked in key order, so range scans walk the
+/// leaves sequentially, prefetching the next leaf as they go. Trees can be bulk loaded from
+/// sorted input in O(n), which builds fully packed leaves bottom-up.
+///
+/// Like `hyperion::flat_map`, comparisons are controlled by a key policy (see
+/// `hyperion/platform/flat_map.h`), so `hyperion::tolerant_key` can be used to treat floating
+/// point keys within an epsilon of each other as the same key.
+///
+/// Erasing entries does not rebalance the tree: nodes are never merged, and emptied leaves are
+/// kept. Lookups remain correct, but a tree that has shrunk substantially should be rebuilt
+/// with `assign_sorted` to reclaim memory and restore its density.
+///
+/// # Example
+/// @code {.cpp}
+/// auto orders = hyperion::btree_map<u64, order>{};
+/// orders.insert_or_assign(order_id, order{...});
+///
+/// // visit every order with an id in [1000, 2000]
+/// orders.for_each_in_range(1000, 2000, [](u64 id, order& entry) {
+///     process(id, entry);
+/// });
+///
+/// auto prices = hyperion::btree_map<f64, u32>{};
+/// prices.assign_sorted(std::span{sorted_prices}, std::span{quantities});
+/// @endcode
+/// @headerfile hyperion/platform/btree.h
+/// @}
+
+namespace hyperion {
+
+    namespace detail::btree {
+
+        /// @brief The number of bytes of keys in each node
+        static constexpr auto k_node_key_bytes
+            = 4_usize * static_cast<usize>(HYPERION_PLATFORM_CACHE_LINE_SIZE);
+
+        /// @brief The maximum number of keys in each node
+        template<typename TKey>
+        static constexpr auto k_fanout = std::max(k_node_key_bytes / sizeof(TKey), 4_usize);
+
+        /// @brief Whether `TPolicy` orders keys with the builtin `<`, allowing SIMD comparisons
+        template<typename TPolicy, typename TKey>
+        static constexpr auto k_builtin_order = false;
+
+        template<typename TKey>
+        static constexpr auto k_builtin_order<exact_key<TKey>, TKey> = true;
+
+        template<std::floating_point TKey, platform::compare::EpsilonType TType>
+        static constexpr auto k_builtin_order<tolerant_key<TKey, TType>, TKey> = true;
+
+#if defined(__AVX2__)
+        /// @brief Returns a bitmask with one bit per lane of the 32 bytes of keys at `keys`,
+        /// set if the key is less than (or, if `TInclusive`, not greater than) `key`
+        template<bool TInclusive, typename TKey>
+        [[nodiscard]] inline auto compare_lanes(const TKey* keys, TKey key) noexcept -> u32 {
+            // NOLINTBEGIN(*-pro-type-reinterpret-cast)
+            if constexpr(std::same_as<TKey, f64>) {
+                const auto lanes = _mm256_cmp_pd(_mm256_loadu_pd(keys),
+                                                 _mm256_set1_pd(key),
+                                                 TInclusive ? _CMP_LE_OQ : _CMP_LT_OQ);
+                return static_cast<u32>(_mm256_movemask_pd(lanes));
+            }
+            else if constexpr(std::same_as<TKey, f32>) {
+                const auto lanes = _mm256_cmp_ps(_mm256_loadu_ps(keys),
+                                                 _mm256_set1_ps(key),
+                                                 TInclusive ? _CMP_LE_OQ : _CMP_LT_OQ);
+                return static_cast<u32>(_mm256_movemask_ps(lanes));
+            }
+            else if constexpr(sizeof(TKey) == sizeof(u64)) {
+                // unsigned keys are compared as signed after flipping their sign bits
+                const auto bias = _mm256_set1_epi64x(std::is_signed_v<TKey> ? 0 : INT64_MIN);
+                const auto values = _mm256_xor_si256(
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys)),
+                    bias);
+                const auto target
+                    = _mm256_xor_si256(_mm256_set1_epi64x(static_cast<i64>(key)), bias);
+                const auto lanes = TInclusive ? _mm256_cmpgt_epi64(values, target)
+                                              : _mm256_cmpgt_epi64(target, values);
+                const auto mask
+                    = static_cast<u32>(_mm256_movemask_pd(_mm256_castsi256_pd(lanes)));
+                return TInclusive ? ~mask & 0xF_u32 : mask;
+            }
+            else {
+                const auto bias = _mm256_set1_epi32(std::is_signed_v<TKey> ? 0 : INT32_MIN);
+                const auto values = _mm256_xor_si256(
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys)),
+                    bias);
+                const auto target
+                    = _mm256_xor_si256(_mm256_set1_epi32(static_cast<i32>(key)), bias);
+                const auto lanes = TInclusive ? _mm256_cmpgt_epi32(values, target)
+                                              : _mm256_cmpgt_epi32(target, values);
+                const auto mask
+                    = static_cast<u32>(_mm256_movemask_ps(_mm256_castsi256_ps(lanes)));
+                return TInclusive ? ~mask & 0xFF_u32 : mask;
+            }
+            // NOLINTEND(*-pro-type-reinterpret-cast)
+        }
+#endif // defined(__AVX2__)
+
+        /// @brief Returns the number of the first `count` keys at `keys` that are less than
+        /// (or, if `TInclusive`, not greater than) `key`. Because the keys are sorted, this is
+        /// the lower (or upper) bound of `key`.
+        ///
+        /// The whole node's key array may be read, so `keys` must point to the start of one.
+        template<bool TInclusive, typename TKey, typename TPolicy>
+        [[nodiscard]] inline auto count_below(const TKey* keys,
+                                              usize count,
+                                              const TKey& key,
+                                              const TPolicy& policy) noexcept -> usize {
+#if defined(__AVX2__)
+            if constexpr(k_builtin_order<TPolicy, TKey>
+                         && (sizeof(TKey) == sizeof(u32) || sizeof(TKey) == sizeof(u64)))
+            {
+                constexpr auto lanes = sizeof(__m256i) / sizeof(TKey);
+                static_assert(k_fanout<TKey> % lanes == 0_usize);
+
+                auto result = 0_usize;
+                for(auto index = 0_usize; index < count; index += lanes) {
+                    // NOLINTNEXTLINE(*-pro-bounds-pointer-arithmetic)
+                    auto mask = compare_lanes<TInclusive>(keys + index, key);
+                    if(count - index < lanes) {
+                        mask &= (1_u32 << (count - index)) - 1_u32;
+                    }
+                    result += static_cast<usize>(std::popcount(mask));
+                }
+                return result;
+            }
+#endif // defined(__AVX2__)
+
+            auto result = 0_usize;
+            for(auto index = 0_usize; index < count; ++index) {
+                // NOLINTBEGIN(*-pro-bounds-pointer-arithmetic)
+                result += static_cast<usize>(TInclusive ? !policy.less(key, keys[index])
+                                                        : policy.less(keys[index], key));
+                // NOLINTEND(*-pro-bounds-pointer-arithmetic)
+            }
+            return result;
+        }
+
+        HYPERION_IGNORE_PADDING_WARNING_START;
+
+        template<typename TKey>
+        struct alignas(HYPERION_PLATFORM_CACHE_LINE_SIZE) node {
+            std::array<TKey, k_fanout<TKey>> keys{};
+            usize count = 0_usize;
+        };
+
+        /// @brief An inner node. `children[i]` holds the keys in `[keys[i - 1], keys[i])`
+        template<typename TKey>
+        struct inner_node : node<TKey> {
+            std::array<node<TKey>*, k_fanout<TKey> + 1_usize> children{};
+        };
+
+        template<typename TKey, typename TValue>
+        struct leaf_node : node<TKey> {
+            std::array<TValue, k_fanout<TKey>> values{};
+            leaf_node* previous = nullptr;
+            leaf_node* next = nullptr;
+        };
+
+        HYPERION_IGNORE_PADDING_WARNING_STOP;
+
+    } // namespace detail::btree
+
+    HYPERION_IGNORE_PADDING_WARNING_START;
+
+    /// @brief An ordered map from integer or floating point keys to values, implemented as an
+    /// in-memory B+tree with cache-line-sized nodes
+    ///
+    /// @tparam TKey The key type
+    /// @tparam TValue The value type
+    /// @tparam TPolicy The key policy, `exact_key<TKey>` by default
+    /// @ingroup btree
+    /// @headerfile hyperion/platform/btree.h
+    template<typename TKey, typename TValue, typename TPolicy = exact_key<TKey>>
+        requires(std::integral<TKey> || std::floating_point<TKey>)
+                && std::default_initializable<TValue> && std::movable<TValue>
+                && KeyPolicy<TPolicy, TKey>
+    class btree_map {
+        using node = detail::btree::node<TKey>;
+        using inner_node = detail::btree::inner_node<TKey>;
+        using leaf_node = detail::btree::leaf_node<TKey, TValue>;
+
+        static_assert(sizeof(inner_node) % HYPERION_PLATFORM_CACHE_LINE_SIZE == 0);
+        static_assert(sizeof(leaf_node) % HYPERION_PLATFORM_CACHE_LINE_SIZE == 0);
+
+      public:
+        /// @brief The key type
+        using key_type = TKey;
+        /// @brief The value type
+        using mapped_type = TValue;
+
+        /// @brief The maximum number of keys in each node
+        static constexpr auto node_capacity = detail::btree::k_fanout<TKey>;
+
+        /// @brief Constructs an empty map
+        /// @param policy The key policy
+        constexpr explicit btree_map(TPolicy policy = TPolicy{}) noexcept(
+            std::is_nothrow_move_constructible_v<TPolicy>)
+            : m_policy{std::move(policy)} {
+        }
+
+        /// @brief Constructs a map from the parallel arrays `keys` and `values` in
+        /// O(n log n). If a key occurs more than once, the first occurrence is kept
+        /// @param keys The keys of the map
+        /// @param values The values of the map
+        /// @param policy The key policy
+        /// @pre `keys.size() == values.size()`
+        btree_map(std::vector<TKey> keys, std::vector<TValue> values, TPolicy policy = TPolicy{})
+            : m_policy{std::move(policy)} {
+            HYPERION_ASSERT(keys.size() == values.size(),
+                            "btree_map requires the same number of keys and values");
+            const auto order
+                = detail::flat_map::sorted_unique_order(std::span<const TKey>{keys}, m_policy);
+            auto sorted_keys = std::vector<TKey>{};
+            auto sorted_values = std::vector<TValue>{};
+            sorted_keys.reserve(order.size());
+            sorted_values.reserve(order.size());
+            for(const auto index : order) {
+                sorted_keys.push_back(keys[index]);
+                sorted_values.push_back(std::move(values[index]));
+            }
+            assign_sorted(std::span<const TKey>{sorted_keys},
+                          std::span<const TValue>{sorted_values});
+        }
+
+        btree_map(const btree_map&) = delete;
+
+        btree_map(btree_map&& other) noexcept(std::is_nothrow_move_constructible_v<TPolicy>)
+            : m_policy{std::move(other.m_policy)},
+              m_root{std::exchange(other.m_root, nullptr)},
+              m_first{std::exchange(other.m_first, nullptr)},
+              m_height{std::exchange(other.m_height, 0_usize)},
+              m_size{std::exchange(other.m_size, 0_usize)} {
+        }
+
+        ~btree_map() noexcept {
+            clear();
+        }
+
+        auto operator=(const btree_map&) -> btree_map& = delete;
+
+        auto operator=(btree_map&& other) noexcept(std::is_nothrow_move_assignable_v<TPolicy>)
+            -> btree_map& {
+            if(this != &other) {
+                clear();
+                m_policy = std::move(other.m_policy);
+                m_root = std::exchange(other.m_root, nullptr);
+                m_first = std::exchange(other.m_first, nullptr);
+                m_height = std::exchange(other.m_height, 0_usize);
+                m_size = std::exchange(other.m_size, 0_usize);
+            }
+            return *this;
+        }
+
+        /// @brief Replaces the contents of the map with `keys` and `values` in O(n), building
+        /// the tree bottom-up with fully packed leaves.
+        ///
+        /// # Requirements
+        /// - `keys.size() == values.size()`
+        /// - `keys` must be strictly increasing, and no two keys may be equal under the policy
+        ///
+        /// @param keys The sorted keys of the map
+        /// @param values The values of the map, in the order of their keys
+        auto assign_sorted(std::span<const TKey> keys, std::span<const TValue> values) -> void {
+            HYPERION_ASSERT(keys.size() == values.size(),
+                            "btree_map requires the same number of keys and values");
+            HYPERION_DEBUG_ASSERT(std::adjacent_find(keys.begin(),
+                                                     keys.end(),
+                                                     [this](const TKey& lhs, const TKey& rhs) {
+                                                         return !m_policy.less(lhs, rhs)
+                                                                || m_policy.equal(lhs, rhs);
+                                                     })
+                                      == keys.end(),
+                                  "assign_sorted requires sorted, unique keys");
+
+            clear();
+            if(keys.empty()) {
+                return;
+            }
+
+            // spread entries evenly over the fewest leaves that can hold them
+            const auto leaf_count = (keys.size() + node_capacity - 1_usize) / node_capacity;
+            auto level = std::vector<node*>{};
+            auto minimums = std::vector<TKey>{};
+            level.reserve(leaf_count);
+            minimums.reserve(leaf_count);
+            leaf_node* previous = nullptr;
+            for(auto index = 0_usize; index < leaf_count; ++index) {
+                const auto begin = index * keys.size() / leaf_count;
+                const auto end = (index + 1_usize) * keys.size() / leaf_count;
+                auto* leaf = new leaf_node{};
+                std::copy(keys.begin() + static_cast<std::ptrdiff_t>(begin),
+                          keys.begin() + static_cast<std::ptrdiff_t>(end),
+                          leaf->keys.begin());
+                std::copy(values.begin() + static_cast<std::ptrdiff_t>(begin),
+                          values.begin() + static_cast<std::ptrdiff_t>(end),
+                          leaf->values.begin());
+                leaf->count = end - begin;
+                leaf->previous = previous;
+                if(previous != nullptr) {
+                    previous->next = leaf;
+                }
+                else {
+                    m_first = leaf;
+                }
+                previous = leaf;
+                level.push_back(leaf);
+                minimums.push_back(keys[begin]);
+            }
+            m_root = level.front();
+            m_height = 1_usize;
+            m_size = keys.size();
+
+            constexpr auto children_per_node = node_capacity + 1_usize;
+            while(level.size() > 1_usize) {
+                const auto parent_count
+                    = (level.size() + children_per_node - 1_usize) / children_per_node;
+                auto parents = std::vector<node*>{};
+                auto parent_minimums = std::vector<TKey>{};
+                parents.reserve(parent_count);
+                parent_minimums.reserve(parent_count);
+                for(auto index = 0_usize; index < parent_count; ++index) {
+                    const auto begin = index * level.size() / parent_count;
+                    const auto end = (index + 1_usize) * level.size() / parent_count;
+                    auto* parent = new inner_node{};
+                    for(auto child = begin; child < end; ++child) {
+                        parent->children[child - begin] = level[child];
+                        if(child != begin) {
+                            parent->keys[child - begin - 1_usize] = minimums[child];
+                        }
+                    }
+                    parent->count = end - begin - 1_usize;
+                    parents.push_back(parent);
+                    parent_minimums.push_back(minimums[begin]);
+                }
+                level = std::move(parents);
+                minimums = std::move(parent_minimums);
+                m_root = level.front();
+                ++m_height;
+            }
+        }
+
+        /// @brief Returns a pointer to the value for `key`, or `nullptr` if there is none
+        /// @param key The key to look up
+        /// @return The value for `key`, or `nullptr`
+        [[nodiscard]] auto find(const TKey& key) noexcept -> TValue* {
+            const auto [leaf, position] = find_entry(key);
+            return leaf == nullptr ? nullptr : &leaf->values[position];
+        }
+
+        /// @brief Returns a pointer to the value for `key`, or `nullptr` if there is none
+        /// @param key The key to look up
+        /// @return The value for `key`, or `nullptr`
+        [[nodiscard]] auto find(const TKey& key) const noexcept -> const TValue* {
+            const auto [leaf, position] = find_entry(key);
+            return leaf == nullptr ? nullptr : &leaf->values[position];
+        }
+
+        /// @brief Returns whether the map contains `key`
+        /// @param key The key to look up
+        /// @return Whether the map contains `key`
+        [[nodiscard]] auto contains(const TKey& key) const noexcept -> bool {
+            return find(key) != nullptr;
+        }
+
+        /// @brief Returns the value for `key`
+        /// @param key The key to look up
+        /// @return The value for `key`
+        /// @pre `contains(key)`
+        [[nodiscard]] auto at(const TKey& key) noexcept -> TValue& {
+            auto* value = find(key);
+            HYPERION_DEBUG_ASSERT(value != nullptr, "btree_map::at called with a missing key");
+            return *value;
+        }
+
+        /// @brief Returns the value for `key`
+        /// @param key The key to look up
+        /// @return The value for `key`
+        /// @pre `contains(key)`
+        [[nodiscard]] auto at(const TKey& key) const noexcept -> const TValue& {
+            const auto* value = find(key);
+            HYPERION_DEBUG_ASSERT(value != nullptr, "btree_map::at called with a missing key");
+            return *value;
+        }
+
+        /// @brief Inserts `value` for `key`, or assigns it to the existing value for `key`.
+        /// O(log n)
+        /// @param key The key
+        /// @param value The value
+        /// @return Whether `key` was newly inserted
+        template<typename TArg>
+            requires std::assignable_from<TValue&, TArg&&>
+                     && std::constructible_from<TValue, TArg&&>
+        auto insert_or_assign(const TKey& key, TArg&& value) -> bool {
+            if(const auto [leaf, position] = find_entry(key); leaf != nullptr) {
+                leaf->values[position] = std::forward<TArg>(value);
+                return false;
+            }
+
+            if(m_root == nullptr) {
+                auto* leaf = new leaf_node{};
+                m_root = leaf;
+                m_first = leaf;
+                m_height = 1_usize;
+            }
+
+            auto element = TValue(std::forward<TArg>(value));
+            const auto split = insert_into(m_root, m_height, key, std::move(element));
+            if(split.right != nullptr) {
+                auto* root = new inner_node{};
+                root->keys[0] = split.key;
+                root->children[0] = m_root;
+                root->children[1] = split.right;
+                root->count = 1_usize;
+                m_root = root;
+                ++m_height;
+            }
+            ++m_size;
+            return true;
+        }
+
+        /// @brief Erases the entry for `key`, if there is one. O(log n).
+        ///
+        /// Nodes are not merged when they become underfull, so erasing does not shrink the
+        /// tree unless it becomes empty.
+        /// @param key The key to erase
+        /// @return Whether an entry was erased
+        auto erase(const TKey& key) -> bool {
+            const auto [leaf, position] = find_entry(key);
+            if(leaf == nullptr) {
+                return false;
+            }
+
+            const auto first = static_cast<std::ptrdiff_t>(position);
+            const auto last = static_cast<std::ptrdiff_t>(leaf->count);
+            std::move(leaf->keys.begin() + first + 1, leaf->keys.begin() + last,
+                      leaf->keys.begin() + first);
+            std::move(leaf->values.begin() + first + 1, leaf->values.begin() + last,
+                      leaf->values.begin() + first);
+            --leaf->count;
+            leaf->values[leaf->count] = TValue{};
+
+            if(--m_size == 0_usize) {
+                clear();
+            }
+            return true;
+        }
+
+        /// @brief Invokes `callback` with each key and its value, in key order
+        /// @param callback The callback to invoke
+        template<typename TCallback>
+            requires std::invocable<TCallback&, const TKey&, TValue&>
+        auto for_each(TCallback&& callback) -> void {
+            scan(m_first, 0_usize, nullptr, callback);
+        }
+
+        /// @brief Invokes `callback` with each key and its value, in key order
+        /// @param callback The callback to invoke
+        template<typename TCallback>
+            requires std::invocable<TCallback&, const TKey&, const TValue&>
+        auto for_each(TCallback&& callback) const -> void {
+            scan(m_first, 0_usize, nullptr, callback);
+        }
+
+        /// @brief Invokes `callback` with each key in `[first, last]` and its value, in key
+        /// order. Keys are bounded by the policy's ordering, without tolerance
+        /// @param first The smallest key to visit
+        /// @param last The largest key to visit
+        /// @param callback The callback to invoke
+        template<typename TCallback>
+            requires std::invocable<TCallback&, const TKey&, TValue&>
+        auto for_each_in_range(const TKey& first, const TKey& last, TCallback&& callback)
+            -> void {
+            if(m_root == nullptr || m_policy.less(last, first)) {
+                return;
+            }
+            auto* leaf = descend(first);
+            scan(leaf, lower_bound(leaf, first), &last, callback);
+        }
+
+        /// @brief Invokes `callback` with each key in `[first, last]` and its value, in key
+        /// order. Keys are bounded by the policy's ordering, without tolerance
+        /// @param first The smallest key to visit
+        /// @param last The largest key to visit
+        /// @param callback The callback to invoke
+        template<typename TCallback>
+            requires std::invocable<TCallback&, const TKey&, const TValue&>
+        auto for_each_in_range(const TKey& first, const TKey& last, TCallback&& callback) const
+            -> void {
+            if(m_root == nullptr || m_policy.less(last, first)) {
+                return;
+            }
+            const auto* leaf = descend(first);
+            scan(leaf, lower_bound(leaf, first), &last, callback);
+        }
+
+        /// @brief Returns the number of entries
+        /// @return The number of entries
+        [[nodiscard]] auto size() const noexcept -> usize {
+            return m_size;
+        }
+
+        /// @brief Returns whether the map is empty
+        /// @return Whether the map is empty
+        [[nodiscard]] auto empty() const noexcept -> bool {
+            return m_size == 0_usize;
+        }
+
+        /// @brief Returns the number of levels in the tree, including the leaves
+        /// @return The height of the tree
+        [[nodiscard]] auto height() const noexcept -> usize {
+            return m_height;
+        }
+
+        /// @brief Erases every entry, freeing every node
+        auto clear() noexcept -> void {
+            if(m_root != nullptr) {
+                destroy(m_root, m_height);
+            }
+            m_root = nullptr;
+            m_first = nullptr;
+            m_height = 0_usize;
+            m_size = 0_usize;
+        }
+
+      private:
+        [[HYPERION_NO_UNIQUE_ADDRESS]] TPolicy m_policy;
+        node* m_root = nullptr;
+        leaf_node* m_first = nullptr;
+        usize m_height = 0_usize;
+        usize m_size = 0_usize;
+
+        struct split_result {
+            TKey key{};
+            node* right = nullptr;
+        };
+
+        static auto destroy(node* current, usize level) noexcept -> void {
+            if(level == 1_usize) {
+                delete static_cast<leaf_node*>(current); // NOLINT(*-owning-memory)
+                return;
+            }
+
+            auto* inner = static_cast<inner_node*>(current);
+            for(auto index = 0_usize; index <= inner->count; ++index) {
+                destroy(inner->children[index], level - 1_usize);
+            }
+            delete inner; // NOLINT(*-owning-memory)
+        }
+
+        [[nodiscard]] auto lower_bound(const node* current, const TKey& key) const noexcept
+            -> usize {
+            return detail::btree::count_below<false>(current->keys.data(),
+                                                     current->count,
+                                                     key,
+                                                     m_policy);
+        }
+
+        [[nodiscard]] auto upper_bound(const node* current, const TKey& key) const noexcept
+            -> usize {
+            return detail::btree::count_below<true>(current->keys.data(),
+                                                    current->count,
+                                                    key,
+                                                    m_policy);
+        }
+
+        /// @brief Returns the leaf that `key` belongs in. The tree must not be empty
+        [[nodiscard]] auto descend(const TKey& key) const noexcept -> leaf_node* {
+            auto* current = m_root;
+            for(auto level = m_height; level > 1_usize; --level) {
+                auto* inner = static_cast<inner_node*>(current);
+                current = inner->children[upper_bound(inner, key)];
+            }
+            return static_cast<leaf_node*>(current);
+        }
+
+        struct entry {
+            leaf_node* leaf;
+            usize position;
+        };
+
+        [[nodiscard]] auto find_entry(const TKey& key) const noexcept -> entry {
+            if(m_root == nullptr) {
+                return {nullptr, 0_usize};
+            }
+
+            auto* leaf = descend(key);
+            const auto position = lower_bound(leaf, key);
+            if(position < leaf->count && m_policy.equal(leaf->keys[position], key)) {
+                return {leaf, position};
+            }
+
+            if constexpr(!std::same_as<TPolicy, exact_key<TKey>>) {
+                // a tolerant policy may consider the neighboring keys equal, which can be in
+                // the adjacent leaves
+                if(position != 0_usize) {
+                    if(m_policy.equal(leaf->keys[position - 1_usize], key)) {
+                        return {leaf, position - 1_usize};
+                    }
+                }
+                else if(auto* previous = non_empty(leaf->previous, &leaf_node::previous);
+                        previous != nullptr
+                        && m_policy.equal(previous->keys[previous->count - 1_usize], key))
+                {
+                    return {previous, previous->count - 1_usize};
+                }
+
+                if(position == leaf->count) {
+                    if(auto* next = non_empty(leaf->next, &leaf_node::next);
+                       next != nullptr && m_policy.equal(next->keys[0], key))
+                    {
+                        return {next, 0_usize};
+                    }
+                }
+            }
+
+            return {nullptr, 0_usize};
+        }
+
+        [[nodiscard]] static auto
+        non_empty(leaf_node* leaf, leaf_node* leaf_node::*link) noexcept -> leaf_node* {
+            while(leaf != nullptr && leaf->count == 0_usize) {
+                leaf = leaf->*link;
+            }
+            return leaf;
+        }
+
+        template<typename TLeaf, typename TCallback>
+        auto scan(TLeaf* leaf, usize position, const TKey* last, TCallback& callback) const
+            -> void {
+            for(; leaf != nullptr; leaf = leaf->next, position = 0_usize) {
+                if(leaf->next != nullptr) {
+                    platform::prefetch_read(leaf->next);
+                }
+                for(; position < leaf->count; ++position) {
+                    if(last != nullptr && m_policy.less(*last, leaf->keys[position])) {
+                        return;
+                    }
+                    callback(std::as_const(leaf->keys[position]), leaf->values[position]);
+                }
+            }
+        }
+
+        auto insert_into(node* current, usize level, const TKey& key, TValue&& value)
+            -> split_result {
+            if(level == 1_usize) {
+                return insert_into_leaf(static_cast<leaf_node*>(current), key, std::move(value));
+            }
+
+            auto* inner = static_cast<inner_node*>(current);
+            const auto child = upper_bound(inner, key);
+            const auto split
+                = insert_into(inner->children[child], level - 1_usize, key, std::move(value));
+            if(split.right == nullptr) {
+                return {};
+            }
+            return insert_into_inner(inner, child, split);
+        }
+
+        auto insert_into_leaf(leaf_node* leaf, const TKey& key, TValue&& value)
+            -> split_result {
+            if(leaf->count < node_capacity) {
+                insert_sorted(leaf, key, std::move(value));
+                return {};
+            }
+
+            auto* right = new leaf_node{};
+            constexpr auto half = node_capacity / 2_usize;
+            std::move(leaf->keys.begin() + half, leaf->keys.end(), right->keys.begin());
+            std::move(leaf->values.begin() + half, leaf->values.end(), right->values.begin());
+            std::fill(leaf->values.begin() + half, leaf->values.end(), TValue{});
+            leaf->count = half;
+            right->count = node_capacity - half;
+
+            right->previous = leaf;
+            right->next = leaf->next;
+            if(leaf->next != nullptr) {
+                leaf->next->previous = right;
+            }
+            leaf->next = right;
+
+            insert_sorted(m_policy.less(key, right->keys[0]) ? leaf : right,
+                          key,
+                          std::move(value));
+            return {right->keys[0], right};
+        }
+
+        auto insert_sorted(leaf_node* leaf, const TKey& key, TValue&& value) -> void {
+            const auto position = static_cast<std::ptrdiff_t>(lower_bound(leaf, key));
+            const auto last = static_cast<std::ptrdiff_t>(leaf->count);
+            std::move_backward(leaf->keys.begin() + position,
+                               leaf->keys.begin() + last,
+                               leaf->keys.begin() + last + 1);
+            std::move_backward(leaf->values.begin() + position,
+                               leaf->values.begin() + last,
+                               leaf->values.begin() + last + 1);
+            leaf->keys[static_cast<usize>(position)] = key;
+            leaf->values[static_cast<usize>(position)] = std::move(value);
+            ++leaf->count;
+        }
+
+        /// @brief Inserts the separator and right node of a split child at `child`
+        static auto
+        insert_into_inner(inner_node* inner, usize child, const split_result& split)
+            -> split_result {
+            if(inner->count < node_capacity) {
+                const auto position = static_cast<std::ptrdiff_t>(child);
+                const auto last = static_cast<std::ptrdiff_t>(inner->count);
+                std::move_backward(inner->keys.begin() + position,
+                                   inner->keys.begin() + last,
+                                   inner->keys.begin() + last + 1);
+                std::move_backward(inner->children.begin() + position + 1,
+                                   inner->children.begin() + last + 1,
+                                   inner->children.begin() + last + 2);
+                inner->keys[child] = split.key;
+                inner->children[child + 1_usize] = split.right;
+                ++inner->count;
+                return {};
+            }
+
+            // gather the node's entries with the new one, then divide them, pushing the middle
+            // key up to the parent
+            auto keys = std::array<TKey, node_capacity + 1_usize>{};
+            auto children = std::array<node*, node_capacity + 2_usize>{};
+            for(auto index = 0_usize, source = 0_usize; index <= node_capacity; ++index) {
+                keys[index] = index == child ? split.key : inner->keys[source++];
+            }
+            for(auto index = 0_usize, source = 0_usize; index <= node_capacity + 1_usize;
+                ++index)
+            {
+                children[index]
+                    = index == child + 1_usize ? split.right : inner->children[source++];
+            }
+
+            constexpr auto middle = (node_capacity + 1_usize) / 2_usize;
+            auto* right = new inner_node{};
+            std::copy(keys.begin(), keys.begin() + middle, inner->keys.begin());
+            std::copy(children.begin(), children.begin() + middle + 1, inner->children.begin());
+            std::fill(inner->children.begin() + middle + 1, inner->children.end(), nullptr);
+            inner->count = middle;
+            std::copy(keys.begin() + middle + 1, keys.end(), right->keys.begin());
+            std::copy(children.begin() + middle + 1, children.end(), right->children.begin());
+            right->count = node_capacity - middle;
+            return {keys[middle], right};
+        }
+    };
+
+    HYPERION_IGNORE_PADDING_WARNING_STOP;
+
+} // namespace hyperion
+
+#if defined(HYPERION_ENABLE_TESTING) && HYPERION_ENABLE_TESTING
+
+    #include <boost/ut.hpp>
+
+    #include <map>
+    #include <random>
+
+namespace hyperion::_test::platform::btree {
+
+    // NOLINTNEXTLINE(google-build-using-namespace)
+    using namespace boost::ut;
+
+    template<typename TKey>
+    inline auto matches(const hyperion::btree_map<TKey, u64>& tree, const std::map<TKey, u64>& map)
+        -> bool {
+        if(tree.size() != map.size()) {
+            return false;
+        }
+        auto iter = map.begin();
+        auto same = true;
+        tree.for_each([&](const TKey& key, const u64& value) {
+            same = same && iter != map.end() && iter->first == key && iter->second == value;
+            ++iter;
+        });
+        return same && iter == map.end();
+    }
+
+    template<typename TKey>
+    inline auto random_operations(std::mt19937_64& engine, TKey low, TKey high) -> bool {
+        auto tree = hyperion::btree_map<TKey, u64>{};
+        auto map = std::map<TKey, u64>{};
+        auto keys = std::uniform_int_distribution<TKey>{low, high};
+        auto consistent = true;
+        for(auto step = 0_u64; step < 40'000_u64; ++step) {
+            const auto key = keys(engine);
+            if(engine() % 4U == 0U) {
+                consistent = consistent && tree.erase(key) == (map.erase(key) == 1U);
+            }
+            else {
+                const auto inserted = map.insert_or_assign(key, step).second;
+                consistent = consistent && tree.insert_or_assign(key, step) == inserted;
+            }
+        }
+        for(auto key = low; key < static_cast<TKey>(low + 2'000); ++key) {
+            const auto* found = tree.find(key);
+            const auto iter = map.find(key);
+            consistent = consistent && (found == nullptr) == (iter == map.end())
+                         && (found == nullptr || *found == iter->second);
+        }
+        return consistent && matches(tree, map);
+    }
+
+    // NOLINTNEXTLINE(cert-err58-cpp)
+    static const suite<"hyperion::platform::btree"> btree_tests = [] {
+        "matches_std_map"_test = [] {
+            auto engine = std::mt19937_64{1U};
+            expect(random_operations<u64>(engine, 0_u64, 20'000_u64));
+            // keys with the sign bit set exercise the unsigned comparisons
+            expect(random_operations<u64>(engine,
+                                          0xFFFF'FFFF'FFFF'0000_u64,
+                                          0xFFFF'FFFF'FFFF'FFFF_u64));
+            expect(random_operations<i64>(engine, -10'000_i64, 10'000_i64));
+            expect(random_operations<i32>(engine, -10'000, 10'000));
+            expect(random_operations<u32>(engine, 0xFFFF'0000U, 0xFFFF'FFFFU));
+            expect(random_operations<u16>(engine, static_cast<u16>(0), static_cast<u16>(5'000)));
+        };
+
+        "bulk_load_and_range_scan"_test = [] {
+            auto keys = std::vector<u64>{};
+            auto values = std::vector<u64>{};
+            for(auto key = 0_u64; key < 1'000'000_u64; ++key) {
+                keys.push_back(key * 3_u64);
+                values.push_back(key);
+            }
+
+            auto tree = hyperion::btree_map<u64, u64>{};
+            tree.assign_sorted(std::span<const u64>{keys}, std::span<const u64>{values});
+            expect(that % tree.size() == 1'000'000_usize);
+            expect(that % tree.height() <= 4_usize);
+            expect(that % tree.at(2'999'997_u64) == 999'999_u64);
+            expect(!tree.contains(1_u64));
+
+            auto visited = std::vector<u64>{};
+            tree.for_each_in_range(10_u64, 20_u64, [&visited](u64 key, u64& value) {
+                visited.push_back(key);
+                value = 0_u64;
+            });
+            expect(visited == std::vector<u64>{12_u64, 15_u64, 18_u64});
+            expect(that % tree.at(15_u64) == 0_u64);
+
+            // inserting into the packed leaves splits them
+            expect(tree.insert_or_assign(16_u64, 7_u64));
+            auto count = 0_usize;
+            tree.for_each_in_range(0_u64, 30_u64, [&count](u64, const u64&) { ++count; });
+            expect(that % count == 12_usize);
+
+            auto moved = std::move(tree);
+            expect(that % moved.size() == 1'000'001_usize);
+            moved.clear();
+            expect(moved.empty());
+            expect(that % moved.height() == 0_usize);
+        };
+
+        "unsorted_construction"_test = [] {
+            const auto tree = hyperion::btree_map<i32, u64>{
+                std::vector<i32>{5, -3, 9, 5, 0},
+                std::vector<u64>{1_u64, 2_u64, 3_u64, 4_u64, 5_u64}};
+            expect(that % tree.size() == 4_usize);
+            expect(that % tree.at(5) == 1_u64);
+            expect(that % tree.at(-3) == 2_u64);
+        };
+
+        "float_keys"_test = [] {
+            using namespace hyperion::platform::compare;
+            using policy = hyperion::tolerant_key<f64>;
+            auto tree = hyperion::btree_map<f64, u64, policy>{
+                policy{Epsilon<EpsilonType::Absolute, f64>{1e-9}}};
+            for(auto index = 0_u64; index < 1'000_u64; ++index) {
+                expect(tree.insert_or_assign(static_cast<f64>(index) * 0.1, index));
+            }
+
+            expect(!tree.insert_or_assign(0.1 + 0.2, 99_u64));
+            expect(that % tree.size() == 1'000_usize);
+            expect(that % tree.at(0.3) == 99_u64);
+
+            auto all_found = true;
+            for(auto index = 0_u64; index < 1'000_u64; ++index) {
+                const auto* value = tree.find(static_cast<f64>(index) * 0.1 + 1e-12);
+                all_found = all_found && value != nullptr && (index == 3_u64 || *value == index);
+            }
+            expect(all_found);
+            expect(tree.erase(0.3 - 1e-12));
+            expect(!tree.contains(0.3));
+
+            auto floats = hyperion::btree_map<f32, u64>{};
+            for(auto index = 0; index < 500; ++index) {
+                floats.insert_or_assign(static_cast<f32>(250 - index) * 0.5F, 1_u64);
+            }
+            auto count = 0_usize;
+            floats.for_each_in_range(-1.0F, 1.0F, [&count](f32, const u64&) { ++count; });
+            expect(that % count == 5_usize);
+        };
+    };
+
+} // namespace hyperion::_test::platform::btree
+
+#endif // defined(HYPERION_ENABLE_TESTING) && HYPERION_ENABLE_TESTING
+
+#endif // HYPERION_PLATFORM_BTREE_H
@@ -0,0 +1,308 @@
+/// @file coarse_clock.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Cheap, coarse-grained monotonic clock backed by a cached timestamp
+/// @version 0.4.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2024 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef HYPERION_PLATFORM_COARSE_CLOCK_H
+#define HYPERION_PLATFORM_COARSE_CLOCK_H
+
+#include <hyperion/platform.h>
+#include <hyperion/platform/def.h>
+#include <hyperion/platform/types.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#if HYPERION_PLATFORM_IS_LINUX
+    #include <time.h> // NOLINT(modernize-deprecated-headers)
+#endif // HYPERION_PLATFORM_IS_LINUX
+
+/// @ingroup platform
+/// @{
+///	@defgroup coarse_clock Coarse Clock
+/// `hyperion::platform::coarse_clock` is a monotonic `std::chrono` clock for timestamps that
+/// only need (roughly) millisecond precision, such as log lines, TTLs, and rate limiters.
+///
+/// While a `hyperion::platform::coarse_clock_ticker` is alive, a background thread refreshes a
+/// cached timestamp every configurable number of microseconds, and `coarse_clock::now()` is a
+/// single relaxed atomic load of that timestamp. The timestamp occupies its own cache line, so
+/// readers only incur a cache miss when it has actually been refreshed.
+///
+/// Without a ticker, `coarse_clock::now()` falls back to `CLOCK_MONOTONIC_COARSE` on Linux
+/// (a vDSO read of the kernel's tick-granularity clock, without a hardware counter read), and
+/// to `std::chrono::steady_clock` on other platforms.
+///
+/// # Example
+/// @code {.cpp}
+/// auto main() -> int {
+///     const auto ticker = hyperion::platform::coarse_clock_ticker{std::chrono::microseconds{500}};
+///     // ...
+/// }
+///
+/// auto rate_limiter::try_acquire() -> bool {
+///     const auto now = hyperion::platform::coarse_clock::now();
+///     // ...
+/// }
+/// @endcode
+/// @headerfile hyperion/platform/coarse_clock.h
+/// @}
+
+namespace hyperion::platform {
+
+    namespace detail::coarse_clock {
+        HYPERION_IGNORE_PADDING_WARNING_START;
+
+        struct alignas(HYPERION_PLATFORM_CACHE_LINE_SIZE) cached_time {
+            // nanoseconds since the steady clock's epoch, or zero if no ticker is running
+            std::atomic<i64> nanoseconds = 0;
+            // the last value published by a ticker, so that falling back never moves backwards
+            std::atomic<i64> floor = 0;
+            std::atomic<bool> ticking = false;
+        };
+
+        HYPERION_IGNORE_PADDING_WARNING_STOP;
+
+        static_assert(sizeof(cached_time) == HYPERION_PLATFORM_CACHE_LINE_SIZE,
+                      "The cached time must occupy exactly one cache line");
+
+        inline constinit cached_time g_cached_time{}; // NOLINT(*-avoid-non-const-global-variables)
+
+        [[nodiscard]] inline auto precise_nanoseconds() noexcept -> i64 {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                       std::chrono::steady_clock::now().time_since_epoch())
+                .count();
+        }
+
+        [[nodiscard]] inline auto coarse_nanoseconds() noexcept -> i64 {
+#if HYPERION_PLATFORM_IS_LINUX
+            // `CLOCK_MONOTONIC_COARSE` shares its epoch with `CLOCK_MONOTONIC`, which backs
+            // `std::chrono::steady_clock` in both libstdc++ and libc++
+            timespec time{};
+            if(clock_gettime(CLOCK_MONOTONIC_COARSE, &time) == 0) {
+                return static_cast<i64>(time.tv_sec) * 1'000'000'000_i64
+                       + static_cast<i64>(time.tv_nsec);
+            }
+#endif // HYPERION_PLATFORM_IS_LINUX
+            return precise_nanoseconds();
+        }
+    } // namespace detail::coarse_clock
+
+    /// @brief A monotonic clock that reads a cached timestamp instead of querying the system.
+    ///
+    /// Satisfies the standard _Clock_ requirements. Its epoch is that of
+    /// `std::chrono::steady_clock`. Its precision is the refresh interval of the running
+    /// `coarse_clock_ticker`, or the kernel tick (typically 1-4ms) on Linux when no ticker is
+    /// running.
+    ///
+    /// @ingroup coarse_clock
+    /// @headerfile hyperion/platform/coarse_clock.h
+    class coarse_clock {
+      public:
+        using rep = i64;
+        using period = std::nano;
+        using duration = std::chrono::duration<rep, period>;
+        using time_point = std::chrono::time_point<coarse_clock, duration>;
+        static constexpr bool is_steady = true;
+
+        /// @brief Returns the current (cached) time
+        /// @return The current time
+        [[nodiscard]] static auto now() noexcept -> time_point {
+            const auto cached
+                = detail::coarse_clock::g_cached_time.nanoseconds.load(std::memory_order_relaxed);
+            if(cached != 0_i64) [[likely]] {
+                return time_point{duration{cached}};
+            }
+
+            // synchronizes with a stopping ticker's release of the cached value, so we observe
+            // the floor it published
+            std::atomic_thread_fence(std::memory_order_acquire);
+            return time_point{duration{std::max(
+                detail::coarse_clock::coarse_nanoseconds(),
+                detail::coarse_clock::g_cached_time.floor.load(std::memory_order_relaxed))}};
+        }
+
+        /// @brief Returns whether a `coarse_clock_ticker` is currently refreshing the clock
+        /// @return Whether a ticker is running
+        [[nodiscard]] static auto is_ticking() noexcept -> bool {
+            return detail::coarse_clock::g_cached_time.ticking.load(std::memory_order_acquire);
+        }
+    };
+
+    /// @brief Runs a background thread refreshing `coarse_clock`'s cached timestamp for the
+    /// lifetime of the ticker.
+    ///
+    /// Only one ticker may drive the clock at a time. A ticker constructed while another is
+    /// running is inert: it starts no thread and has no effect.
+    ///
+    /// @ingroup coarse_clock
+    /// @headerfile hyperion/platform/coarse_clock.h
+    class coarse_clock_ticker {
+      public:
+        /// @brief Starts refreshing `coarse_clock` every `interval`
+        /// @param interval The refresh interval, which bounds the clock's precision
+        explicit coarse_clock_ticker(
+            std::chrono::microseconds interval = std::chrono::microseconds{1000})
+            : m_interval{interval} {
+            auto& cached = detail::coarse_clock::g_cached_time;
+            if(cached.ticking.exchange(true, std::memory_order_acq_rel)) {
+                return;
+            }
+
+            // publish before returning, so the clock is cached as soon as we're constructed
+            cached.nanoseconds.store(std::max(detail::coarse_clock::precise_nanoseconds(),
+                                              cached.floor.load(std::memory_order_relaxed)),
+                                     std::memory_order_relaxed);
+            m_thread = std::thread{[this]() { run(); }};
+        }
+
+        coarse_clock_ticker(const coarse_clock_ticker&) = delete;
+        coarse_clock_ticker(coarse_clock_ticker&&) = delete;
+
+        /// @brief Stops refreshing `coarse_clock`, which then falls back to reading the system
+        /// clock directly
+        ~coarse_clock_ticker() noexcept {
+            if(!m_thread.joinable()) {
+                return;
+            }
+
+            {
+                const auto guard = std::scoped_lock{m_mutex};
+                m_stop = true;
+            }
+            m_condition.notify_one();
+            m_thread.join();
+
+            auto& cached = detail::coarse_clock::g_cached_time;
+            cached.floor.store(cached.nanoseconds.load(std::memory_order_relaxed),
+                               std::memory_order_release);
+            cached.nanoseconds.store(0_i64, std::memory_order_release);
+            cached.ticking.store(false, std::memory_order_release);
+        }
+
+        auto operator=(const coarse_clock_ticker&) -> coarse_clock_ticker& = delete;
+        auto operator=(coarse_clock_ticker&&) -> coarse_clock_ticker& = delete;
+
+        /// @brief Returns whether this ticker is the one driving `coarse_clock`
+        /// @return Whether this ticker is active
+        [[nodiscard]] auto is_active() const noexcept -> bool {
+            return m_thread.joinable();
+        }
+
+        /// @brief Returns the refresh interval
+        /// @return The refresh interval
+        [[nodiscard]] auto interval() const noexcept -> std::chrono::microseconds {
+            return m_interval;
+        }
+
+      private:
+        std::chrono::microseconds m_interval;
+        std::mutex m_mutex;
+        std::condition_variable m_condition;
+        bool m_stop = false;
+        std::thread m_thread;
+
+        auto run() noexcept -> void {
+            auto& nanoseconds = detail::coarse_clock::g_cached_time.nanoseconds;
+            auto lock = std::unique_lock{m_mutex};
+            while(!m_stop) {
+                const auto now = detail::coarse_clock::precise_nanoseconds();
+                // only store when the value changes, to avoid needlessly invalidating readers'
+                // copies of the cache line
+                if(now > nanoseconds.load(std::memory_order_relaxed)) {
+                    nanoseconds.store(now, std::memory_order_relaxed);
+                }
+                m_condition.wait_for(lock, m_interval);
+            }
+        }
+    };
+
+} // namespace hyperion::platform
+
+#if defined(HYPERION_ENABLE_TESTING) && HYPERION_ENABLE_TESTING
+
+    #include <boost/ut.hpp>
+
+namespace hyperion::_test::platform::coarse_clock {
+
+    // NOLINTNEXTLINE(google-build-using-namespace)
+    using namespace boost::ut;
+    using hyperion::platform::coarse_clock;
+    using hyperion::platform::coarse_clock_ticker;
+
+    static_assert(std::chrono::is_clock_v<coarse_clock>);
+
+    [[nodiscard]] inline auto distance_from_steady(coarse_clock::time_point time) -> i64 {
+        const auto steady = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch());
+        return (steady - time.time_since_epoch()).count();
+    }
+
+    // NOLINTNEXTLINE(cert-err58-cpp)
+    static const suite<"hyperion::platform::coarse_clock"> coarse_clock_tests = [] {
+        "fallback"_test = [] {
+            expect(that % !coarse_clock::is_ticking());
+
+            const auto first = coarse_clock::now();
+            std::this_thread::sleep_for(std::chrono::milliseconds{20});
+            const auto second = coarse_clock::now();
+            expect(that % (second - first).count() > 0_i64);
+            // within a generous bound of the precise clock, which shares its epoch
+            expect(that % distance_from_steady(second) < 1'000'000'000_i64);
+        };
+
+        "ticker"_test = [] {
+            auto before = coarse_clock::time_point{};
+            {
+                const auto ticker = coarse_clock_ticker{std::chrono::microseconds{200}};
+                expect(that % ticker.is_active());
+                expect(that % coarse_clock::is_ticking());
+
+                // a second ticker is inert
+                const auto other = coarse_clock_ticker{};
+                expect(that % !other.is_active());
+
+                const auto first = coarse_clock::now();
+                std::this_thread::sleep_for(std::chrono::milliseconds{20});
+                const auto second = coarse_clock::now();
+                expect(that % (second - first).count() > 0_i64);
+                expect(that % distance_from_steady(second) < 1'000'000'000_i64);
+                before = coarse_clock::now();
+            }
+
+            expect(that % !coarse_clock::is_ticking());
+            // stopping the ticker never moves the clock backwards
+            expect(that % (coarse_clock::now() - before).count() >= 0_i64);
+        };
+    };
+
+} // namespace hyperion::_test::platform::coarse_clock
+
+#endif // defined(HYPERION_ENABLE_TESTING) && HYPERION_ENABLE_TESTING
+
+#endif // HYPERION_PLATFORM_COARSE_CLOCK_H
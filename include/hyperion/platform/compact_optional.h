@@ -0,0 +1,448 @@
+/// @file compact_optional.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief An optional that encodes emptiness as a sentinel value instead of a separate flag
+/// @version 0.4.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2024 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef HYPERION_PLATFORM_COMPACT_OPTIONAL_H
+#define HYPERION_PLATFORM_COMPACT_OPTIONAL_H
+
+#include <hyperion/platform.h>
+#include <hyperion/platform/assert.h>
+#include <hyperion/platform/compare.h>
+#include <hyperion/platform/def.h>
+#include <hyperion/platform/types.h>
+
+#include <bit>
+#include <concepts>
+#include <limits>
+#include <optional>
+#include <type_traits>
+
+/// @ingroup platform
+/// @{
+///	@defgroup compact_optional Compact Optional
+/// `hyperion::compact_optional<T>` is an optional that represents "no value" with a sentinel
+/// value of `T` (its "niche"), rather than a separate flag, so that
+/// `sizeof(compact_optional<T>) == sizeof(T)`. This halves the size of e.g. a
+/// `std::optional<f64>`, and a contiguous buffer of `compact_optional`s is exactly a buffer of
+/// `T`s.
+///
+/// The niche of a type is described by `hyperion::niche_traits`, which by default uses:
+/// - a NaN with a specific payload for `f32` and `f64` (other NaNs remain valid values)
+/// - the maximum value for integers
+/// - `nullptr` for pointers
+///
+/// Other sentinels can be chosen per optional with `hyperion::sentinel_niche`, e.g.
+/// `compact_optional<i32, sentinel_niche<-1>>`, or per type by specializing `niche_traits`.
+///
+/// Comparisons between engaged optionals use `hyperion/platform/compare.h`, so they are safe
+/// across signedness and account for floating point error, and NaN values never compare equal
+/// (or ordered) to anything. As with `std::optional`, two empty optionals are equal, and an
+/// empty optional is less than any engaged one.
+///
+/// # Example
+/// @code {.cpp}
+/// std::vector<hyperion::compact_optional<f64>> column(rows);
+/// column[3] = 42.0;
+/// for(const auto& cell : column) {
+///     if(cell) {
+///         total += *cell;
+///     }
+/// }
+/// @endcode
+/// @headerfile hyperion/platform/compact_optional.h
+/// @}
+
+namespace hyperion {
+
+    /// @brief Describes the niche of `TType`: a value that is never used as a real value, and
+    /// can therefore represent "no value" in a `compact_optional`. Specialize this to give other
+    /// types a default niche.
+    ///
+    /// Specializations provide `static constexpr auto sentinel() noexcept -> TType` and
+    /// `static constexpr auto is_sentinel(const TType&) noexcept -> bool`.
+    /// @tparam TType The type
+    /// @ingroup compact_optional
+    /// @headerfile hyperion/platform/compact_optional.h
+    template<typename TType>
+    struct niche_traits { };
+
+    template<typename TType>
+        requires std::integral<TType> && (!std::same_as<TType, bool>)
+    struct niche_traits<TType> {
+        [[nodiscard]] static constexpr auto sentinel() noexcept -> TType {
+            return std::numeric_limits<TType>::max();
+        }
+
+        [[nodiscard]] static constexpr auto is_sentinel(TType value) noexcept -> bool {
+            return value == sentinel();
+        }
+    };
+
+    template<typename TType>
+        requires std::same_as<TType, f32> || std::same_as<TType, f64>
+    struct niche_traits<TType> {
+      private:
+        // quiet NaNs with a payload that hardware-generated NaNs don't carry
+        using bits_type = std::conditional_t<std::same_as<TType, f32>, u32, u64>;
+        static constexpr auto k_bits = std::same_as<TType, f32>
+                                           ? static_cast<bits_type>(0x7FC0'BEEF_u32)
+                                           : static_cast<bits_type>(0x7FF8'0000'DEAD'BEEF_u64);
+
+      public:
+        [[nodiscard]] static constexpr auto sentinel() noexcept -> TType {
+            return std::bit_cast<TType>(k_bits);
+        }
+
+        [[nodiscard]] static constexpr auto is_sentinel(TType value) noexcept -> bool {
+            // NaNs never compare equal, so compare the representations instead
+            return std::bit_cast<bits_type>(value) == k_bits;
+        }
+    };
+
+    template<typename TType>
+    struct niche_traits<TType*> {
+        [[nodiscard]] static constexpr auto sentinel() noexcept -> TType* {
+            return nullptr;
+        }
+
+        [[nodiscard]] static constexpr auto is_sentinel(const TType* value) noexcept -> bool {
+            return value == nullptr;
+        }
+    };
+
+    /// @brief A niche policy for `compact_optional` that uses `TValue` as the sentinel
+    /// @tparam TValue The sentinel value
+    /// @ingroup compact_optional
+    /// @headerfile hyperion/platform/compact_optional.h
+    template<auto TValue>
+    struct sentinel_niche {
+        [[nodiscard]] static constexpr auto sentinel() noexcept {
+            return TValue;
+        }
+
+        [[nodiscard]] static constexpr auto is_sentinel(const decltype(TValue)& value) noexcept
+            -> bool {
+            return value == TValue;
+        }
+    };
+
+    /// @brief Requires that `TNiche` describes a niche of `TType`, like `niche_traits<TType>`
+    /// or `sentinel_niche<value>`
+    /// @ingroup compact_optional
+    /// @headerfile hyperion/platform/compact_optional.h
+    template<typename TNiche, typename TType>
+    concept NicheFor = requires(const TType& value) {
+        { TNiche::sentinel() } -> std::convertible_to<TType>;
+        { TNiche::is_sentinel(value) } -> std::same_as<bool>;
+    };
+
+    /// @brief An optional `TType` that represents "no value" with a sentinel value instead of a
+    /// separate flag, so it is the same size as `TType`
+    ///
+    /// @tparam TType The value type. Must be trivially copyable
+    /// @tparam TNiche The niche policy describing the sentinel. Defaults to `niche_traits<TType>`
+    /// @ingroup compact_optional
+    /// @headerfile hyperion/platform/compact_optional.h
+    template<typename TType, typename TNiche = niche_traits<TType>>
+        requires std::is_trivially_copyable_v<TType> && NicheFor<TNiche, TType>
+    class compact_optional {
+      public:
+        /// @brief The value type
+        using value_type = TType;
+        /// @brief The niche policy
+        using niche_type = TNiche;
+
+        /// @brief Constructs an empty `compact_optional`
+        constexpr compact_optional() noexcept = default;
+
+        /// @brief Constructs an empty `compact_optional`
+        // NOLINTNEXTLINE(google-explicit-constructor, hicpp-explicit-conversions)
+        constexpr compact_optional(std::nullopt_t /*unused*/) noexcept {
+        }
+
+        /// @brief Constructs a `compact_optional` holding `value`
+        /// @param value The value
+        /// @pre `value` is not the sentinel
+        // NOLINTNEXTLINE(google-explicit-constructor, hicpp-explicit-conversions)
+        constexpr compact_optional(TType value) noexcept
+            : m_value{value} {
+            HYPERION_DEBUG_ASSERT(!TNiche::is_sentinel(value),
+                                  "The sentinel value can't be stored in a compact_optional");
+        }
+
+        /// @brief Constructs a `compact_optional` from a `std::optional`
+        /// @param value The optional
+        /// @pre `value` does not hold the sentinel
+        constexpr explicit compact_optional(const std::optional<TType>& value) noexcept
+            : compact_optional{value.has_value() ? compact_optional{*value} : compact_optional{}} {
+        }
+
+        /// @brief Returns whether this holds a value
+        /// @return Whether this holds a value
+        [[nodiscard]] constexpr auto has_value() const noexcept -> bool {
+            return !TNiche::is_sentinel(m_value);
+        }
+
+        /// @brief Returns whether this holds a value
+        /// @return Whether this holds a value
+        [[nodiscard]] constexpr explicit operator bool() const noexcept {
+            return has_value();
+        }
+
+        /// @brief Returns the value
+        /// @return The value
+        /// @pre `has_value()`
+        [[nodiscard]] constexpr auto value() const noexcept -> TType {
+            HYPERION_DEBUG_ASSERT(has_value(), "Accessed the value of an empty compact_optional");
+            return m_value;
+        }
+
+        /// @brief Returns the value
+        /// @return The value
+        /// @pre `has_value()`
+        [[nodiscard]] constexpr auto operator*() const noexcept -> TType {
+            return value();
+        }
+
+        /// @brief Returns the value if this holds one, otherwise `default_value`
+        /// @param default_value The value to return if this is empty
+        /// @return The value or `default_value`
+        [[nodiscard]] constexpr auto value_or(TType default_value) const noexcept -> TType {
+            return has_value() ? m_value : default_value;
+        }
+
+        /// @brief Returns the raw stored value, which is the sentinel if this is empty
+        /// @return The raw stored value
+        [[nodiscard]] constexpr auto raw() const noexcept -> TType {
+            return m_value;
+        }
+
+        /// @brief Converts this to a `std::optional`
+        /// @return The equivalent `std::optional`
+        [[nodiscard]] constexpr auto to_optional() const noexcept -> std::optional<TType> {
+            return has_value() ? std::optional<TType>{m_value} : std::nullopt;
+        }
+
+        /// @brief Makes this empty
+        constexpr auto reset() noexcept -> void {
+            m_value = k_sentinel;
+        }
+
+        /// @brief Makes this empty
+        constexpr auto operator=(std::nullopt_t /*unused*/) noexcept -> compact_optional& {
+            reset();
+            return *this;
+        }
+
+        /// @brief Replaces the value with `value`
+        /// @param value The new value
+        /// @return The new value
+        /// @pre `value` is not the sentinel
+        constexpr auto emplace(TType value) noexcept -> TType {
+            *this = compact_optional{value};
+            return m_value;
+        }
+
+        /// @brief Compares two `compact_optional`s. Empty optionals are equal to each other, and
+        /// values are compared with `equality_compare`
+        template<typename TOther, typename TOtherNiche>
+        [[nodiscard]] friend constexpr auto
+        operator==(const compact_optional& lhs,
+                   const compact_optional<TOther, TOtherNiche>& rhs) noexcept -> bool {
+            if(lhs.has_value() != rhs.has_value()) {
+                return false;
+            }
+            return !lhs.has_value() || platform::compare::equality_compare(lhs.m_value, rhs.raw());
+        }
+
+        [[nodiscard]] friend constexpr auto
+        operator==(const compact_optional& lhs, std::nullopt_t /*unused*/) noexcept -> bool {
+            return !lhs.has_value();
+        }
+
+        [[nodiscard]] friend constexpr auto
+        operator==(const compact_optional& lhs, TType rhs) noexcept -> bool {
+            return lhs.has_value() && platform::compare::equality_compare(lhs.m_value, rhs);
+        }
+
+        /// @brief Orders two `compact_optional`s. An empty optional is less than any engaged
+        /// one, and values are compared with `less_than_compare`
+        template<typename TOther, typename TOtherNiche>
+        [[nodiscard]] friend constexpr auto
+        operator<(const compact_optional& lhs,
+                  const compact_optional<TOther, TOtherNiche>& rhs) noexcept -> bool {
+            if(!rhs.has_value()) {
+                return false;
+            }
+            return !lhs.has_value() || platform::compare::less_than_compare(lhs.m_value, rhs.raw());
+        }
+
+        template<typename TOther, typename TOtherNiche>
+        [[nodiscard]] friend constexpr auto
+        operator>(const compact_optional& lhs,
+                  const compact_optional<TOther, TOtherNiche>& rhs) noexcept -> bool {
+            if(!lhs.has_value()) {
+                return false;
+            }
+            return !rhs.has_value()
+                   || platform::compare::greater_than_compare(lhs.m_value, rhs.raw());
+        }
+
+        template<typename TOther, typename TOtherNiche>
+        [[nodiscard]] friend constexpr auto
+        operator<=(const compact_optional& lhs,
+                   const compact_optional<TOther, TOtherNiche>& rhs) noexcept -> bool {
+            if(!lhs.has_value()) {
+                return true;
+            }
+            return rhs.has_value()
+                   && platform::compare::less_than_or_equal_compare(lhs.m_value, rhs.raw());
+        }
+
+        template<typename TOther, typename TOtherNiche>
+        [[nodiscard]] friend constexpr auto
+        operator>=(const compact_optional& lhs,
+                   const compact_optional<TOther, TOtherNiche>& rhs) noexcept -> bool {
+            if(!rhs.has_value()) {
+                return true;
+            }
+            return lhs.has_value()
+                   && platform::compare::greater_than_or_equal_compare(lhs.m_value, rhs.raw());
+        }
+
+      private:
+        static constexpr auto k_sentinel
+            = static_cast<TType>(TNiche::sentinel());
+
+        TType m_value = k_sentinel;
+    };
+
+} // namespace hyperion
+
+#if defined(HYPERION_ENABLE_TESTING) && HYPERION_ENABLE_TESTING
+
+    #include <boost/ut.hpp>
+
+    #include <cmath>
+    #include <vector>
+
+namespace hyperion::_test::platform::compact_optional {
+
+    // NOLINTNEXTLINE(google-build-using-namespace)
+    using namespace boost::ut;
+
+    template<typename TType, typename TNiche = niche_traits<TType>>
+    using optional_t = hyperion::compact_optional<TType, TNiche>;
+
+    static_assert(sizeof(optional_t<f64>) == sizeof(f64));
+    static_assert(sizeof(optional_t<f32>) == sizeof(f32));
+    static_assert(sizeof(optional_t<u32>) == sizeof(u32));
+    static_assert(sizeof(optional_t<const int*>) == sizeof(const int*));
+    static_assert(std::is_trivially_copyable_v<optional_t<f64>>);
+    static_assert(!optional_t<i64>{}.has_value());
+    static_assert(optional_t<i64, sentinel_niche<-1_i64>>{0_i64}.has_value());
+    static_assert(!optional_t<i64, sentinel_niche<-1_i64>>{}.has_value());
+
+    // NOLINTNEXTLINE(cert-err58-cpp)
+    static const suite<"hyperion::platform::compact_optional"> compact_optional_tests = [] {
+        "floating_point"_test = [] {
+            auto value = optional_t<f64>{};
+            expect(that % !value.has_value());
+            expect(that % std::isnan(value.raw()));
+
+            value = 1.5;
+            expect(that % value.has_value());
+            expect(that % *value == 1.5);
+
+            // NaNs other than the sentinel are values, but never compare equal to anything
+            value = std::numeric_limits<f64>::quiet_NaN();
+            expect(that % value.has_value());
+            expect(value != value);
+            expect(that % !(value < optional_t<f64>{1.0}));
+
+            value.reset();
+            expect(value == std::nullopt);
+            expect(value == optional_t<f64>{});
+            expect(that % value.value_or(2.0) == 2.0);
+        };
+
+        "integers_and_pointers"_test = [] {
+            auto value = optional_t<u32>{7_u32};
+            expect(that % value.has_value());
+            expect(value == 7_u32);
+            expect(that % value.to_optional() == std::optional<u32>{7_u32});
+
+            value = std::nullopt;
+            expect(that % value.raw() == std::numeric_limits<u32>::max());
+            expect(that % !value.to_optional().has_value());
+
+            // safe across signedness, like equality_compare
+            expect(optional_t<i32>{-1} != optional_t<u32>{std::numeric_limits<u32>::max() - 1_u32});
+
+            auto target = 3;
+            auto pointer = optional_t<int*>{&target};
+            expect(that % *pointer.value() == 3);
+            pointer.reset();
+            expect(that % !pointer.has_value());
+        };
+
+        "ordering"_test = [] {
+            const auto empty = optional_t<i32>{};
+            const auto one = optional_t<i32>{1};
+            const auto two = optional_t<i32>{2};
+
+            expect(that % empty < one);
+            expect(that % one < two);
+            expect(that % two > empty);
+            expect(that % empty <= empty);
+            expect(that % two >= one);
+            expect(that % !(one > two));
+        };
+
+        "column"_test = [] {
+            auto column = std::vector<optional_t<f64>>(16_usize);
+            column[3] = 42.0;
+            column[7] = -1.0;
+
+            auto total = 0.0;
+            auto count = 0_usize;
+            for(const auto& cell : column) {
+                if(cell) {
+                    total += *cell;
+                    ++count;
+                }
+            }
+
+            expect(that % count == 2_usize);
+            expect(that % total == 41.0);
+        };
+    };
+
+} // namespace hyperion::_test::platform::compact_optional
+
+#endif // defined(HYPERION_ENABLE_TESTING) && HYPERION_ENABLE_TESTING
+
+#endif // HYPERION_PLATFORM_COMPACT_OPTIONAL_H
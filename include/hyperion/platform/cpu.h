@@ -0,0 +1,152 @@
+/// @file cpu.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Architecture-specific CPU hints, such as spin-wait pauses and CPU identification
+/// @version 0.4.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2024 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef HYPERION_PLATFORM_CPU_H
+#define HYPERION_PLATFORM_CPU_H
+
+#include <hyperion/platform.h>
+#include <hyperion/platform/def.h>
+#include <hyperion/platform/types.h>
+
+#include <atomic>
+#include <functional>
+#include <thread>
+
+#if HYPERION_PLATFORM_COMPILER_IS_MSVC
+    #include <intrin.h>
+#endif // HYPERION_PLATFORM_COMPILER_IS_MSVC
+
+#if HYPERION_PLATFORM_IS_LINUX
+    #include <sched.h>
+#endif // HYPERION_PLATFORM_IS_LINUX
+
+/// @ingroup platform
+/// @{
+///	@defgroup cpu CPU Hints
+/// Hyperion provides thin wrappers over architecture-specific CPU hints, such as the spin-wait
+/// pause instruction and cache prefetches, selected based on `HYPERION_PLATFORM_ARCHITECTURE`.
+/// @headerfile hyperion/platform/cpu.h
+/// @}
+
+namespace hyperion::platform {
+
+    /// @brief Hints to the CPU that the calling thread is in a spin-wait loop.
+    ///
+    /// On x86 and x86_64 this is the `pause` instruction, and on ARM it is `yield`. This reduces
+    /// the power consumed by the spin and, on hyper-threaded cores, yields execution resources
+    /// to the sibling thread. On other architectures this is only a compiler barrier.
+    /// @ingroup cpu
+    /// @headerfile hyperion/platform/cpu.h
+    inline auto cpu_relax() noexcept -> void {
+#if HYPERION_PLATFORM_IS_ARCHITECTURE(HYPERION_PLATFORM_X86_64) \
+    || HYPERION_PLATFORM_IS_ARCHITECTURE(HYPERION_PLATFORM_X86)
+    #if HYPERION_PLATFORM_COMPILER_IS_MSVC
+        _mm_pause();
+    #else
+        __builtin_ia32_pause();
+    #endif // HYPERION_PLATFORM_COMPILER_IS_MSVC
+#elif HYPERION_PLATFORM_IS_ARCHITECTURE(HYPERION_PLATFORM_ARM_V8) \
+    || HYPERION_PLATFORM_IS_ARCHITECTURE(HYPERION_PLATFORM_ARM_V7)
+    #if HYPERION_PLATFORM_COMPILER_IS_MSVC
+        __yield();
+    #else
+        asm volatile("yield" ::: "memory");
+    #endif // HYPERION_PLATFORM_COMPILER_IS_MSVC
+#else
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif // HYPERION_PLATFORM_IS_ARCHITECTURE(HYPERION_PLATFORM_X86_64)
+       // || HYPERION_PLATFORM_IS_ARCHITECTURE(HYPERION_PLATFORM_X86)
+    }
+
+    /// @brief Returns the index of the CPU the calling thread is currently running on.
+    ///
+    /// On Linux this queries the kernel (via `sched_getcpu`, which is served from the vDSO or
+    /// `rseq` area on modern kernels). On other platforms, and if the query fails, a stable
+    /// per-thread value is returned instead, which is sufficient for spreading threads across
+    /// per-CPU shards. Callers must reduce the result modulo their shard count.
+    /// @return The current CPU index
+    /// @ingroup cpu
+    /// @headerfile hyperion/platform/cpu.h
+    [[nodiscard]] inline auto current_cpu() noexcept -> usize {
+#if HYPERION_PLATFORM_IS_LINUX
+        if(const auto cpu = sched_getcpu(); cpu >= 0) {
+            return static_cast<usize>(cpu);
+        }
+#endif // HYPERION_PLATFORM_IS_LINUX
+        thread_local const auto index = std::hash<std::thread::id>{}(std::this_thread::get_id());
+        return index;
+    }
+
+    /// @brief Hints to the CPU that the memory at `address` will soon be read, so that it can
+    /// begin loading its cache line.
+    ///
+    /// This is `__builtin_prefetch` on GCC and Clang, and `_mm_prefetch` with MSVC on x86. On
+    /// other platforms this does nothing. Prefetching never faults, so `address` need not be
+    /// valid.
+    /// @param address The address that will be read
+    /// @ingroup cpu
+    /// @headerfile hyperion/platform/cpu.h
+    inline auto prefetch_read(const void* address) noexcept -> void {
+#if HYPERION_PLATFORM_COMPILER_IS_MSVC
+    #if HYPERION_PLATFORM_IS_ARCHITECTURE(HYPERION_PLATFORM_X86_64) \
+        || HYPERION_PLATFORM_IS_ARCHITECTURE(HYPERION_PLATFORM_X86)
+        _mm_prefetch(static_cast<const char*>(address), _MM_HINT_T0);
+    #else
+        static_cast<void>(address);
+    #endif // HYPERION_PLATFORM_IS_ARCHITECTURE(HYPERION_PLATFORM_X86_64)
+           // || HYPERION_PLATFORM_IS_ARCHITECTURE(HYPERION_PLATFORM_X86)
+#else
+        __builtin_prefetch(address, 0, 3);
+#endif // HYPERION_PLATFORM_COMPILER_IS_MSVC
+    }
+
+    /// @brief Hints to the CPU that the memory at `address` will soon be written, so that it
+    /// can begin loading its cache line in an exclusive state.
+    ///
+    /// This is `__builtin_prefetch` on GCC and Clang, and `_mm_prefetch` with MSVC on x86. On
+    /// other platforms this does nothing. Prefetching never faults, so `address` need not be
+    /// valid.
+    /// @param address The address that will be written
+    /// @ingroup cpu
+    /// @headerfile hyperion/platform/cpu.h
+    inline auto prefetch_write(const void* address) noexcept -> void {
+#if HYPERION_PLATFORM_COMPILER_IS_MSVC
+    #if HYPERION_PLATFORM_IS_ARCHITECTURE(HYPERION_PLATFORM_X86_64) \
+        || HYPERION_PLATFORM_IS_ARCHITECTURE(HYPERION_PLATFORM_X86)
+        _mm_prefetch(static_cast<const char*>(address), _MM_HINT_T0);
+    #else
+        static_cast<void>(address);
+    #endif // HYPERION_PLATFORM_IS_ARCHITECTURE(HYPERION_PLATFORM_X86_64)
+           // || HYPERION_PLATFORM_IS_ARCHITECTURE(HYPERION_PLATFORM_X86)
+#else
+        __builtin_prefetch(address, 1, 3);
+#endif // HYPERION_PLATFORM_COMPILER_IS_MSVC
+    }
+
+} // namespace hyperion::platform
+
+#endif // HYPERION_PLATFORM_CPU_H
@@ -202,6 +202,42 @@ HYPERION_IGNORE_UNUSED_MACROS_WARNING_START;
     #define HYPERION_UNREACHABLE()
 #endif // HYPERION_PLATFORM_COMPILER_IS_CLANG || HYPERION_PLATFORM_COMPILER_IS_GCC
 
+/// @def HYPERION_ASSUME(condition)
+/// @brief Tells the optimizer that `condition` is always true at this point, without checking it.
+/// If `condition` is ever false, the behavior is undefined. On Clang this uses
+/// `__builtin_assume`, on MSVC `__assume`, and on GCC a branch to `__builtin_unreachable()`.
+/// Note that on GCC `condition` may be evaluated, so it must not have side effects.
+/// @ingroup defines
+/// @headerfile hyperion/platform/def.h
+#if HYPERION_PLATFORM_COMPILER_IS_CLANG
+    #define HYPERION_ASSUME(condition) __builtin_assume(condition) // NOLINT
+#elif HYPERION_PLATFORM_COMPILER_IS_GCC
+    #define HYPERION_ASSUME(condition) /** NOLINT(cppcoreguidelines-macro-usage) **/ \
+        do {                                                                        \
+            if(!static_cast<bool>(condition)) {                                      \
+                __builtin_unreachable();                                            \
+            }                                                                       \
+        } while(false)
+#elif HYPERION_PLATFORM_COMPILER_IS_MSVC
+    #define HYPERION_ASSUME(condition) __assume(condition) // NOLINT
+#else
+    #define HYPERION_ASSUME(condition) static_cast<void>(0) // NOLINT
+#endif // HYPERION_PLATFORM_COMPILER_IS_CLANG
+
+/// @def HYPERION_COLD
+/// @brief Marks the following function as unlikely to be called and prevents it from being
+/// inlined, so that calls to it stay out of the instruction stream of the hot paths calling it.
+/// On GCC/Clang, this is `[[gnu::cold, gnu::noinline]]`, on MSVC `__declspec(noinline)`
+/// @ingroup defines
+/// @headerfile hyperion/platform/def.h
+#if HYPERION_PLATFORM_COMPILER_IS_CLANG || HYPERION_PLATFORM_COMPILER_IS_GCC
+    #define HYPERION_COLD [[gnu::cold, gnu::noinline]] // NOLINT(cppcoreguidelines-macro-usage)
+#elif HYPERION_PLATFORM_COMPILER_IS_MSVC
+    #define HYPERION_COLD __declspec(noinline) // NOLINT(cppcoreguidelines-macro-usage)
+#else
+    #define HYPERION_COLD
+#endif // HYPERION_PLATFORM_COMPILER_IS_CLANG || HYPERION_PLATFORM_COMPILER_IS_GCC
+
 // clang-format off
 
 /// @def HYPERION_IGNORE_SUGGEST_DESTRUCTOR_OVERRIDE_WARNING_START
@@ -1001,33 +1037,75 @@ HYPERION_IGNORE_UNUSED_MACROS_WARNING_START;
     #define HYPERION_IGNORE_UNSAFE_BUFFER_WARNING_STOP
 #endif // HYPERION_PLATFORM_COMPILER_IS_CLANG
 
+/// @def HYPERION_IGNORE_IGNORED_ATTRIBUTES_WARNING_START
+/// @brief Use to disable warnings for attributes that the compiler chose not to apply, e.g.
+/// `HYPERION_TRIVIAL_ABI` on instantiations of a class template whose members are not trivial
+/// for the purpose of calls (clang's `-Wignored-attributes`)
+/// @ingroup defines
+/// @headerfile hyperion/platform/def.h
+
+/// @def HYPERION_IGNORE_IGNORED_ATTRIBUTES_WARNING_STOP
+/// @brief Use to re-enable warnings for attributes that the compiler chose not to apply
+/// (clang's `-Wignored-attributes`)
+/// @ingroup defines
+/// @headerfile hyperion/platform/def.h
+
+#if HYPERION_PLATFORM_COMPILER_IS_CLANG
+    #define HYPERION_IGNORE_IGNORED_ATTRIBUTES_WARNING_START \
+	        _Pragma("GCC diagnostic push")                   \
+	        _Pragma("GCC diagnostic ignored \"-Wignored-attributes\"")
+    #define HYPERION_IGNORE_IGNORED_ATTRIBUTES_WARNING_STOP \
+	        _Pragma("GCC diagnostic pop")
+#else
+    #define HYPERION_IGNORE_IGNORED_ATTRIBUTES_WARNING_START
+    #define HYPERION_IGNORE_IGNORED_ATTRIBUTES_WARNING_STOP
+#endif // HYPERION_PLATFORM_COMPILER_IS_CLANG
+
 // clang-format on
 
 /// @def HYPERION_PLATFORM_PROFILING_ENABLED
-/// @brief Indicates whether Tracy profiling is enabled for this build
+/// @brief Indicates whether profiling is enabled for this build, either with Tracy or, when
+/// `HYPERION_ENABLE_FLIGHT_RECORDER` is `true`, with the flight recorder (see
+/// `hyperion/platform/flight_recorder.h`). Tracy takes precedence if both are enabled.
+/// The profiling macros below expand to nothing when profiling is disabled
 /// @ingroup defines
 /// @headerfile hyperion/platform/def.h
 
 /// @def HYPERION_PROFILE_FUNCTION
-/// @brief Profiles the containing scope with Tracy in builds where Tracy profiling is enabled
+/// @brief Profiles the containing scope in builds where profiling is enabled
 /// @ingroup defines
 /// @headerfile hyperion/platform/def.h
 
 /// @def HYPERION_PROFILE_START_FRAME
-/// @brief Starts a profiling frame with the given name with Tracy in builds where Tracy
-/// profiling is enabled
+/// @brief Starts a profiling frame with the given name in builds where profiling is enabled
 /// @ingroup defines
 /// @headerfile hyperion/platform/def.h
 
 /// @def HYPERION_PROFILE_END_FRAME
-/// @brief Ends the profiling frame with the given name with Tracy in builds where Tracy
-/// profiling is enabled
+/// @brief Ends the profiling frame with the given name in builds where profiling is enabled
 /// @ingroup defines
 /// @headerfile hyperion/platform/def.h
 
 /// @def HYPERION_PROFILE_MARK_FRAME
-/// @brief Marks the end of a profiling frame with Tracy in builds where Tracy profiling is
-/// enabled
+/// @brief Marks the end of a profiling frame in builds where profiling is enabled
+/// @ingroup defines
+/// @headerfile hyperion/platform/def.h
+
+/// @def HYPERION_PROFILE_ALLOC
+/// @brief Records an allocation of `size` bytes at `ptr` in the named memory pool `name` with
+/// Tracy in builds where Tracy profiling is enabled. The flight recorder does not track memory
+/// @ingroup defines
+/// @headerfile hyperion/platform/def.h
+
+/// @def HYPERION_PROFILE_FREE
+/// @brief Records the release of the allocation at `ptr` in the named memory pool `name` with
+/// Tracy in builds where Tracy profiling is enabled. The flight recorder does not track memory
+/// @ingroup defines
+/// @headerfile hyperion/platform/def.h
+
+/// @def HYPERION_PROFILE_PLOT
+/// @brief Records `value` as the next point of the plot named `name` in builds where profiling
+/// is enabled. `name` must have static storage duration
 /// @ingroup defines
 /// @headerfile hyperion/platform/def.h
 
@@ -1076,12 +1154,50 @@ HYPERION_IGNORE_RESERVED_IDENTIFIERS_WARNING_STOP
                       hicpp-no-array-decay) **/                                                   \
             HYPERION_IGNORE_OLD_STYLE_CASTS_WARNING_STOP                                          \
                 HYPERION_IGNORE_RESERVED_IDENTIFIERS_WARNING_STOP
+    #define HYPERION_PROFILE_ALLOC(ptr, size, name) /** NOLINT(cppcoreguidelines-macro-usage) **/ \
+        HYPERION_IGNORE_RESERVED_IDENTIFIERS_WARNING_START                                        \
+        HYPERION_IGNORE_OLD_STYLE_CASTS_WARNING_START                                             \
+        TracyAllocN(ptr, size, name) HYPERION_IGNORE_OLD_STYLE_CASTS_WARNING_STOP                 \
+            HYPERION_IGNORE_RESERVED_IDENTIFIERS_WARNING_STOP
+    #define HYPERION_PROFILE_FREE(ptr, name) /** NOLINT(cppcoreguidelines-macro-usage) **/        \
+        HYPERION_IGNORE_RESERVED_IDENTIFIERS_WARNING_START                                        \
+        HYPERION_IGNORE_OLD_STYLE_CASTS_WARNING_START                                             \
+        TracyFreeN(ptr, name) HYPERION_IGNORE_OLD_STYLE_CASTS_WARNING_STOP                        \
+            HYPERION_IGNORE_RESERVED_IDENTIFIERS_WARNING_STOP
+    #define HYPERION_PROFILE_PLOT(name, value) /** NOLINT(cppcoreguidelines-macro-usage) **/      \
+        HYPERION_IGNORE_RESERVED_IDENTIFIERS_WARNING_START                                        \
+        HYPERION_IGNORE_OLD_STYLE_CASTS_WARNING_START                                             \
+        TracyPlot(name, value) HYPERION_IGNORE_OLD_STYLE_CASTS_WARNING_STOP                       \
+            HYPERION_IGNORE_RESERVED_IDENTIFIERS_WARNING_STOP
+#elif defined(HYPERION_ENABLE_FLIGHT_RECORDER) && HYPERION_ENABLE_FLIGHT_RECORDER
+    #include <hyperion/platform/flight_recorder.h>
+
+    #define HYPERION_PLATFORM_PROFILING_ENABLED /** NOLINT(cppcoreguidelines-macro-usage) **/ true
+    #define HYPERION_PROFILE_FUNCTION()         /** NOLINT(cppcoreguidelines-macro-usage) **/     \
+        static constexpr auto hyperion_profile_zone_site                                          \
+            = ::hyperion::platform::flight_recorder::zone_site{                                   \
+                static_cast<const char*>(__func__), __FILE__, __LINE__};                          \
+        const auto hyperion_profile_zone                                                          \
+            = ::hyperion::platform::flight_recorder::zone{&hyperion_profile_zone_site}
+    #define HYPERION_PROFILE_START_FRAME(name) /** NOLINT(cppcoreguidelines-macro-usage) **/      \
+        ::hyperion::platform::flight_recorder::start_frame(name)
+    #define HYPERION_PROFILE_END_FRAME(name) /** NOLINT(cppcoreguidelines-macro-usage) **/        \
+        ::hyperion::platform::flight_recorder::end_frame(name)
+    #define HYPERION_PROFILE_MARK_FRAME() /** NOLINT(cppcoreguidelines-macro-usage) **/           \
+        ::hyperion::platform::flight_recorder::mark_frame()
+    #define HYPERION_PROFILE_ALLOC(ptr, size, name) /** NOLINT(cppcoreguidelines-macro-usage) **/
+    #define HYPERION_PROFILE_FREE(ptr, name)    /** NOLINT(cppcoreguidelines-macro-usage) **/
+    #define HYPERION_PROFILE_PLOT(name, value) /** NOLINT(cppcoreguidelines-macro-usage) **/      \
+        ::hyperion::platform::flight_recorder::record_counter(name, static_cast<double>(value))
 #else
     #define HYPERION_PLATFORM_PROFILING_ENABLED /** NOLINT(cppcoreguidelines-macro-usage) **/ false
     #define HYPERION_PROFILE_FUNCTION()         /** NOLINT(cppcoreguidelines-macro-usage) **/
     #define HYPERION_PROFILE_START_FRAME(name)  /** NOLINT(cppcoreguidelines-macro-usage) **/
     #define HYPERION_PROFILE_END_FRAME(name)    /** NOLINT(cppcoreguidelines-macro-usage) **/
     #define HYPERION_PROFILE_MARK_FRAME()       /** NOLINT(cppcoreguidelines-macro-usage) **/
+    #define HYPERION_PROFILE_ALLOC(ptr, size, name) /** NOLINT(cppcoreguidelines-macro-usage) **/
+    #define HYPERION_PROFILE_FREE(ptr, name)    /** NOLINT(cppcoreguidelines-macro-usage) **/
+    #define HYPERION_PROFILE_PLOT(name, value)  /** NOLINT(cppcoreguidelines-macro-usage) **/
 #endif
 
 HYPERION_IGNORE_UNUSED_MACROS_WARNING_STOP;
@@ -0,0 +1,1175 @@
+/// @file expected.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief An exception-free result type that is passed in registers where possible
+/// @version 0.4.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2024 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef HYPERION_PLATFORM_EXPECTED_H
+#define HYPERION_PLATFORM_EXPECTED_H
+
+#include <hyperion/platform.h>
+#include <hyperion/platform/assert.h>
+#include <hyperion/platform/def.h>
+#include <hyperion/platform/types.h>
+
+#include <concepts>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+/// @ingroup platform
+/// @{
+///	@defgroup expected Expected
+/// `hyperion::expected<T, E>` holds either a value of type `T` (which may be `void`) or an error
+/// of type `E`, for reporting errors without exceptions. It mirrors the interface of C++23's
+/// `std::expected`, including the monadic operations `and_then`, `or_else`, `transform` and
+/// `transform_error`, with two differences aimed at hot paths:
+///
+/// - Its special member functions are trivial whenever those of `T` and `E` are, and it is
+/// marked `HYPERION_TRIVIAL_ABI`, so small results are passed and returned in registers
+/// instead of in memory.
+/// - If `T` is `void` and `E` has an "error niche" (a value that is never used as an error, see
+/// `hyperion::error_niche`), the niche is used as the discriminant instead of a separate flag.
+/// Pointer error types use `nullptr` as their niche automatically, and enum error types can
+/// opt in by specializing `hyperion::error_niche`. For example,
+/// `sizeof(expected<void, const char*>) == sizeof(const char*)`. With a non-`void` `T` the
+/// error would have to live beside the value rather than share its storage, so the niche
+/// would save nothing over the flag.
+///
+/// Accessing the value of an `expected` holding an error (or vice versa) is checked with
+/// `HYPERION_DEBUG_ASSERT`, not an exception.
+///
+/// # Example
+/// @code {.cpp}
+/// enum class parse_error : u8 { None, Empty, InvalidDigit };
+///
+/// template<>
+/// struct hyperion::error_niche<parse_error> {
+///     static constexpr auto value = parse_error::None;
+/// };
+///
+/// auto parse_digit(char digit) -> hyperion::expected<u32, parse_error> {
+///     if(digit < '0' || digit > '9') [[unlikely]] {
+///         return hyperion::unexpected{parse_error::InvalidDigit};
+///     }
+///     return static_cast<u32>(digit - '0');
+/// }
+///
+/// const auto doubled = parse_digit('4').transform([](u32 value) { return value * 2_u32; });
+/// @endcode
+/// @headerfile hyperion/platform/expected.h
+/// @}
+
+namespace hyperion {
+
+    /// @brief Specialize this with a `static constexpr TError value` member to declare a value
+    /// of `TError` that is never used as an error, allowing `expected<void, TError>` to use it
+    /// as its discriminant. Pointers use `nullptr` by default.
+    /// @tparam TError The error type
+    /// @ingroup expected
+    /// @headerfile hyperion/platform/expected.h
+    template<typename TError>
+    struct error_niche { };
+
+    template<typename TPointee>
+    struct error_niche<TPointee*> {
+        static constexpr TPointee* value = nullptr;
+    };
+
+    /// @brief Whether `TError` has an `error_niche` that `expected` can use as its discriminant
+    /// @ingroup expected
+    /// @headerfile hyperion/platform/expected.h
+    template<typename TError>
+    concept HasErrorNiche = std::is_trivially_copyable_v<TError> && std::equality_comparable<TError>
+                            && requires {
+                                   { error_niche<TError>::value } -> std::convertible_to<TError>;
+                               };
+
+    /// @brief Wraps an error value, to construct an `expected` holding an error
+    /// @tparam TError The error type
+    /// @ingroup expected
+    /// @headerfile hyperion/platform/expected.h
+    template<typename TError>
+        requires std::is_object_v<TError> && (!std::is_const_v<TError>)
+    class unexpected {
+      public:
+        /// @brief Constructs an `unexpected` from the given error
+        /// @param error The error
+        template<typename TOther = TError>
+            requires std::constructible_from<TError, TOther>
+                     && (!std::same_as<std::remove_cvref_t<TOther>, unexpected>)
+                     && (!std::same_as<std::remove_cvref_t<TOther>, std::in_place_t>)
+        constexpr explicit unexpected(TOther&& error) noexcept(
+            std::is_nothrow_constructible_v<TError, TOther>)
+            : m_error(std::forward<TOther>(error)) {
+        }
+
+        /// @brief Constructs an `unexpected` by constructing its error in place
+        /// @param args The arguments to construct the error with
+        template<typename... TArgs>
+            requires std::constructible_from<TError, TArgs...>
+        constexpr explicit unexpected(std::in_place_t /*unused*/, TArgs&&... args) noexcept(
+            std::is_nothrow_constructible_v<TError, TArgs...>)
+            : m_error(std::forward<TArgs>(args)...) {
+        }
+
+        /// @brief Returns the error
+        /// @return The error
+        [[nodiscard]] constexpr auto error() & noexcept -> TError& {
+            return m_error;
+        }
+
+        /// @brief Returns the error
+        /// @return The error
+        [[nodiscard]] constexpr auto error() const& noexcept -> const TError& {
+            return m_error;
+        }
+
+        /// @brief Returns the error
+        /// @return The error
+        [[nodiscard]] constexpr auto error() && noexcept -> TError&& {
+            return std::move(m_error);
+        }
+
+        /// @brief Returns the error
+        /// @return The error
+        [[nodiscard]] constexpr auto error() const&& noexcept -> const TError&& {
+            return std::move(m_error);
+        }
+
+        template<typename TOther>
+        friend constexpr auto
+        operator==(const unexpected& lhs, const unexpected<TOther>& rhs) -> bool {
+            return lhs.error() == rhs.error();
+        }
+
+      private:
+        TError m_error;
+    };
+
+    template<typename TError>
+    unexpected(TError) -> unexpected<TError>;
+
+    /// @brief Tag type used to construct an `expected` holding an error in place
+    /// @ingroup expected
+    /// @headerfile hyperion/platform/expected.h
+    struct unexpect_t {
+        explicit unexpect_t() = default;
+    };
+
+    /// @brief Tag used to construct an `expected` holding an error in place
+    /// @ingroup expected
+    /// @headerfile hyperion/platform/expected.h
+    inline constexpr auto unexpect = unexpect_t{};
+
+    template<typename TValue, typename TError>
+    class expected;
+
+    namespace detail::expected {
+        /// @brief Stands in for the value of an `expected<void, E>`
+        struct empty {
+            friend constexpr auto operator==(empty, empty) noexcept -> bool = default;
+        };
+
+        template<typename TValue>
+        using stored_t = std::conditional_t<std::is_void_v<TValue>, empty, TValue>;
+
+        template<typename TType>
+        struct is_expected : std::false_type { };
+
+        template<typename TValue, typename TError>
+        struct is_expected<::hyperion::expected<TValue, TError>> : std::true_type { };
+
+        template<typename TType>
+        struct is_unexpected : std::false_type { };
+
+        template<typename TError>
+        struct is_unexpected<unexpected<TError>> : std::true_type { };
+
+        template<typename TValue, typename TError>
+        concept TriviallyDestructible
+            = std::is_trivially_destructible_v<TValue> && std::is_trivially_destructible_v<TError>;
+
+        template<typename TValue, typename TError>
+        concept CopyConstructible
+            = std::is_copy_constructible_v<TValue> && std::is_copy_constructible_v<TError>;
+
+        template<typename TValue, typename TError>
+        concept TriviallyCopyConstructible
+            = CopyConstructible<TValue, TError> && std::is_trivially_copy_constructible_v<TValue>
+              && std::is_trivially_copy_constructible_v<TError>;
+
+        template<typename TValue, typename TError>
+        concept MoveConstructible
+            = std::is_move_constructible_v<TValue> && std::is_move_constructible_v<TError>;
+
+        template<typename TValue, typename TError>
+        concept TriviallyMoveConstructible
+            = MoveConstructible<TValue, TError> && std::is_trivially_move_constructible_v<TValue>
+              && std::is_trivially_move_constructible_v<TError>;
+
+        // assigning between a value and an error destroys one and constructs the other, which
+        // must not throw for the `expected` to remain valid
+        template<typename TValue, typename TError>
+        concept CopyAssignable = CopyConstructible<TValue, TError>
+                                 && std::is_copy_assignable_v<TValue>
+                                 && std::is_copy_assignable_v<TError>
+                                 && std::is_nothrow_move_constructible_v<TValue>
+                                 && std::is_nothrow_move_constructible_v<TError>;
+
+        template<typename TValue, typename TError>
+        concept TriviallyCopyAssignable
+            = CopyAssignable<TValue, TError> && TriviallyCopyConstructible<TValue, TError>
+              && TriviallyDestructible<TValue, TError>
+              && std::is_trivially_copy_assignable_v<TValue>
+              && std::is_trivially_copy_assignable_v<TError>;
+
+        template<typename TValue, typename TError>
+        concept MoveAssignable = MoveConstructible<TValue, TError>
+                                 && std::is_move_assignable_v<TValue>
+                                 && std::is_move_assignable_v<TError>
+                                 && std::is_nothrow_move_constructible_v<TValue>
+                                 && std::is_nothrow_move_constructible_v<TError>;
+
+        template<typename TValue, typename TError>
+        concept TriviallyMoveAssignable
+            = MoveAssignable<TValue, TError> && TriviallyMoveConstructible<TValue, TError>
+              && TriviallyDestructible<TValue, TError>
+              && std::is_trivially_move_assignable_v<TValue>
+              && std::is_trivially_move_assignable_v<TError>;
+
+        /// @brief Forwards `member` with the value category of `TSelf`
+        template<typename TSelf, typename TMember>
+        [[nodiscard]] constexpr auto like(TMember& member) noexcept -> decltype(auto) {
+            if constexpr(std::is_lvalue_reference_v<TSelf>) {
+                return (member);
+            }
+            else {
+                return std::move(member);
+            }
+        }
+
+        HYPERION_IGNORE_IGNORED_ATTRIBUTES_WARNING_START;
+
+        /// @brief Uninitialized storage for a value or an error. Its special member functions are
+        /// trivial when those of its members are, and do nothing otherwise; the owning
+        /// `expected` manages the lifetime of the active member.
+        template<typename TValue, typename TError>
+        union HYPERION_TRIVIAL_ABI slot {
+            empty none;
+            TValue value;
+            TError error;
+
+            constexpr slot() noexcept
+                : none{} {
+            }
+
+            constexpr slot(const slot&) noexcept
+                requires TriviallyCopyConstructible<TValue, TError>
+            = default;
+            constexpr slot(const slot& /*unused*/) noexcept
+                : none{} {
+            }
+
+            constexpr slot(slot&&) noexcept
+                requires TriviallyMoveConstructible<TValue, TError>
+            = default;
+            constexpr slot(slot&& /*unused*/) noexcept
+                : none{} {
+            }
+
+            constexpr auto operator=(const slot&) noexcept -> slot&
+                requires TriviallyCopyAssignable<TValue, TError>
+            = default;
+            // NOLINTNEXTLINE(cert-oop54-cpp)
+            constexpr auto operator=(const slot& /*unused*/) noexcept -> slot& {
+                return *this;
+            }
+
+            constexpr auto operator=(slot&&) noexcept -> slot&
+                requires TriviallyMoveAssignable<TValue, TError>
+            = default;
+            constexpr auto operator=(slot&& /*unused*/) noexcept -> slot& {
+                return *this;
+            }
+
+            constexpr ~slot() noexcept
+                requires TriviallyDestructible<TValue, TError>
+            = default;
+            // NOLINTNEXTLINE(modernize-use-equals-default)
+            constexpr ~slot() noexcept {
+            }
+        };
+
+        /// @brief Storage for an `expected` with a value type, or whose error type has no
+        /// niche: a value or an error, and a flag indicating which is active
+        template<typename TValue,
+                 typename TError,
+                 bool TPacked = std::same_as<TValue, empty> && HasErrorNiche<TError>>
+        struct HYPERION_TRIVIAL_ABI storage {
+            slot<TValue, TError> m_slot;
+            bool m_has_value = false;
+
+            [[nodiscard]] constexpr auto has_value() const noexcept -> bool {
+                return m_has_value;
+            }
+
+            [[nodiscard]] constexpr auto value() noexcept -> TValue& {
+                return m_slot.value;
+            }
+
+            [[nodiscard]] constexpr auto value() const noexcept -> const TValue& {
+                return m_slot.value;
+            }
+
+            [[nodiscard]] constexpr auto error() noexcept -> TError& {
+                return m_slot.error;
+            }
+
+            [[nodiscard]] constexpr auto error() const noexcept -> const TError& {
+                return m_slot.error;
+            }
+
+            template<typename... TArgs>
+            constexpr auto construct_value(TArgs&&... args) -> void {
+                std::construct_at(std::addressof(m_slot.value), std::forward<TArgs>(args)...);
+                m_has_value = true;
+            }
+
+            template<typename... TArgs>
+            constexpr auto construct_error(TArgs&&... args) -> void {
+                std::construct_at(std::addressof(m_slot.error), std::forward<TArgs>(args)...);
+                m_has_value = false;
+            }
+
+            constexpr auto destroy() noexcept -> void {
+                if(m_has_value) {
+                    std::destroy_at(std::addressof(m_slot.value));
+                }
+                else {
+                    std::destroy_at(std::addressof(m_slot.error));
+                }
+            }
+        };
+
+        /// @brief Storage for an `expected<void, E>` whose error type has a niche: just the error
+        template<typename TError>
+        struct HYPERION_TRIVIAL_ABI storage<empty, TError, true> {
+            [[HYPERION_NO_UNIQUE_ADDRESS]] empty m_value;
+            TError m_error = error_niche<TError>::value;
+
+            [[nodiscard]] constexpr auto has_value() const noexcept -> bool {
+                return m_error == error_niche<TError>::value;
+            }
+
+            [[nodiscard]] constexpr auto value() noexcept -> empty& {
+                return m_value;
+            }
+
+            [[nodiscard]] constexpr auto value() const noexcept -> const empty& {
+                return m_value;
+            }
+
+            [[nodiscard]] constexpr auto error() noexcept -> TError& {
+                return m_error;
+            }
+
+            [[nodiscard]] constexpr auto error() const noexcept -> const TError& {
+                return m_error;
+            }
+
+            constexpr auto construct_value(empty /*unused*/ = {}) noexcept -> void {
+                m_error = error_niche<TError>::value;
+            }
+
+            template<typename... TArgs>
+            constexpr auto construct_error(TArgs&&... args) -> void {
+                m_error = TError(std::forward<TArgs>(args)...);
+                HYPERION_DEBUG_ASSERT(m_error != error_niche<TError>::value,
+                                      "An error can't be the error type's error_niche");
+            }
+
+            constexpr auto destroy() noexcept -> void {
+            }
+        };
+
+        HYPERION_IGNORE_IGNORED_ATTRIBUTES_WARNING_STOP;
+    } // namespace detail::expected
+
+    HYPERION_IGNORE_IGNORED_ATTRIBUTES_WARNING_START;
+
+    /// @brief Holds either a value of type `TValue` or an error of type `TError`
+    ///
+    /// @tparam TValue The value type. May be `void`
+    /// @tparam TError The error type
+    /// @ingroup expected
+    /// @headerfile hyperion/platform/expected.h
+    template<typename TValue, typename TError>
+    class [[nodiscard]] HYPERION_TRIVIAL_ABI expected {
+        using stored_value = detail::expected::stored_t<TValue>;
+        using storage_type = detail::expected::storage<stored_value, TError>;
+
+      public:
+        /// @brief The value type
+        using value_type = TValue;
+        /// @brief The error type
+        using error_type = TError;
+        /// @brief The `unexpected` type used to construct an `expected` holding an error
+        using unexpected_type = unexpected<TError>;
+
+        /// @brief Rebinds this to another value type
+        template<typename TOther>
+        using rebind = expected<TOther, error_type>;
+
+        /// @brief Constructs an `expected` holding a value-initialized value
+        constexpr expected() noexcept(std::is_nothrow_default_constructible_v<stored_value>)
+            requires std::default_initializable<stored_value>
+        {
+            m_storage.construct_value();
+        }
+
+        /// @brief Constructs an `expected` holding a value constructed from `value`
+        /// @param value The value
+        template<typename TOther = stored_value>
+            requires(!std::is_void_v<TValue>) && std::constructible_from<stored_value, TOther>
+                    && (!std::same_as<std::remove_cvref_t<TOther>, expected>)
+                    && (!std::same_as<std::remove_cvref_t<TOther>, std::in_place_t>)
+                    && (!std::same_as<std::remove_cvref_t<TOther>, unexpect_t>)
+                    && (!detail::expected::is_unexpected<std::remove_cvref_t<TOther>>::value)
+        constexpr explicit(!std::convertible_to<TOther, stored_value>)
+            // NOLINTNEXTLINE(bugprone-forwarding-reference-overload)
+            expected(TOther&& value) noexcept(
+                std::is_nothrow_constructible_v<stored_value, TOther>) {
+            m_storage.construct_value(std::forward<TOther>(value));
+        }
+
+        /// @brief Constructs an `expected` holding an error copied from `error`
+        /// @param error The error
+        template<typename TOther>
+            requires std::constructible_from<TError, const TOther&>
+        constexpr explicit(!std::convertible_to<const TOther&, TError>)
+            // NOLINTNEXTLINE(google-explicit-constructor, hicpp-explicit-conversions)
+            expected(const unexpected<TOther>& error) noexcept(
+                std::is_nothrow_constructible_v<TError, const TOther&>) {
+            m_storage.construct_error(error.error());
+        }
+
+        /// @brief Constructs an `expected` holding an error moved from `error`
+        /// @param error The error
+        template<typename TOther>
+            requires std::constructible_from<TError, TOther>
+        constexpr explicit(!std::convertible_to<TOther, TError>)
+            // NOLINTNEXTLINE(google-explicit-constructor, hicpp-explicit-conversions)
+            expected(unexpected<TOther>&& error) noexcept(
+                std::is_nothrow_constructible_v<TError, TOther>) {
+            m_storage.construct_error(std::move(error).error());
+        }
+
+        /// @brief Constructs an `expected` holding a value constructed in place from `args`
+        /// @param args The arguments to construct the value with
+        template<typename... TArgs>
+            requires std::constructible_from<stored_value, TArgs...>
+        constexpr explicit expected(std::in_place_t /*unused*/, TArgs&&... args) noexcept(
+            std::is_nothrow_constructible_v<stored_value, TArgs...>) {
+            m_storage.construct_value(std::forward<TArgs>(args)...);
+        }
+
+        /// @brief Constructs an `expected` holding an error constructed in place from `args`
+        /// @param args The arguments to construct the error with
+        template<typename... TArgs>
+            requires std::constructible_from<TError, TArgs...>
+        constexpr explicit expected(unexpect_t /*unused*/, TArgs&&... args) noexcept(
+            std::is_nothrow_constructible_v<TError, TArgs...>) {
+            m_storage.construct_error(std::forward<TArgs>(args)...);
+        }
+
+        constexpr expected(const expected&) noexcept
+            requires detail::expected::TriviallyCopyConstructible<stored_value, TError>
+        = default;
+        constexpr expected(const expected& other) noexcept(
+            std::is_nothrow_copy_constructible_v<stored_value>
+            && std::is_nothrow_copy_constructible_v<TError>)
+            requires detail::expected::CopyConstructible<stored_value, TError>
+        {
+            construct_from(other);
+        }
+
+        constexpr expected(expected&&) noexcept
+            requires detail::expected::TriviallyMoveConstructible<stored_value, TError>
+        = default;
+        constexpr expected(expected&& other) noexcept(
+            std::is_nothrow_move_constructible_v<stored_value>
+            && std::is_nothrow_move_constructible_v<TError>)
+            requires detail::expected::MoveConstructible<stored_value, TError>
+        {
+            construct_from(std::move(other));
+        }
+
+        constexpr auto operator=(const expected&) noexcept -> expected&
+            requires detail::expected::TriviallyCopyAssignable<stored_value, TError>
+        = default;
+        // NOLINTNEXTLINE(cert-oop54-cpp)
+        constexpr auto operator=(const expected& other) noexcept(
+            std::is_nothrow_copy_constructible_v<stored_value>
+            && std::is_nothrow_copy_assignable_v<stored_value>
+            && std::is_nothrow_copy_constructible_v<TError>
+            && std::is_nothrow_copy_assignable_v<TError>) -> expected&
+            requires detail::expected::CopyAssignable<stored_value, TError>
+        {
+            assign_from(other);
+            return *this;
+        }
+
+        constexpr auto operator=(expected&&) noexcept -> expected&
+            requires detail::expected::TriviallyMoveAssignable<stored_value, TError>
+        = default;
+        constexpr auto operator=(expected&& other) noexcept(
+            std::is_nothrow_move_assignable_v<stored_value>
+            && std::is_nothrow_move_assignable_v<TError>) -> expected&
+            requires detail::expected::MoveAssignable<stored_value, TError>
+        {
+            assign_from(std::move(other));
+            return *this;
+        }
+
+        constexpr ~expected() noexcept
+            requires detail::expected::TriviallyDestructible<stored_value, TError>
+        = default;
+        constexpr ~expected() noexcept {
+            m_storage.destroy();
+        }
+
+        /// @brief Returns whether this holds a value
+        /// @return Whether this holds a value
+        [[nodiscard]] constexpr auto has_value() const noexcept -> bool {
+            return m_storage.has_value();
+        }
+
+        /// @brief Returns whether this holds a value
+        /// @return Whether this holds a value
+        [[nodiscard]] constexpr explicit operator bool() const noexcept {
+            return has_value();
+        }
+
+        /// @brief Checks that this holds a value. `expected<void, E>` only.
+        /// @pre `has_value()`
+        constexpr auto value() const noexcept -> void
+            requires std::is_void_v<TValue>
+        {
+            HYPERION_DEBUG_ASSERT(has_value(),
+                                  "Accessed the value of an expected holding an error");
+        }
+
+        /// @brief Returns the value
+        /// @return The value
+        /// @pre `has_value()`
+        [[nodiscard]] constexpr auto value() & noexcept -> stored_value&
+            requires(!std::is_void_v<TValue>)
+        {
+            HYPERION_DEBUG_ASSERT(has_value(),
+                                  "Accessed the value of an expected holding an error");
+            return m_storage.value();
+        }
+
+        /// @brief Returns the value
+        /// @return The value
+        /// @pre `has_value()`
+        [[nodiscard]] constexpr auto value() const& noexcept -> const stored_value&
+            requires(!std::is_void_v<TValue>)
+        {
+            HYPERION_DEBUG_ASSERT(has_value(),
+                                  "Accessed the value of an expected holding an error");
+            return m_storage.value();
+        }
+
+        /// @brief Returns the value
+        /// @return The value
+        /// @pre `has_value()`
+        [[nodiscard]] constexpr auto value() && noexcept -> stored_value&&
+            requires(!std::is_void_v<TValue>)
+        {
+            HYPERION_DEBUG_ASSERT(has_value(),
+                                  "Accessed the value of an expected holding an error");
+            return std::move(m_storage.value());
+        }
+
+        /// @brief Returns the value
+        /// @return The value
+        /// @pre `has_value()`
+        [[nodiscard]] constexpr auto value() const&& noexcept -> const stored_value&&
+            requires(!std::is_void_v<TValue>)
+        {
+            HYPERION_DEBUG_ASSERT(has_value(),
+                                  "Accessed the value of an expected holding an error");
+            return std::move(m_storage.value());
+        }
+
+        /// @brief Returns the value
+        /// @return The value
+        /// @pre `has_value()`
+        [[nodiscard]] constexpr auto operator*() & noexcept -> stored_value&
+            requires(!std::is_void_v<TValue>)
+        {
+            return value();
+        }
+
+        /// @brief Returns the value
+        /// @return The value
+        /// @pre `has_value()`
+        [[nodiscard]] constexpr auto operator*() const& noexcept -> const stored_value&
+            requires(!std::is_void_v<TValue>)
+        {
+            return value();
+        }
+
+        /// @brief Returns the value
+        /// @return The value
+        /// @pre `has_value()`
+        [[nodiscard]] constexpr auto operator*() && noexcept -> stored_value&&
+            requires(!std::is_void_v<TValue>)
+        {
+            return std::move(*this).value();
+        }
+
+        /// @brief Returns the value
+        /// @return The value
+        /// @pre `has_value()`
+        [[nodiscard]] constexpr auto operator*() const&& noexcept -> const stored_value&&
+            requires(!std::is_void_v<TValue>)
+        {
+            return std::move(*this).value();
+        }
+
+        /// @brief Accesses members of the value
+        /// @return A pointer to the value
+        /// @pre `has_value()`
+        [[nodiscard]] constexpr auto operator->() noexcept -> stored_value*
+            requires(!std::is_void_v<TValue>)
+        {
+            return std::addressof(value());
+        }
+
+        /// @brief Accesses members of the value
+        /// @return A pointer to the value
+        /// @pre `has_value()`
+        [[nodiscard]] constexpr auto operator->() const noexcept -> const stored_value*
+            requires(!std::is_void_v<TValue>)
+        {
+            return std::addressof(value());
+        }
+
+        /// @brief Returns the error
+        /// @return The error
+        /// @pre `!has_value()`
+        [[nodiscard]] constexpr auto error() & noexcept -> TError& {
+            HYPERION_DEBUG_ASSERT(!has_value(),
+                                  "Accessed the error of an expected holding a value");
+            return m_storage.error();
+        }
+
+        /// @brief Returns the error
+        /// @return The error
+        /// @pre `!has_value()`
+        [[nodiscard]] constexpr auto error() const& noexcept -> const TError& {
+            HYPERION_DEBUG_ASSERT(!has_value(),
+                                  "Accessed the error of an expected holding a value");
+            return m_storage.error();
+        }
+
+        /// @brief Returns the error
+        /// @return The error
+        /// @pre `!has_value()`
+        [[nodiscard]] constexpr auto error() && noexcept -> TError&& {
+            HYPERION_DEBUG_ASSERT(!has_value(),
+                                  "Accessed the error of an expected holding a value");
+            return std::move(m_storage.error());
+        }
+
+        /// @brief Returns the error
+        /// @return The error
+        /// @pre `!has_value()`
+        [[nodiscard]] constexpr auto error() const&& noexcept -> const TError&& {
+            HYPERION_DEBUG_ASSERT(!has_value(),
+                                  "Accessed the error of an expected holding a value");
+            return std::move(m_storage.error());
+        }
+
+        /// @brief Returns the value if this holds one, otherwise `default_value`
+        /// @param default_value The value to return if this holds an error
+        /// @return The value or `default_value`
+        template<typename TOther>
+            requires(!std::is_void_v<TValue>) && std::copy_constructible<stored_value>
+                    && std::convertible_to<TOther, stored_value>
+        [[nodiscard]] constexpr auto value_or(TOther&& default_value) const& -> stored_value {
+            if(has_value()) [[likely]] {
+                return m_storage.value();
+            }
+            return static_cast<stored_value>(std::forward<TOther>(default_value));
+        }
+
+        /// @brief Returns the value if this holds one, otherwise `default_value`
+        /// @param default_value The value to return if this holds an error
+        /// @return The value or `default_value`
+        template<typename TOther>
+            requires(!std::is_void_v<TValue>) && std::move_constructible<stored_value>
+                    && std::convertible_to<TOther, stored_value>
+        [[nodiscard]] constexpr auto value_or(TOther&& default_value) && -> stored_value {
+            if(has_value()) [[likely]] {
+                return std::move(m_storage.value());
+            }
+            return static_cast<stored_value>(std::forward<TOther>(default_value));
+        }
+
+        /// @brief Returns the error if this holds one, otherwise `default_error`
+        /// @param default_error The error to return if this holds a value
+        /// @return The error or `default_error`
+        template<typename TOther>
+            requires std::copy_constructible<TError> && std::convertible_to<TOther, TError>
+        [[nodiscard]] constexpr auto error_or(TOther&& default_error) const& -> TError {
+            if(has_value()) [[likely]] {
+                return static_cast<TError>(std::forward<TOther>(default_error));
+            }
+            return m_storage.error();
+        }
+
+        /// @brief Returns the error if this holds one, otherwise `default_error`
+        /// @param default_error The error to return if this holds a value
+        /// @return The error or `default_error`
+        template<typename TOther>
+            requires std::move_constructible<TError> && std::convertible_to<TOther, TError>
+        [[nodiscard]] constexpr auto error_or(TOther&& default_error) && -> TError {
+            if(has_value()) [[likely]] {
+                return static_cast<TError>(std::forward<TOther>(default_error));
+            }
+            return std::move(m_storage.error());
+        }
+
+        /// @brief If this holds a value, returns the result of invoking `func` with it,
+        /// otherwise returns this' error. `func` must return an `expected` with the same error
+        /// type.
+        /// @param func The function to invoke with the value
+        /// @return The result of `func`, or this' error
+        template<typename TFunc>
+        constexpr auto and_then(TFunc&& func) & {
+            return and_then_impl(*this, std::forward<TFunc>(func));
+        }
+
+        template<typename TFunc>
+        constexpr auto and_then(TFunc&& func) const& {
+            return and_then_impl(*this, std::forward<TFunc>(func));
+        }
+
+        template<typename TFunc>
+        constexpr auto and_then(TFunc&& func) && {
+            return and_then_impl(std::move(*this), std::forward<TFunc>(func));
+        }
+
+        template<typename TFunc>
+        constexpr auto and_then(TFunc&& func) const&& {
+            return and_then_impl(std::move(*this), std::forward<TFunc>(func));
+        }
+
+        /// @brief If this holds an error, returns the result of invoking `func` with it,
+        /// otherwise returns this' value. `func` must return an `expected` with the same value
+        /// type.
+        /// @param func The function to invoke with the error
+        /// @return The result of `func`, or this' value
+        template<typename TFunc>
+        constexpr auto or_else(TFunc&& func) & {
+            return or_else_impl(*this, std::forward<TFunc>(func));
+        }
+
+        template<typename TFunc>
+        constexpr auto or_else(TFunc&& func) const& {
+            return or_else_impl(*this, std::forward<TFunc>(func));
+        }
+
+        template<typename TFunc>
+        constexpr auto or_else(TFunc&& func) && {
+            return or_else_impl(std::move(*this), std::forward<TFunc>(func));
+        }
+
+        template<typename TFunc>
+        constexpr auto or_else(TFunc&& func) const&& {
+            return or_else_impl(std::move(*this), std::forward<TFunc>(func));
+        }
+
+        /// @brief If this holds a value, returns an `expected` holding the result of invoking
+        /// `func` with it, otherwise returns this' error
+        /// @param func The function to invoke with the value
+        /// @return The result of `func`, or this' error
+        template<typename TFunc>
+        constexpr auto transform(TFunc&& func) & {
+            return transform_impl(*this, std::forward<TFunc>(func));
+        }
+
+        template<typename TFunc>
+        constexpr auto transform(TFunc&& func) const& {
+            return transform_impl(*this, std::forward<TFunc>(func));
+        }
+
+        template<typename TFunc>
+        constexpr auto transform(TFunc&& func) && {
+            return transform_impl(std::move(*this), std::forward<TFunc>(func));
+        }
+
+        template<typename TFunc>
+        constexpr auto transform(TFunc&& func) const&& {
+            return transform_impl(std::move(*this), std::forward<TFunc>(func));
+        }
+
+        /// @brief If this holds an error, returns an `expected` holding the result of invoking
+        /// `func` with it as its error, otherwise returns this' value
+        /// @param func The function to invoke with the error
+        /// @return This' value, or the result of `func`
+        template<typename TFunc>
+        constexpr auto transform_error(TFunc&& func) & {
+            return transform_error_impl(*this, std::forward<TFunc>(func));
+        }
+
+        template<typename TFunc>
+        constexpr auto transform_error(TFunc&& func) const& {
+            return transform_error_impl(*this, std::forward<TFunc>(func));
+        }
+
+        template<typename TFunc>
+        constexpr auto transform_error(TFunc&& func) && {
+            return transform_error_impl(std::move(*this), std::forward<TFunc>(func));
+        }
+
+        template<typename TFunc>
+        constexpr auto transform_error(TFunc&& func) const&& {
+            return transform_error_impl(std::move(*this), std::forward<TFunc>(func));
+        }
+
+        template<typename TOtherValue, typename TOtherError>
+            requires(std::is_void_v<TValue> == std::is_void_v<TOtherValue>)
+        friend constexpr auto
+        operator==(const expected& lhs, const expected<TOtherValue, TOtherError>& rhs) -> bool {
+            if(lhs.has_value() != rhs.has_value()) {
+                return false;
+            }
+
+            if(lhs.has_value()) {
+                if constexpr(std::is_void_v<TValue>) {
+                    return true;
+                }
+                else {
+                    return *lhs == *rhs;
+                }
+            }
+
+            return lhs.error() == rhs.error();
+        }
+
+        template<typename TOther>
+            requires(!std::is_void_v<TValue>)
+                    && (!detail::expected::is_expected<TOther>::value)
+                    && (!detail::expected::is_unexpected<TOther>::value)
+        friend constexpr auto operator==(const expected& lhs, const TOther& rhs) -> bool {
+            return lhs.has_value() && *lhs == rhs;
+        }
+
+        template<typename TOther>
+        friend constexpr auto
+        operator==(const expected& lhs, const unexpected<TOther>& rhs) -> bool {
+            return !lhs.has_value() && lhs.error() == rhs.error();
+        }
+
+      private:
+        storage_type m_storage;
+
+        template<typename TSelf>
+        constexpr auto construct_from(TSelf&& other) -> void {
+            if(other.has_value()) {
+                m_storage.construct_value(detail::expected::like<TSelf>(other.m_storage.value()));
+            }
+            else {
+                m_storage.construct_error(detail::expected::like<TSelf>(other.m_storage.error()));
+            }
+        }
+
+        template<typename TSelf>
+        constexpr auto assign_from(TSelf&& other) -> void {
+            using detail::expected::like;
+
+            if(has_value() && other.has_value()) {
+                m_storage.value() = like<TSelf>(other.m_storage.value());
+            }
+            else if(!has_value() && !other.has_value()) {
+                m_storage.error() = like<TSelf>(other.m_storage.error());
+            }
+            else if(other.has_value()) {
+                // construct the new value before destroying the error, so that a throwing
+                // construction leaves this unchanged
+                auto value = stored_value(like<TSelf>(other.m_storage.value()));
+                m_storage.destroy();
+                m_storage.construct_value(std::move(value));
+            }
+            else {
+                auto error = TError(like<TSelf>(other.m_storage.error()));
+                m_storage.destroy();
+                m_storage.construct_error(std::move(error));
+            }
+        }
+
+        /// @brief Invokes `func` with `self`'s value, or with no arguments for `expected<void, E>`
+        template<typename TSelf, typename TFunc>
+        static constexpr auto invoke_with_value(TSelf&& self, TFunc&& func) -> decltype(auto) {
+            if constexpr(std::is_void_v<TValue>) {
+                return std::invoke(std::forward<TFunc>(func));
+            }
+            else {
+                return std::invoke(std::forward<TFunc>(func),
+                                   detail::expected::like<TSelf>(self.m_storage.value()));
+            }
+        }
+
+        template<typename TSelf, typename TFunc>
+        static constexpr auto and_then_impl(TSelf&& self, TFunc&& func) {
+            using result = std::remove_cvref_t<decltype(invoke_with_value(
+                std::forward<TSelf>(self),
+                std::forward<TFunc>(func)))>;
+            static_assert(detail::expected::is_expected<result>::value,
+                          "The function passed to and_then must return an expected");
+            static_assert(std::same_as<typename result::error_type, TError>,
+                          "The function passed to and_then must return an expected with the "
+                          "same error type");
+
+            if(self.has_value()) [[likely]] {
+                return invoke_with_value(std::forward<TSelf>(self), std::forward<TFunc>(func));
+            }
+            return result(unexpect, detail::expected::like<TSelf>(self.m_storage.error()));
+        }
+
+        template<typename TSelf, typename TFunc>
+        static constexpr auto or_else_impl(TSelf&& self, TFunc&& func) {
+            using result = std::remove_cvref_t<std::invoke_result_t<
+                TFunc,
+                decltype(detail::expected::like<TSelf>(self.m_storage.error()))>>;
+            static_assert(detail::expected::is_expected<result>::value,
+                          "The function passed to or_else must return an expected");
+            static_assert(std::same_as<typename result::value_type, TValue>,
+                          "The function passed to or_else must return an expected with the "
+                          "same value type");
+
+            if(self.has_value()) [[likely]] {
+                return result(std::in_place,
+                              detail::expected::like<TSelf>(self.m_storage.value()));
+            }
+            return std::invoke(std::forward<TFunc>(func),
+                               detail::expected::like<TSelf>(self.m_storage.error()));
+        }
+
+        template<typename TSelf, typename TFunc>
+        static constexpr auto transform_impl(TSelf&& self, TFunc&& func) {
+            using value = std::remove_cv_t<decltype(invoke_with_value(
+                std::forward<TSelf>(self),
+                std::forward<TFunc>(func)))>;
+            using result = expected<value, TError>;
+
+            if(self.has_value()) [[likely]] {
+                if constexpr(std::is_void_v<value>) {
+                    invoke_with_value(std::forward<TSelf>(self), std::forward<TFunc>(func));
+                    return result();
+                }
+                else {
+                    return result(
+                        std::in_place,
+                        invoke_with_value(std::forward<TSelf>(self), std::forward<TFunc>(func)));
+                }
+            }
+            return result(unexpect, detail::expected::like<TSelf>(self.m_storage.error()));
+        }
+
+        template<typename TSelf, typename TFunc>
+        static constexpr auto transform_error_impl(TSelf&& self, TFunc&& func) {
+            using error = std::remove_cv_t<std::invoke_result_t<
+                TFunc,
+                decltype(detail::expected::like<TSelf>(self.m_storage.error()))>>;
+            using result = expected<TValue, error>;
+
+            if(self.has_value()) [[likely]] {
+                return result(std::in_place,
+                              detail::expected::like<TSelf>(self.m_storage.value()));
+            }
+            return result(unexpect,
+                          std::invoke(std::forward<TFunc>(func),
+                                      detail::expected::like<TSelf>(self.m_storage.error())));
+        }
+
+        template<typename TOtherValue, typename TOtherError>
+        friend class expected;
+    };
+
+    HYPERION_IGNORE_IGNORED_ATTRIBUTES_WARNING_STOP;
+
+} // namespace hyperion
+
+#if defined(HYPERION_ENABLE_TESTING) && HYPERION_ENABLE_TESTING
+
+    #include <boost/ut.hpp>
+
+    #include <string>
+
+namespace hyperion::_test::platform::expected {
+    enum class parse_error : u8 {
+        None = 0,
+        Empty,
+        InvalidDigit
+    };
+} // namespace hyperion::_test::platform::expected
+
+template<>
+struct hyperion::error_niche<hyperion::_test::platform::expected::parse_error> {
+    static constexpr auto value = hyperion::_test::platform::expected::parse_error::None;
+};
+
+namespace hyperion::_test::platform::expected {
+
+    // NOLINTNEXTLINE(google-build-using-namespace)
+    using namespace boost::ut;
+
+    template<typename TValue, typename TError>
+    using expected_t = hyperion::expected<TValue, TError>;
+
+    // trivial members make for a trivially copyable, register-passable result
+    static_assert(std::is_trivially_copyable_v<expected_t<u64, u32>>);
+    static_assert(std::is_trivially_copyable_v<expected_t<void, parse_error>>);
+    static_assert(std::is_trivially_destructible_v<expected_t<u32, const char*>>);
+    static_assert(!std::is_trivially_copyable_v<expected_t<std::string, u32>>);
+
+    // niches replace the discriminant flag of `expected<void, E>`
+    static_assert(sizeof(expected_t<void, parse_error>) == sizeof(parse_error));
+    static_assert(sizeof(expected_t<void, parse_error>) < sizeof(expected_t<void, u8>));
+    static_assert(sizeof(expected_t<void, const char*>) == sizeof(const char*));
+    static_assert(sizeof(expected_t<u64, u32>) == 2 * sizeof(u64));
+
+    [[nodiscard]] constexpr auto parse_digit(char digit) -> expected_t<u32, parse_error> {
+        if(digit == '\0') [[unlikely]] {
+            return unexpected{parse_error::Empty};
+        }
+        if(digit < '0' || digit > '9') [[unlikely]] {
+            return unexpected{parse_error::InvalidDigit};
+        }
+        return static_cast<u32>(digit - '0');
+    }
+
+    static_assert(parse_digit('7').value() == 7_u32);
+    static_assert(parse_digit('x').error() == parse_error::InvalidDigit);
+    static_assert(parse_digit('4').transform([](u32 value) { return value * 2_u32; }) == 8_u32);
+
+    // NOLINTNEXTLINE(cert-err58-cpp)
+    static const suite<"hyperion::platform::expected"> expected_tests = [] {
+        "observers"_test = [] {
+            const auto value = parse_digit('3');
+            expect(that % value.has_value());
+            expect(that % static_cast<bool>(value));
+            expect(that % *value == 3_u32);
+            expect(that % value.value_or(9_u32) == 3_u32);
+            expect(value.error_or(parse_error::Empty) == parse_error::Empty);
+
+            const auto error = parse_digit('\0');
+            expect(that % !error.has_value());
+            expect(error.error() == parse_error::Empty);
+            expect(that % error.value_or(9_u32) == 9_u32);
+            expect(error == unexpected{parse_error::Empty});
+            expect(error != value);
+        };
+
+        "monadic"_test = [] {
+            const auto add_one
+                = [](u32 value) -> expected_t<u32, parse_error> { return value + 1_u32; };
+            const auto fail = [](u32) -> expected_t<u32, parse_error> {
+                return unexpected{parse_error::Empty};
+            };
+
+            expect(parse_digit('1').and_then(add_one) == 2_u32);
+            expect(parse_digit('1').and_then(fail).error() == parse_error::Empty);
+            expect(parse_digit('a').and_then(add_one).error() == parse_error::InvalidDigit);
+
+            const auto recover = [](parse_error) -> expected_t<u32, parse_error> { return 0_u32; };
+            expect(parse_digit('a').or_else(recover) == 0_u32);
+            expect(parse_digit('5').or_else(recover) == 5_u32);
+
+            const auto text = parse_digit('a').transform_error([](parse_error error) {
+                return error == parse_error::InvalidDigit ? std::string{"invalid"}
+                                                          : std::string{"other"};
+            });
+            expect(text.error() == "invalid");
+
+            auto calls = 0;
+            const auto unit = parse_digit('2').transform([&calls](u32) { ++calls; });
+            expect(that % unit.has_value());
+            expect(that % calls == 1);
+        };
+
+        "void_and_niches"_test = [] {
+            auto ok = expected_t<void, const char*>{};
+            expect(that % ok.has_value());
+            ok = unexpected{"failed"};
+            expect(that % !ok.has_value());
+            expect(std::string_view{ok.error()} == "failed");
+
+            auto called = false;
+            const auto next = expected_t<void, parse_error>{}.and_then(
+                [&called]() -> expected_t<void, parse_error> {
+                    called = true;
+                    return unexpected{parse_error::InvalidDigit};
+                });
+            expect(that % called);
+            expect(next.error() == parse_error::InvalidDigit);
+        };
+
+        "non_trivial_members"_test = [] {
+            auto value = expected_t<std::string, std::string>{std::in_place, 32_usize, 'x'};
+            auto error = expected_t<std::string, std::string>{unexpect, "error"};
+
+            auto copy = value;
+            expect(that % copy.has_value());
+            expect(*copy == std::string(32_usize, 'x'));
+
+            copy = error;
+            expect(that % !copy.has_value());
+            expect(copy.error() == "error");
+
+            copy = std::move(value);
+            expect(that % copy.has_value());
+            expect(that % copy->size() == 32_usize);
+
+            const auto moved = std::move(error);
+            expect(moved.error() == "error");
+
+            const auto length = std::move(copy).transform(
+                [](std::string&& inner) { return inner.size(); });
+            expect(length == 32_usize);
+        };
+    };
+
+} // namespace hyperion::_test::platform::expected
+
+#endif // defined(HYPERION_ENABLE_TESTING) && HYPERION_ENABLE_TESTING
+
+#endif // HYPERION_PLATFORM_EXPECTED_H
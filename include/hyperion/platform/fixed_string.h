@@ -0,0 +1,144 @@
+/// @file fixed_string.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief A fixed-size string usable as a non-type template parameter
+/// @version 0.4.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2024 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef HYPERION_PLATFORM_FIXED_STRING_H
+#define HYPERION_PLATFORM_FIXED_STRING_H
+
+#include <hyperion/platform.h>
+#include <hyperion/platform/types.h>
+
+#include <algorithm>
+#include <array>
+#include <string_view>
+
+/// @ingroup platform
+/// @{
+///	@defgroup fixed_string Fixed String
+/// `hyperion::fixed_string<N>` holds a string literal by value. It is a structural type, so it
+/// can be used as a non-type template parameter, allowing strings to be passed to templates
+/// and processed at compile time.
+///
+/// # Example
+/// @code {.cpp}
+/// template<hyperion::fixed_string TName>
+/// struct metric {
+///     static constexpr auto name = TName.view();
+/// };
+///
+/// using requests = metric<"http.requests">;
+/// static_assert(requests::name == "http.requests");
+/// @endcode
+/// @headerfile hyperion/platform/fixed_string.h
+/// @}
+
+namespace hyperion {
+
+    /// @brief A string literal held by value, usable as a non-type template parameter
+    ///
+    /// @tparam TSize The size of the literal, including its null terminator
+    /// @ingroup fixed_string
+    /// @headerfile hyperion/platform/fixed_string.h
+    template<usize TSize>
+        requires(TSize != 0)
+    struct fixed_string {
+        /// @brief The characters of the string, including the null terminator.
+        /// Public only so that `fixed_string` is a structural type
+        std::array<char, TSize> m_data{};
+
+        /// @brief Constructs a `fixed_string` from a string literal
+        /// @param literal The string literal
+        // NOLINTNEXTLINE(*-avoid-c-arrays, google-explicit-constructor, hicpp-explicit-conversions)
+        constexpr fixed_string(const char (&literal)[TSize]) noexcept {
+            std::copy_n(literal, TSize, m_data.begin());
+        }
+
+        /// @brief Returns the length of the string, excluding the null terminator
+        /// @return The length of the string
+        [[nodiscard]] constexpr auto size() const noexcept -> usize {
+            return TSize - 1_usize;
+        }
+
+        /// @brief Returns a pointer to the null-terminated string
+        /// @return The string
+        [[nodiscard]] constexpr auto data() const noexcept -> const char* {
+            return m_data.data();
+        }
+
+        /// @brief Returns a view of the string, excluding the null terminator
+        /// @return A view of the string
+        [[nodiscard]] constexpr auto view() const noexcept -> std::string_view {
+            return {m_data.data(), size()};
+        }
+
+        // NOLINTNEXTLINE(google-explicit-constructor, hicpp-explicit-conversions)
+        [[nodiscard]] constexpr operator std::string_view() const noexcept {
+            return view();
+        }
+
+        template<usize TOtherSize>
+        [[nodiscard]] constexpr auto
+        operator==(const fixed_string<TOtherSize>& other) const noexcept -> bool {
+            return view() == other.view();
+        }
+    };
+
+} // namespace hyperion
+
+#if defined(HYPERION_ENABLE_TESTING) && HYPERION_ENABLE_TESTING
+
+    #include <boost/ut.hpp>
+
+namespace hyperion::_test::platform::fixed_string {
+
+    template<hyperion::fixed_string TString>
+    struct named {
+        static constexpr auto name = TString.view();
+    };
+
+    static_assert(named<"http.requests">::name == "http.requests");
+    static_assert(hyperion::fixed_string{"abc"}.size() == 3_usize);
+    static_assert(hyperion::fixed_string{""}.view().empty());
+    static_assert(hyperion::fixed_string{"abc"} == hyperion::fixed_string{"abc"});
+    static_assert(hyperion::fixed_string{"abc"} != hyperion::fixed_string{"abcd"});
+
+    // NOLINTNEXTLINE(google-build-using-namespace)
+    using namespace boost::ut;
+
+    // NOLINTNEXTLINE(cert-err58-cpp)
+    static const suite<"hyperion::platform::fixed_string"> fixed_string_tests = [] {
+        "view"_test = [] {
+            constexpr auto string = hyperion::fixed_string{"label"};
+            expect(that % string.view() == std::string_view{"label"});
+            expect(that % string.data()[string.size()] == '\0');
+        };
+    };
+
+} // namespace hyperion::_test::platform::fixed_string
+
+#endif // defined(HYPERION_ENABLE_TESTING) && HYPERION_ENABLE_TESTING
+
+#endif // HYPERION_PLATFORM_FIXED_STRING_H
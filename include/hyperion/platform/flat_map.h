@@ -0,0 +1,660 @@
+/// @file flat_map.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Sorted, contiguous associative containers with branchless lookup
+/// @version 0.4.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2024 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef HYPERION_PLATFORM_FLAT_MAP_H
+#define HYPERION_PLATFORM_FLAT_MAP_H
+
+#include <hyperion/platform.h>
+#include <hyperion/platform/assert.h>
+#include <hyperion/platform/compare.h>
+#include <hyperion/platform/def.h>
+#include <hyperion/platform/types.h>
+
+#include <algorithm>
+#include <concepts>
+#include <initializer_list>
+#include <numeric>
+#include <span>
+#include <utility>
+#include <vector>
+
+/// @ingroup platform
+/// @{
+///	@defgroup flat_map Flat Map and Set
+/// `hyperion::flat_map<K, V>` and `hyperion::flat_set<K>` are associative containers that keep
+/// their keys sorted in a contiguous array. `flat_map` stores its values in a second, parallel
+/// array (a struct-of-arrays layout), so lookups only touch the keys, and as many keys as
+/// possible share each cache line. Lookups use a branchless binary search, whose loop
+/// compiles to conditional moves instead of hard-to-predict branches.
+///
+/// They are intended for read-mostly tables: lookups are O(log n) with far better constant
+/// factors than node-based containers like `std::map`, but inserting or erasing a single
+/// element is O(n). Tables should instead be built in bulk, with the constructors taking a
+/// range of elements, which sort them and discard duplicate keys in O(n log n).
+///
+/// How keys are compared is controlled by a key policy. The default, `hyperion::exact_key`,
+/// uses `<` and `==`. `hyperion::tolerant_key` instead treats floating point keys within an
+/// epsilon of each other (see `hyperion/platform/compare.h`) as the same key, so that e.g. a
+/// lookup of `0.1 + 0.2` finds the entry for `0.3`.
+///
+/// # Example
+/// @code {.cpp}
+/// const auto status_names = hyperion::flat_map<u32, std::string_view>{
+///     {200, "OK"}, {404, "Not Found"}, {500, "Internal Server Error"}};
+///
+/// if(const auto* name = status_names.find(404)) {
+///     log(*name);
+/// }
+///
+/// using namespace hyperion::platform::compare;
+/// auto rates = hyperion::flat_map<f64, u32, hyperion::tolerant_key<f64>>{
+///     hyperion::tolerant_key<f64>{Epsilon<EpsilonType::Absolute, f64>{1e-9}}};
+/// rates.insert_or_assign(0.3, 1);
+/// const auto found = rates.contains(0.1 + 0.2); // true
+/// @endcode
+/// @headerfile hyperion/platform/flat_map.h
+/// @}
+
+namespace hyperion {
+
+    /// @brief Key policy comparing keys exactly, with `<` and `==`
+    /// @tparam TKey The key type
+    /// @ingroup flat_map
+    /// @headerfile hyperion/platform/flat_map.h
+    template<typename TKey>
+    struct exact_key {
+        [[nodiscard]] constexpr auto less(const TKey& lhs, const TKey& rhs) const noexcept
+            -> bool {
+            return lhs < rhs;
+        }
+
+        [[nodiscard]] constexpr auto equal(const TKey& lhs, const TKey& rhs) const noexcept
+            -> bool {
+            return lhs == rhs;
+        }
+    };
+
+    /// @brief Key policy for floating point keys, treating keys within an epsilon of each other
+    /// as equal
+    ///
+    /// Keys are ordered with `<`, and compared for equality with
+    /// `platform::compare::equality_compare` using the policy's epsilon. Keys inserted into a
+    /// container using this policy are never within the epsilon of each other.
+    ///
+    /// @tparam TKey The key type
+    /// @tparam TType Whether the epsilon is absolute or relative
+    /// @ingroup flat_map
+    /// @headerfile hyperion/platform/flat_map.h
+    template<std::floating_point TKey,
+             platform::compare::EpsilonType TType = platform::compare::EpsilonType::Absolute>
+    struct tolerant_key {
+        /// @brief The epsilon within which keys are considered equal
+        platform::compare::Epsilon<TType, TKey> epsilon{};
+
+        [[nodiscard]] constexpr auto less(const TKey& lhs, const TKey& rhs) const noexcept
+            -> bool {
+            return lhs < rhs;
+        }
+
+        [[nodiscard]] constexpr auto equal(const TKey& lhs, const TKey& rhs) const noexcept
+            -> bool {
+            return platform::compare::equality_compare(lhs, rhs, epsilon);
+        }
+    };
+
+    /// @brief Requirements of a key policy for `flat_map` and `flat_set`
+    /// @ingroup flat_map
+    /// @headerfile hyperion/platform/flat_map.h
+    template<typename TPolicy, typename TKey>
+    concept KeyPolicy = std::copy_constructible<TPolicy>
+                        && requires(const TPolicy& policy, const TKey& key) {
+                               { policy.less(key, key) } -> std::convertible_to<bool>;
+                               { policy.equal(key, key) } -> std::convertible_to<bool>;
+                           };
+
+    namespace detail::flat_map {
+        /// @brief Returns the index of the first of `keys` not less than `key`, with a binary
+        /// search whose loop body has no data-dependent branches
+        template<typename TKey, typename TPolicy>
+        [[nodiscard]] inline auto lower_bound(std::span<const TKey> keys,
+                                              const TKey& key,
+                                              const TPolicy& policy) noexcept -> usize {
+            if(keys.empty()) {
+                return 0_usize;
+            }
+
+            const auto* base = keys.data();
+            auto length = keys.size();
+            while(length > 1_usize) {
+                const auto half = length / 2_usize;
+                base = policy.less(base[half], key) ? base + half : base;
+                length -= half;
+            }
+            return static_cast<usize>(base - keys.data())
+                   + static_cast<usize>(policy.less(*base, key));
+        }
+
+        /// @brief Returns the index of the key equal to `key` under `policy`, or `keys.size()`
+        template<typename TKey, typename TPolicy>
+        [[nodiscard]] inline auto
+        find(std::span<const TKey> keys, const TKey& key, const TPolicy& policy) noexcept
+            -> usize {
+            const auto index = lower_bound(keys, key, policy);
+            if(index != keys.size() && policy.equal(keys[index], key)) {
+                return index;
+            }
+            // a tolerant policy may consider a slightly smaller key equal
+            if(index != 0_usize && policy.equal(keys[index - 1_usize], key)) {
+                return index - 1_usize;
+            }
+            return keys.size();
+        }
+
+        /// @brief Returns the order in which to visit `keys` so that they are sorted, keeping
+        /// only the first occurrence of each key
+        template<typename TKey, typename TPolicy>
+        [[nodiscard]] inline auto sorted_unique_order(std::span<const TKey> keys,
+                                                      const TPolicy& policy) -> std::vector<usize> {
+            auto order = std::vector<usize>(keys.size());
+            std::iota(order.begin(), order.end(), 0_usize);
+            std::stable_sort(order.begin(), order.end(), [&](usize lhs, usize rhs) {
+                return policy.less(keys[lhs], keys[rhs]);
+            });
+            const auto last
+                = std::unique(order.begin(), order.end(), [&](usize kept, usize candidate) {
+                      return policy.equal(keys[kept], keys[candidate]);
+                  });
+            order.erase(last, order.end());
+            return order;
+        }
+    } // namespace detail::flat_map
+
+    /// @brief A sorted associative container mapping unique keys to values, stored as two
+    /// contiguous, parallel arrays
+    ///
+    /// @tparam TKey The key type
+    /// @tparam TValue The value type
+    /// @tparam TPolicy The key policy, `exact_key<TKey>` by default
+    /// @ingroup flat_map
+    /// @headerfile hyperion/platform/flat_map.h
+    template<typename TKey, typename TValue, typename TPolicy = exact_key<TKey>>
+        requires KeyPolicy<TPolicy, TKey>
+    class flat_map {
+      public:
+        /// @brief The key type
+        using key_type = TKey;
+        /// @brief The value type
+        using mapped_type = TValue;
+
+        /// @brief Constructs an empty map
+        /// @param policy The key policy
+        constexpr explicit flat_map(TPolicy policy = TPolicy{}) noexcept(
+            std::is_nothrow_move_constructible_v<TPolicy>)
+            : m_policy{std::move(policy)} {
+        }
+
+        /// @brief Constructs a map from `elements` in O(n log n). If a key occurs more than
+        /// once, the first occurrence is kept
+        /// @param elements The elements of the map
+        /// @param policy The key policy
+        flat_map(std::initializer_list<std::pair<TKey, TValue>> elements,
+                 TPolicy policy = TPolicy{})
+            : m_policy{std::move(policy)} {
+            assign(elements);
+        }
+
+        /// @brief Constructs a map from the parallel arrays `keys` and `values` in
+        /// O(n log n). If a key occurs more than once, the first occurrence is kept
+        /// @param keys The keys of the map
+        /// @param values The values of the map
+        /// @param policy The key policy
+        /// @pre `keys.size() == values.size()`
+        flat_map(std::vector<TKey> keys, std::vector<TValue> values, TPolicy policy = TPolicy{})
+            : m_policy{std::move(policy)} {
+            HYPERION_ASSERT(keys.size() == values.size(),
+                            "flat_map requires the same number of keys and values");
+            const auto order
+                = detail::flat_map::sorted_unique_order(std::span<const TKey>{keys}, m_policy);
+            m_keys.reserve(order.size());
+            m_values.reserve(order.size());
+            for(const auto index : order) {
+                m_keys.push_back(std::move(keys[index]));
+                m_values.push_back(std::move(values[index]));
+            }
+        }
+
+        /// @brief Replaces the contents of the map with `elements` in O(n log n). If a key
+        /// occurs more than once, the first occurrence is kept
+        /// @param elements The new elements of the map
+        template<typename TRange>
+            requires requires(const TRange& range) {
+                { std::begin(range)->first } -> std::convertible_to<const TKey&>;
+                { std::begin(range)->second } -> std::convertible_to<const TValue&>;
+            }
+        auto assign(const TRange& elements) -> void {
+            // values are copied in the same pass as the keys, so that `elements` is only
+            // traversed once, and needn't be random access
+            auto keys = std::vector<TKey>{};
+            auto values = std::vector<TValue>{};
+            for(const auto& element : elements) {
+                keys.push_back(element.first);
+                values.push_back(element.second);
+            }
+            const auto order
+                = detail::flat_map::sorted_unique_order(std::span<const TKey>{keys}, m_policy);
+
+            m_keys.clear();
+            m_values.clear();
+            m_keys.reserve(order.size());
+            m_values.reserve(order.size());
+            for(const auto index : order) {
+                m_keys.push_back(std::move(keys[index]));
+                m_values.push_back(std::move(values[index]));
+            }
+        }
+
+        /// @brief Returns a pointer to the value for `key`, or `nullptr` if there is none
+        /// @param key The key to look up
+        /// @return The value for `key`, or `nullptr`
+        [[nodiscard]] auto find(const TKey& key) noexcept -> TValue* {
+            const auto index = detail::flat_map::find(keys(), key, m_policy);
+            return index == m_keys.size() ? nullptr : &m_values[index];
+        }
+
+        /// @brief Returns a pointer to the value for `key`, or `nullptr` if there is none
+        /// @param key The key to look up
+        /// @return The value for `key`, or `nullptr`
+        [[nodiscard]] auto find(const TKey& key) const noexcept -> const TValue* {
+            const auto index = detail::flat_map::find(keys(), key, m_policy);
+            return index == m_keys.size() ? nullptr : &m_values[index];
+        }
+
+        /// @brief Returns whether the map contains `key`
+        /// @param key The key to look up
+        /// @return Whether the map contains `key`
+        [[nodiscard]] auto contains(const TKey& key) const noexcept -> bool {
+            return find(key) != nullptr;
+        }
+
+        /// @brief Returns the value for `key`
+        /// @param key The key to look up
+        /// @return The value for `key`
+        /// @pre `contains(key)`
+        [[nodiscard]] auto at(const TKey& key) noexcept -> TValue& {
+            auto* value = find(key);
+            HYPERION_DEBUG_ASSERT(value != nullptr, "flat_map::at called with a missing key");
+            return *value;
+        }
+
+        /// @brief Returns the value for `key`
+        /// @param key The key to look up
+        /// @return The value for `key`
+        /// @pre `contains(key)`
+        [[nodiscard]] auto at(const TKey& key) const noexcept -> const TValue& {
+            const auto* value = find(key);
+            HYPERION_DEBUG_ASSERT(value != nullptr, "flat_map::at called with a missing key");
+            return *value;
+        }
+
+        /// @brief Inserts `value` for `key`, or assigns it to the existing value for `key`.
+        /// O(n) when inserting
+        /// @param key The key
+        /// @param value The value
+        /// @return Whether `key` was newly inserted
+        template<typename TArg>
+            requires std::assignable_from<TValue&, TArg&&>
+                     && std::constructible_from<TValue, TArg&&>
+        auto insert_or_assign(const TKey& key, TArg&& value) -> bool {
+            const auto index = detail::flat_map::find(keys(), key, m_policy);
+            if(index != m_keys.size()) {
+                m_values[index] = std::forward<TArg>(value);
+                return false;
+            }
+
+            const auto position
+                = static_cast<std::ptrdiff_t>(detail::flat_map::lower_bound(keys(), key, m_policy));
+            m_keys.insert(m_keys.begin() + position, key);
+            m_values.insert(m_values.begin() + position, std::forward<TArg>(value));
+            return true;
+        }
+
+        /// @brief Erases the entry for `key`, if there is one. O(n)
+        /// @param key The key to erase
+        /// @return Whether an entry was erased
+        auto erase(const TKey& key) -> bool {
+            const auto index = detail::flat_map::find(keys(), key, m_policy);
+            if(index == m_keys.size()) {
+                return false;
+            }
+            m_keys.erase(m_keys.begin() + static_cast<std::ptrdiff_t>(index));
+            m_values.erase(m_values.begin() + static_cast<std::ptrdiff_t>(index));
+            return true;
+        }
+
+        /// @brief Returns the sorted keys
+        /// @return The keys
+        [[nodiscard]] auto keys() const noexcept -> std::span<const TKey> {
+            return m_keys;
+        }
+
+        /// @brief Returns the values, in the order of their keys in `keys()`
+        /// @return The values
+        [[nodiscard]] auto values() noexcept -> std::span<TValue> {
+            return m_values;
+        }
+
+        /// @brief Returns the values, in the order of their keys in `keys()`
+        /// @return The values
+        [[nodiscard]] auto values() const noexcept -> std::span<const TValue> {
+            return m_values;
+        }
+
+        /// @brief Invokes `callback` with each key and its value, in key order
+        /// @param callback The callback to invoke
+        template<typename TCallback>
+            requires std::invocable<TCallback&, const TKey&, TValue&>
+        auto for_each(TCallback&& callback) -> void {
+            for(auto index = 0_usize; index < m_keys.size(); ++index) {
+                callback(m_keys[index], m_values[index]);
+            }
+        }
+
+        /// @brief Invokes `callback` with each key and its value, in key order
+        /// @param callback The callback to invoke
+        template<typename TCallback>
+            requires std::invocable<TCallback&, const TKey&, const TValue&>
+        auto for_each(TCallback&& callback) const -> void {
+            for(auto index = 0_usize; index < m_keys.size(); ++index) {
+                callback(m_keys[index], m_values[index]);
+            }
+        }
+
+        /// @brief Returns the number of entries
+        /// @return The number of entries
+        [[nodiscard]] auto size() const noexcept -> usize {
+            return m_keys.size();
+        }
+
+        /// @brief Returns whether the map is empty
+        /// @return Whether the map is empty
+        [[nodiscard]] auto empty() const noexcept -> bool {
+            return m_keys.empty();
+        }
+
+        /// @brief Reserves storage for `capacity` entries
+        /// @param capacity The number of entries to reserve storage for
+        auto reserve(usize capacity) -> void {
+            m_keys.reserve(capacity);
+            m_values.reserve(capacity);
+        }
+
+        /// @brief Erases every entry
+        auto clear() noexcept -> void {
+            m_keys.clear();
+            m_values.clear();
+        }
+
+      private:
+        std::vector<TKey> m_keys;
+        std::vector<TValue> m_values;
+        [[HYPERION_NO_UNIQUE_ADDRESS]] TPolicy m_policy;
+    };
+
+    /// @brief A sorted set of unique keys, stored as a contiguous array
+    ///
+    /// @tparam TKey The key type
+    /// @tparam TPolicy The key policy, `exact_key<TKey>` by default
+    /// @ingroup flat_map
+    /// @headerfile hyperion/platform/flat_map.h
+    template<typename TKey, typename TPolicy = exact_key<TKey>>
+        requires KeyPolicy<TPolicy, TKey>
+    class flat_set {
+      public:
+        /// @brief The key type
+        using key_type = TKey;
+        /// @brief The iterator over the keys
+        using const_iterator = typename std::vector<TKey>::const_iterator;
+
+        /// @brief Constructs an empty set
+        /// @param policy The key policy
+        constexpr explicit flat_set(TPolicy policy = TPolicy{}) noexcept(
+            std::is_nothrow_move_constructible_v<TPolicy>)
+            : m_policy{std::move(policy)} {
+        }
+
+        /// @brief Constructs a set from `keys` in O(n log n), discarding duplicates
+        /// @param keys The keys of the set
+        /// @param policy The key policy
+        flat_set(std::initializer_list<TKey> keys, TPolicy policy = TPolicy{})
+            : flat_set{std::vector<TKey>{keys}, std::move(policy)} {
+        }
+
+        /// @brief Constructs a set from `keys` in O(n log n), discarding duplicates
+        /// @param keys The keys of the set
+        /// @param policy The key policy
+        explicit flat_set(std::vector<TKey> keys, TPolicy policy = TPolicy{})
+            : m_keys{std::move(keys)}, m_policy{std::move(policy)} {
+            const auto less = [this](const TKey& lhs, const TKey& rhs) {
+                return m_policy.less(lhs, rhs);
+            };
+            const auto equal = [this](const TKey& kept, const TKey& next) {
+                return m_policy.equal(kept, next);
+            };
+            std::stable_sort(m_keys.begin(), m_keys.end(), less);
+            m_keys.erase(std::unique(m_keys.begin(), m_keys.end(), equal), m_keys.end());
+        }
+
+        /// @brief Returns whether the set contains `key`
+        /// @param key The key to look up
+        /// @return Whether the set contains `key`
+        [[nodiscard]] auto contains(const TKey& key) const noexcept -> bool {
+            return detail::flat_map::find(keys(), key, m_policy) != m_keys.size();
+        }
+
+        /// @brief Inserts `key`, if the set does not already contain it. O(n)
+        /// @param key The key to insert
+        /// @return Whether `key` was inserted
+        auto insert(const TKey& key) -> bool {
+            if(contains(key)) {
+                return false;
+            }
+            const auto position
+                = static_cast<std::ptrdiff_t>(detail::flat_map::lower_bound(keys(), key, m_policy));
+            m_keys.insert(m_keys.begin() + position, key);
+            return true;
+        }
+
+        /// @brief Erases `key`, if the set contains it. O(n)
+        /// @param key The key to erase
+        /// @return Whether `key` was erased
+        auto erase(const TKey& key) -> bool {
+            const auto index = detail::flat_map::find(keys(), key, m_policy);
+            if(index == m_keys.size()) {
+                return false;
+            }
+            m_keys.erase(m_keys.begin() + static_cast<std::ptrdiff_t>(index));
+            return true;
+        }
+
+        /// @brief Returns the sorted keys
+        /// @return The keys
+        [[nodiscard]] auto keys() const noexcept -> std::span<const TKey> {
+            return m_keys;
+        }
+
+        [[nodiscard]] auto begin() const noexcept -> const_iterator {
+            return m_keys.begin();
+        }
+
+        [[nodiscard]] auto end() const noexcept -> const_iterator {
+            return m_keys.end();
+        }
+
+        /// @brief Returns the number of keys
+        /// @return The number of keys
+        [[nodiscard]] auto size() const noexcept -> usize {
+            return m_keys.size();
+        }
+
+        /// @brief Returns whether the set is empty
+        /// @return Whether the set is empty
+        [[nodiscard]] auto empty() const noexcept -> bool {
+            return m_keys.empty();
+        }
+
+        /// @brief Reserves storage for `capacity` keys
+        /// @param capacity The number of keys to reserve storage for
+        auto reserve(usize capacity) -> void {
+            m_keys.reserve(capacity);
+        }
+
+        /// @brief Erases every key
+        auto clear() noexcept -> void {
+            m_keys.clear();
+        }
+
+      private:
+        std::vector<TKey> m_keys;
+        [[HYPERION_NO_UNIQUE_ADDRESS]] TPolicy m_policy;
+    };
+
+} // namespace hyperion
+
+#if defined(HYPERION_ENABLE_TESTING) && HYPERION_ENABLE_TESTING
+
+    #include <boost/ut.hpp>
+    #include <hyperion/platform/ignore.h>
+
+    #include <map>
+    #include <random>
+    #include <string>
+
+namespace hyperion::_test::platform::flat_map {
+
+    // NOLINTNEXTLINE(google-build-using-namespace)
+    using namespace boost::ut;
+
+    // NOLINTNEXTLINE(cert-err58-cpp)
+    static const suite<"hyperion::platform::flat_map"> flat_map_tests = [] {
+        "lower_bound"_test = [] {
+            const auto keys = std::vector<i32>{1, 3, 3, 5, 9};
+            const auto policy = exact_key<i32>{};
+            auto matches = true;
+            for(auto key = -1; key < 11; ++key) {
+                const auto expected_index = static_cast<usize>(
+                    std::lower_bound(keys.begin(), keys.end(), key) - keys.begin());
+                matches = matches
+                          && detail::flat_map::lower_bound(std::span<const i32>{keys}, key, policy)
+                                 == expected_index;
+            }
+            expect(that % matches);
+            expect(that % detail::flat_map::lower_bound(std::span<const i32>{}, 1, policy)
+                   == 0_usize);
+        };
+
+        "bulk_construction"_test = [] {
+            const auto map = hyperion::flat_map<i32, std::string>{{5, "five"},
+                                                                  {1, "one"},
+                                                                  {3, "three"},
+                                                                  {1, "uno"}};
+            expect(that % map.size() == 3_usize);
+            expect(std::is_sorted(map.keys().begin(), map.keys().end()));
+            // the first occurrence of a duplicate key wins
+            expect(map.at(1) == "one");
+            expect(map.at(5) == "five");
+            expect(map.find(2) == nullptr);
+
+            const auto soa = hyperion::flat_map<i32, i32>{{4, 2, 4, 0}, {40, 20, 41, 0}};
+            expect(that % soa.size() == 3_usize);
+            expect(that % soa.at(4) == 40);
+            expect(that % soa.values()[0] == 0);
+
+            auto assigned = hyperion::flat_map<i32, std::string>{};
+            assigned.assign(std::map<i32, std::string>{{2, "two"}, {0, "zero"}, {1, "one"}});
+            expect(that % assigned.size() == 3_usize);
+            expect(assigned.at(0) == "zero");
+            expect(assigned.at(2) == "two");
+        };
+
+        "insert_erase_match_std_map"_test = [] {
+            auto map = hyperion::flat_map<u32, u32>{};
+            auto reference = std::map<u32, u32>{};
+            auto random = std::mt19937{3U}; // NOLINT(cert-msc32-c, cert-msc51-cpp)
+            auto matches = true;
+            for(auto step = 0U; step < 5'000U; ++step) {
+                const auto key = static_cast<u32>(random() % 512U);
+                if(random() % 3U == 0U) {
+                    matches = matches && map.erase(key) == (reference.erase(key) == 1_usize);
+                }
+                else {
+                    const auto inserted = reference.insert_or_assign(key, step).second;
+                    matches = matches && map.insert_or_assign(key, step) == inserted;
+                }
+            }
+            expect(that % map.size() == reference.size());
+            for(const auto& [key, value] : reference) {
+                matches = matches && map.contains(key) && map.at(key) == value;
+            }
+            expect(that % matches);
+        };
+
+        "tolerant_keys"_test = [] {
+            using namespace hyperion::platform::compare; // NOLINT(google-build-using-namespace)
+            const auto policy = tolerant_key<f64>{Epsilon<EpsilonType::Absolute, f64>{1e-9}};
+
+            auto map = hyperion::flat_map<f64, i32, tolerant_key<f64>>{policy};
+            expect(that % map.insert_or_assign(0.3, 1));
+            expect(that % map.contains(0.1 + 0.2));
+            expect(that % !map.insert_or_assign(0.1 + 0.2, 2));
+            expect(that % map.size() == 1_usize);
+            expect(that % map.at(0.3) == 2);
+            expect(that % !map.contains(0.3001));
+
+            const auto set = hyperion::flat_set<f64, tolerant_key<f64>>{{0.3, 0.1 + 0.2, 0.7},
+                                                                         policy};
+            expect(that % set.size() == 2_usize);
+            expect(that % set.contains(0.7 + 1e-12));
+        };
+
+        "flat_set"_test = [] {
+            auto set = hyperion::flat_set<i32>{9, 1, 5, 1, 3};
+            expect(that % set.size() == 4_usize);
+            expect(std::is_sorted(set.begin(), set.end()));
+            expect(that % set.contains(5));
+            expect(that % !set.insert(5));
+            expect(that % set.insert(4));
+            expect(that % set.erase(1));
+            expect(that % !set.contains(1));
+            expect(that % set.keys().front() == 3);
+        };
+    };
+
+} // namespace hyperion::_test::platform::flat_map
+
+#endif // defined(HYPERION_ENABLE_TESTING) && HYPERION_ENABLE_TESTING
+
+#endif // HYPERION_PLATFORM_FLAT_MAP_H
@@ -0,0 +1,955 @@
+/// @file flight_recorder.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief An always-on, in-memory profiling backend that dumps the recent past on demand
+/// @version 0.4.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2024 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+#ifndef HYPERION_PLATFORM_FLIGHT_RECORDER_H
+#define HYPERION_PLATFORM_FLIGHT_RECORDER_H
+
+// this header is included by def.h when the flight recorder backs the profiling macros, so it
+// can only depend on headers that def.h itself may include, and uses the standard fixed-width
+// integer types rather than those of types.h
+#include <hyperion/platform.h>
+#include <hyperion/platform/def.h>
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <new>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if HYPERION_PLATFORM_IS_UNIX
+    #include <cerrno>
+    #include <csignal>
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif // HYPERION_PLATFORM_IS_UNIX
+
+/// @ingroup platform
+/// @{
+///	@defgroup flight_recorder Profiling Flight Recorder
+/// The flight recorder is an in-process profiling backend that continuously records zone,
+/// frame and plot events into fixed-size, per-thread ring buffers, and writes out the most
+/// recent events as a trace file only when asked to. In steady state it performs no I/O and no
+/// allocation, and recording a zone costs two clock reads and a handful of stores into
+/// thread-local memory, so it can be left enabled on production hosts where no profiler client
+/// is connected, to capture the seconds leading up to an incident. Threads should call
+/// `hyperion::platform::flight_recorder::register_thread` when they start, to acquire their
+/// ring up front rather than on their first event.
+///
+/// A trace can be dumped:
+/// - on demand, by calling `hyperion::platform::flight_recorder::dump`.
+/// - when the process receives a signal, after calling
+/// `hyperion::platform::flight_recorder::install_signal_trigger`.
+/// - when any zone takes longer than a latency threshold, after calling
+/// `hyperion::platform::flight_recorder::set_latency_threshold`.
+///
+/// Signal and latency triggered dumps are written by a background thread started with
+/// `hyperion::platform::flight_recorder::start_dump_thread`, so the thread observing the
+/// trigger never blocks on I/O. Triggers are ignored while a triggered dump is in progress, and
+/// are only supported on Unix platforms.
+///
+/// Dumps contain the events of the last `hyperion::platform::flight_recorder::window`
+/// (10 seconds by default) still held in the ring buffers, in the Chrome trace event JSON
+/// format understood by Perfetto and `chrome://tracing`. Each thread's ring holds the last
+/// `HYPERION_FLIGHT_RECORDER_EVENTS_PER_THREAD` events.
+///
+/// Building with `HYPERION_ENABLE_FLIGHT_RECORDER` defined to `true`, when Tracy is not
+/// enabled, makes the flight recorder the backend of `HYPERION_PROFILE_FUNCTION`,
+/// `HYPERION_PROFILE_START_FRAME`, `HYPERION_PROFILE_END_FRAME`, `HYPERION_PROFILE_MARK_FRAME`
+/// and `HYPERION_PROFILE_PLOT`. Its zones and events can also be recorded directly.
+///
+/// # Example
+/// @code {.cpp}
+/// auto main() -> int {
+///     namespace recorder = hyperion::platform::flight_recorder;
+///     recorder::start_dump_thread("/var/tmp/server-trace");
+///     recorder::install_signal_trigger(SIGUSR2);
+///     recorder::set_latency_threshold(std::chrono::milliseconds{50});
+///     // ...
+/// }
+///
+/// auto handle_request(const request& req) -> response {
+///     HYPERION_PROFILE_FUNCTION();
+///     // ...
+/// }
+/// @endcode
+/// @headerfile hyperion/platform/flight_recorder.h
+/// @}
+
+/// @def HYPERION_FLIGHT_RECORDER_EVENTS_PER_THREAD
+/// @brief The number of events each thread's flight recorder ring buffer holds. Must be a power
+/// of two. Each event occupies 32 bytes. Defaults to 65536
+/// @ingroup flight_recorder
+/// @headerfile hyperion/platform/flight_recorder.h
+#ifndef HYPERION_FLIGHT_RECORDER_EVENTS_PER_THREAD
+    // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+    #define HYPERION_FLIGHT_RECORDER_EVENTS_PER_THREAD 65536
+#endif // HYPERION_FLIGHT_RECORDER_EVENTS_PER_THREAD
+
+namespace hyperion::platform {
+
+    namespace flight_recorder {
+        /// @brief The static description of a profiling zone: the function, file and line it
+        /// was declared at
+        /// @ingroup flight_recorder
+        /// @headerfile hyperion/platform/flight_recorder.h
+        struct zone_site {
+            const char* function;
+            const char* file;
+            std::uint32_t line;
+        };
+    } // namespace flight_recorder
+
+    namespace detail::flight_recorder {
+        static constexpr auto k_capacity
+            = static_cast<std::size_t>(HYPERION_FLIGHT_RECORDER_EVENTS_PER_THREAD);
+        static_assert(std::has_single_bit(k_capacity),
+                      "HYPERION_FLIGHT_RECORDER_EVENTS_PER_THREAD must be a power of two");
+
+        enum class EventKind : std::uint8_t {
+            Zone,
+            // not `FrameMark`, which Tracy defines as a macro
+            Frame,
+            FrameStart,
+            FrameEnd,
+            Counter,
+        };
+
+        /// @brief A recorded event. Fields are atomic so that a dump can read a ring while its
+        /// thread overwrites it; torn events are detected and discarded by the reader
+        struct event {
+            // the kind in the low byte, the recording thread's id above it
+            std::atomic<std::uint64_t> header;
+            // the `zone_site` of a zone, or the name of any other event
+            std::atomic<std::uintptr_t> what;
+            std::atomic<std::uint64_t> time;
+            // the end time of a zone, or the bits of a counter's value
+            std::atomic<std::uint64_t> payload;
+        };
+
+        /// @brief A copy of an event taken by a dump
+        struct recorded_event {
+            EventKind kind;
+            std::uint32_t thread;
+            std::uintptr_t what;
+            std::uint64_t time;
+            std::uint64_t payload;
+        };
+
+        [[nodiscard]] inline auto now() noexcept -> std::uint64_t {
+            return static_cast<std::uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now().time_since_epoch())
+                    .count());
+        }
+
+        HYPERION_IGNORE_PADDING_WARNING_START;
+
+        /// @brief A thread's ring of events. Rings outlive their threads, so that a dump still
+        /// holds the events of threads that have exited, and are reused by new threads
+        struct thread_ring {
+            std::array<event, k_capacity> events{};
+            alignas(HYPERION_PLATFORM_CACHE_LINE_SIZE) std::atomic<std::uint64_t> head = 0;
+            std::atomic<bool> in_use = true;
+            std::uint32_t thread = 0;
+            thread_ring* next = nullptr;
+
+            auto record(EventKind kind,
+                        std::uintptr_t what,
+                        std::uint64_t time,
+                        std::uint64_t payload) noexcept -> void {
+                const auto index = head.load(std::memory_order_relaxed);
+                // orders the previous head update before this event's fields, so that a reader
+                // that sees any of them also sees that this slot is being overwritten
+                std::atomic_thread_fence(std::memory_order_release);
+                auto& slot = events[index & (k_capacity - 1)]; // NOLINT(*-constant-array-index)
+                slot.header.store(static_cast<std::uint64_t>(kind)
+                                      | (static_cast<std::uint64_t>(thread) << 8U),
+                                  std::memory_order_relaxed);
+                slot.what.store(what, std::memory_order_relaxed);
+                slot.time.store(time, std::memory_order_relaxed);
+                slot.payload.store(payload, std::memory_order_relaxed);
+                head.store(index + 1, std::memory_order_release);
+            }
+
+            /// @brief Appends the ring's events starting at or after `cutoff` to `output`
+            auto collect(std::uint64_t cutoff, std::vector<recorded_event>& output) const
+                -> void {
+                const auto end = head.load(std::memory_order_acquire);
+                const auto begin = end > k_capacity ? end - k_capacity : 0;
+                const auto first_output = output.size();
+                for(auto index = begin; index < end; ++index) {
+                    const auto& slot = events[index & (k_capacity - 1)]; // NOLINT
+                    const auto header = slot.header.load(std::memory_order_relaxed);
+                    output.push_back({static_cast<EventKind>(header & 0xFFU),
+                                      static_cast<std::uint32_t>(header >> 8U),
+                                      slot.what.load(std::memory_order_relaxed),
+                                      slot.time.load(std::memory_order_relaxed),
+                                      slot.payload.load(std::memory_order_relaxed)});
+                }
+                std::atomic_thread_fence(std::memory_order_acquire);
+
+                // discard the events the thread may have overwritten while they were copied
+                const auto latest = head.load(std::memory_order_relaxed);
+                const auto valid = latest >= k_capacity ? latest - k_capacity + 1 : 0;
+                auto kept = first_output;
+                for(auto copied = first_output; copied < output.size(); ++copied) {
+                    const auto index = begin + (copied - first_output);
+                    if(index >= valid && output[copied].time >= cutoff) {
+                        output[kept++] = output[copied];
+                    }
+                }
+                output.resize(kept);
+            }
+        };
+
+        struct ring_registry {
+            std::mutex mutex;
+            thread_ring* rings = nullptr;
+            std::uint32_t next_thread = 0;
+        };
+
+        struct trigger_state {
+            std::atomic<std::int64_t> window = std::chrono::nanoseconds{std::chrono::seconds{10}}
+                                                   .count();
+            std::atomic<std::int64_t> latency_threshold = 0;
+            std::atomic<bool> armed = true;
+            std::atomic<int> wake_descriptor = -1;
+        };
+
+        HYPERION_IGNORE_PADDING_WARNING_STOP;
+
+        /// @brief Storage for the ring registry that is constant-initialized and never
+        /// destroyed. Rings are deliberately never freed either, so that they can be dumped at
+        /// any point, even during static destruction
+        union registry_storage {
+            ring_registry instance;
+
+            constexpr registry_storage() noexcept
+                : instance{} {
+            }
+            registry_storage(const registry_storage&) = delete;
+            registry_storage(registry_storage&&) = delete;
+            ~registry_storage() noexcept { // NOLINT(modernize-use-equals-default)
+            }
+            auto operator=(const registry_storage&) -> registry_storage& = delete;
+            auto operator=(registry_storage&&) -> registry_storage& = delete;
+        };
+
+        // NOLINTNEXTLINE(*-avoid-non-const-global-variables)
+        inline constinit registry_storage g_registry;
+
+        [[nodiscard]] inline auto registry() noexcept -> ring_registry& {
+            return g_registry.instance;
+        }
+
+        inline constinit trigger_state g_triggers{}; // NOLINT(*-avoid-non-const-global-variables)
+
+        /// @brief Claims the ring of an exited thread, or allocates a new one. Requires the
+        /// registry's mutex to be held
+        /// @return The ring, or null if one couldn't be allocated
+        [[nodiscard]] inline auto acquire_ring(ring_registry& rings) noexcept -> thread_ring* {
+            for(auto* ring = rings.rings; ring != nullptr; ring = ring->next) {
+                // synchronizes with the exiting thread's release, so its last event happens
+                // before this thread's first
+                if(!ring->in_use.load(std::memory_order_acquire)) {
+                    ring->in_use.store(true, std::memory_order_relaxed);
+                    ring->thread = rings.next_thread++;
+                    return ring;
+                }
+            }
+
+            auto* const ring = new(std::nothrow) thread_ring{}; // NOLINT(*-owning-memory)
+            if(ring == nullptr) {
+                return nullptr;
+            }
+            ring->thread = rings.next_thread++;
+            ring->next = rings.rings;
+            rings.rings = ring;
+            return ring;
+        }
+
+        /// @brief The calling thread's claim on its ring, released when the thread exits
+        struct thread_handle {
+            thread_ring* ring = nullptr;
+
+            constexpr thread_handle() noexcept = default;
+            thread_handle(const thread_handle&) = delete;
+            thread_handle(thread_handle&&) = delete;
+            ~thread_handle() noexcept {
+                if(ring != nullptr) {
+                    ring->in_use.store(false, std::memory_order_release);
+                }
+            }
+            auto operator=(const thread_handle&) -> thread_handle& = delete;
+            auto operator=(thread_handle&&) -> thread_handle& = delete;
+        };
+
+        [[nodiscard]] inline auto local_handle() noexcept -> thread_handle& {
+            thread_local auto handle = thread_handle{};
+            return handle;
+        }
+
+        /// @brief Returns the calling thread's ring, acquiring one if it has none, waiting for
+        /// any dump in progress to finish
+        /// @return The ring, or null if one couldn't be allocated
+        [[nodiscard]] inline auto local_ring() noexcept -> thread_ring* {
+            auto& handle = local_handle();
+            if(handle.ring == nullptr) [[unlikely]] {
+                auto& rings = registry();
+                const auto guard = std::scoped_lock{rings.mutex};
+                handle.ring = acquire_ring(rings);
+            }
+            return handle.ring;
+        }
+
+        /// @brief Returns the calling thread's ring, acquiring one if it has none and that can
+        /// be done without blocking. Used when recording, so that a thread's first event never
+        /// waits for a dump in progress
+        /// @return The ring, or null if the thread has none and one couldn't be acquired
+        [[nodiscard]] inline auto try_local_ring() noexcept -> thread_ring* {
+            auto& handle = local_handle();
+            if(handle.ring == nullptr) [[unlikely]] {
+                auto& rings = registry();
+                const auto lock = std::unique_lock{rings.mutex, std::try_to_lock};
+                if(lock.owns_lock()) {
+                    handle.ring = acquire_ring(rings);
+                }
+            }
+            return handle.ring;
+        }
+
+        /// @brief Records an event on the calling thread's ring, dropping it if the thread has
+        /// no ring
+        inline auto record(EventKind kind,
+                           std::uintptr_t what,
+                           std::uint64_t time,
+                           std::uint64_t payload) noexcept -> void {
+            if(auto* const ring = try_local_ring(); ring != nullptr) [[likely]] {
+                ring->record(kind, what, time, payload);
+            }
+        }
+
+        /// @brief Asks the dump thread, if any, to write a dump. Async-signal-safe
+        inline auto request_dump() noexcept -> void {
+#if HYPERION_PLATFORM_IS_UNIX
+            const auto descriptor = g_triggers.wake_descriptor.load(std::memory_order_acquire);
+            if(descriptor >= 0 && g_triggers.armed.exchange(false, std::memory_order_acq_rel)) {
+                const auto request = char{1};
+                static_cast<void>(::write(descriptor, &request, 1));
+            }
+#endif // HYPERION_PLATFORM_IS_UNIX
+        }
+
+        inline auto write_escaped(std::FILE* file, const char* text) -> void {
+            for(; *text != '\0'; ++text) { // NOLINT(*-pro-bounds-pointer-arithmetic)
+                const auto character = static_cast<unsigned char>(*text);
+                if(character == '"' || character == '\\') {
+                    std::fprintf(file, "\\%c", character); // NOLINT(*-vararg)
+                }
+                else if(character < 0x20U) {
+                    std::fprintf(file, "\\u%04x", character); // NOLINT(*-vararg)
+                }
+                else {
+                    std::fputc(character, file);
+                }
+            }
+        }
+    } // namespace detail::flight_recorder
+
+    namespace flight_recorder {
+
+        /// @brief Acquires the calling thread's ring buffer ahead of its first event.
+        ///
+        /// A thread's first event otherwise acquires its ring, which allocates the ring if no
+        /// exited thread's ring can be reused. As events are recorded from `noexcept` code that
+        /// must not block, an event that finds the thread without a ring is dropped if the ring
+        /// can't be acquired without waiting for a dump in progress, or can't be allocated.
+        /// Calling this when a thread starts ensures none of its events are dropped.
+        /// @return Whether the thread has a ring. Fails only if allocating it fails
+        /// @ingroup flight_recorder
+        /// @headerfile hyperion/platform/flight_recorder.h
+        [[nodiscard]] inline auto register_thread() noexcept -> bool {
+            return detail::flight_recorder::local_ring() != nullptr;
+        }
+
+        /// @brief Records the duration of the enclosing scope as a zone
+        /// @ingroup flight_recorder
+        /// @headerfile hyperion/platform/flight_recorder.h
+        class zone {
+          public:
+            /// @brief Begins a zone described by `site`, which must have static storage
+            /// duration
+            /// @param site The zone's description
+            explicit zone(const zone_site* site) noexcept
+                : m_site{site}, m_start{detail::flight_recorder::now()} {
+            }
+            zone(const zone&) = delete;
+            zone(zone&&) = delete;
+
+            /// @brief Ends the zone, recording it, and triggering a dump if it exceeded the
+            /// latency threshold
+            ~zone() noexcept {
+                using namespace detail::flight_recorder; // NOLINT(google-build-using-namespace)
+                const auto end = now();
+                // NOLINTNEXTLINE(*-pro-type-reinterpret-cast)
+                record(EventKind::Zone, reinterpret_cast<std::uintptr_t>(m_site), m_start, end);
+
+                const auto threshold = g_triggers.latency_threshold.load(std::memory_order_relaxed);
+                if(threshold > 0 && end - m_start > static_cast<std::uint64_t>(threshold))
+                    [[unlikely]]
+                {
+                    request_dump();
+                }
+            }
+
+            auto operator=(const zone&) -> zone& = delete;
+            auto operator=(zone&&) -> zone& = delete;
+
+          private:
+            const zone_site* m_site;
+            std::uint64_t m_start;
+        };
+
+        /// @brief Records the end of a frame
+        /// @ingroup flight_recorder
+        /// @headerfile hyperion/platform/flight_recorder.h
+        inline auto mark_frame() noexcept -> void {
+            using namespace detail::flight_recorder; // NOLINT(google-build-using-namespace)
+            record(EventKind::Frame, 0, now(), 0);
+        }
+
+        /// @brief Records the start of the named frame
+        /// @param name The frame's name. Must have static storage duration
+        /// @ingroup flight_recorder
+        /// @headerfile hyperion/platform/flight_recorder.h
+        inline auto start_frame(const char* name) noexcept -> void {
+            using namespace detail::flight_recorder; // NOLINT(google-build-using-namespace)
+            // NOLINTNEXTLINE(*-pro-type-reinterpret-cast)
+            record(EventKind::FrameStart, reinterpret_cast<std::uintptr_t>(name), now(), 0);
+        }
+
+        /// @brief Records the end of the named frame
+        /// @param name The frame's name. Must have static storage duration
+        /// @ingroup flight_recorder
+        /// @headerfile hyperion/platform/flight_recorder.h
+        inline auto end_frame(const char* name) noexcept -> void {
+            using namespace detail::flight_recorder; // NOLINT(google-build-using-namespace)
+            // NOLINTNEXTLINE(*-pro-type-reinterpret-cast)
+            record(EventKind::FrameEnd, reinterpret_cast<std::uintptr_t>(name), now(), 0);
+        }
+
+        /// @brief Records `value` as the next point of the named plot
+        /// @param name The plot's name. Must have static storage duration
+        /// @param value The value
+        /// @ingroup flight_recorder
+        /// @headerfile hyperion/platform/flight_recorder.h
+        inline auto record_counter(const char* name, double value) noexcept -> void {
+            using namespace detail::flight_recorder; // NOLINT(google-build-using-namespace)
+            // NOLINTNEXTLINE(*-pro-type-reinterpret-cast)
+            record(EventKind::Counter,
+                   reinterpret_cast<std::uintptr_t>(name),
+                   now(),
+                   std::bit_cast<std::uint64_t>(value));
+        }
+
+        /// @brief Returns how far back from the time of a dump events are included in it
+        /// @return The dump window
+        /// @ingroup flight_recorder
+        /// @headerfile hyperion/platform/flight_recorder.h
+        [[nodiscard]] inline auto window() noexcept -> std::chrono::nanoseconds {
+            return std::chrono::nanoseconds{
+                detail::flight_recorder::g_triggers.window.load(std::memory_order_relaxed)};
+        }
+
+        /// @brief Sets how far back from the time of a dump events are included in it. Events
+        /// are also limited by the capacity of each thread's ring
+        /// @param duration The dump window
+        /// @ingroup flight_recorder
+        /// @headerfile hyperion/platform/flight_recorder.h
+        inline auto set_window(std::chrono::nanoseconds duration) noexcept -> void {
+            detail::flight_recorder::g_triggers.window.store(duration.count(),
+                                                             std::memory_order_relaxed);
+        }
+
+        /// @brief Sets the zone duration above which a dump is triggered
+        /// @param threshold The threshold, or zero to disable latency-triggered dumps
+        /// @ingroup flight_recorder
+        /// @headerfile hyperion/platform/flight_recorder.h
+        inline auto set_latency_threshold(std::chrono::nanoseconds threshold) noexcept -> void {
+            detail::flight_recorder::g_triggers.latency_threshold.store(
+                threshold.count(),
+                std::memory_order_relaxed);
+        }
+
+        /// @brief Writes the events of the last `window()` to the file at `path`, in the Chrome
+        /// trace event JSON format
+        /// @param path The file to write
+        /// @return Whether the file was written
+        /// @ingroup flight_recorder
+        /// @headerfile hyperion/platform/flight_recorder.h
+        [[nodiscard]] inline auto dump(const char* path) -> bool {
+            using namespace detail::flight_recorder; // NOLINT(google-build-using-namespace)
+            const auto current = now();
+            const auto span
+                = static_cast<std::uint64_t>(std::max<std::int64_t>(window().count(), 0));
+            const auto cutoff = current > span ? current - span : 0;
+
+            auto events = std::vector<recorded_event>{};
+            {
+                auto& rings = registry();
+                const auto guard = std::scoped_lock{rings.mutex};
+                for(const auto* ring = rings.rings; ring != nullptr; ring = ring->next) {
+                    ring->collect(cutoff, events);
+                }
+            }
+
+            auto* const file = std::fopen(path, "w"); // NOLINT(*-owning-memory)
+            if(file == nullptr) {
+                return false;
+            }
+
+#if HYPERION_PLATFORM_IS_UNIX
+            const auto process = static_cast<long>(::getpid());
+#else
+            const auto process = 0L;
+#endif // HYPERION_PLATFORM_IS_UNIX
+
+            // NOLINTBEGIN(*-vararg, *-pro-type-reinterpret-cast, performance-no-int-to-ptr)
+            std::fputs(R"({"displayTimeUnit":"ns","traceEvents":[)", file);
+            auto first = true;
+            for(const auto& event : events) {
+                std::fputs(first ? "\n" : ",\n", file);
+                first = false;
+                const auto timestamp = static_cast<double>(event.time) / 1000.0;
+                const auto* const name = reinterpret_cast<const char*>(event.what);
+                switch(event.kind) {
+                    case EventKind::Zone: {
+                        const auto* const site = reinterpret_cast<const zone_site*>(event.what);
+                        std::fputs(R"({"name":")", file);
+                        write_escaped(file, site->function);
+                        std::fprintf(file,
+                                     R"(","cat":"zone","ph":"X","ts":%.3f,"dur":%.3f,)"
+                                     R"("pid":%ld,"tid":%u,"args":{"file":")",
+                                     timestamp,
+                                     static_cast<double>(event.payload - event.time) / 1000.0,
+                                     process,
+                                     event.thread);
+                        write_escaped(file, site->file);
+                        std::fprintf(file, R"(","line":%u}})", site->line);
+                        break;
+                    }
+                    case EventKind::Frame:
+                        std::fprintf(file,
+                                     R"({"name":"frame","ph":"i","s":"g","ts":%.3f,)"
+                                     R"("pid":%ld,"tid":%u})",
+                                     timestamp,
+                                     process,
+                                     event.thread);
+                        break;
+                    case EventKind::FrameStart:
+                    case EventKind::FrameEnd:
+                        std::fputs(R"({"name":")", file);
+                        write_escaped(file, name);
+                        std::fprintf(file,
+                                     R"(","cat":"frame","ph":"%c","ts":%.3f,"pid":%ld,"tid":%u})",
+                                     event.kind == EventKind::FrameStart ? 'B' : 'E',
+                                     timestamp,
+                                     process,
+                                     event.thread);
+                        break;
+                    case EventKind::Counter:
+                        std::fputs(R"({"name":")", file);
+                        write_escaped(file, name);
+                        std::fprintf(file,
+                                     R"(","ph":"C","ts":%.3f,"pid":%ld,"args":{"value":%.17g}})",
+                                     timestamp,
+                                     process,
+                                     std::bit_cast<double>(event.payload));
+                        break;
+                }
+            }
+            std::fputs("\n]}\n", file);
+            // NOLINTEND(*-vararg, *-pro-type-reinterpret-cast, performance-no-int-to-ptr)
+
+            const auto written = std::ferror(file) == 0;
+            return std::fclose(file) == 0 && written;
+        }
+
+    } // namespace flight_recorder
+
+    namespace detail::flight_recorder {
+        /// @brief The background thread writing triggered dumps, stopped at exit
+        class dump_thread {
+          public:
+            dump_thread() noexcept = default;
+            dump_thread(const dump_thread&) = delete;
+            dump_thread(dump_thread&&) = delete;
+            ~dump_thread() noexcept {
+                stop();
+            }
+            auto operator=(const dump_thread&) -> dump_thread& = delete;
+            auto operator=(dump_thread&&) -> dump_thread& = delete;
+
+            [[nodiscard]] auto start(std::string prefix) -> bool {
+#if HYPERION_PLATFORM_IS_UNIX
+                const auto guard = std::scoped_lock{m_mutex};
+                if(m_thread.joinable()) {
+                    return false;
+                }
+
+                if(!open_pipe()) {
+                    return false;
+                }
+                m_thread = std::thread{[read_descriptor = m_descriptors[0],
+                                        prefix = std::move(prefix)] {
+                    auto count = 0U;
+                    auto request = char{0};
+                    while(true) {
+                        const auto result = ::read(read_descriptor, &request, 1);
+                        if(result < 0 && errno == EINTR) {
+                            continue;
+                        }
+                        if(result <= 0 || request == 0) {
+                            return;
+                        }
+                        // written under a temporary name, so the dump appears complete
+                        const auto path = prefix + "-" + std::to_string(count++) + ".json";
+                        const auto partial = path + ".partial";
+                        if(hyperion::platform::flight_recorder::dump(partial.c_str())) {
+                            static_cast<void>(std::rename(partial.c_str(), path.c_str()));
+                        }
+                        g_triggers.armed.store(true, std::memory_order_release);
+                    }
+                }};
+                g_triggers.armed.store(true, std::memory_order_relaxed);
+                g_triggers.wake_descriptor.store(m_descriptors[1], std::memory_order_release);
+                return true;
+#else
+                static_cast<void>(prefix);
+                return false;
+#endif // HYPERION_PLATFORM_IS_UNIX
+            }
+
+            auto stop() noexcept -> void {
+#if HYPERION_PLATFORM_IS_UNIX
+                const auto guard = std::scoped_lock{m_mutex};
+                if(!m_thread.joinable()) {
+                    return;
+                }
+                g_triggers.wake_descriptor.store(-1, std::memory_order_release);
+                const auto request = char{0};
+                static_cast<void>(::write(m_descriptors[1], &request, 1));
+                m_thread.join();
+#endif // HYPERION_PLATFORM_IS_UNIX
+            }
+
+          private:
+            std::mutex m_mutex;
+            std::thread m_thread;
+            // like the rings, the pipe is never closed, as a `request_dump` that read the write
+            // descriptor before `stop` cleared it may still write to it at any later point
+            std::array<int, 2> m_descriptors{-1, -1};
+
+#if HYPERION_PLATFORM_IS_UNIX
+            /// @brief Creates the wake-up pipe on first use, or discards any requests left in it
+            /// by a previous run of the thread. Requires `m_mutex` to be held.
+            [[nodiscard]] auto open_pipe() noexcept -> bool {
+                if(m_descriptors[0] < 0) {
+                    auto descriptors = std::array<int, 2>{};
+                    if(::pipe(descriptors.data()) != 0) {
+                        return false;
+                    }
+                    for(const auto descriptor : descriptors) {
+                        ::fcntl(descriptor, F_SETFD, FD_CLOEXEC); // NOLINT(*-vararg)
+                    }
+                    m_descriptors = descriptors;
+                    return true;
+                }
+
+                const auto flags = ::fcntl(m_descriptors[0], F_GETFL); // NOLINT(*-vararg)
+                ::fcntl(m_descriptors[0], F_SETFL, flags | O_NONBLOCK); // NOLINT(*-vararg)
+                auto request = char{0};
+                while(::read(m_descriptors[0], &request, 1) > 0) {
+                    // a request that raced with the previous `stop`
+                }
+                ::fcntl(m_descriptors[0], F_SETFL, flags); // NOLINT(*-vararg)
+                return true;
+            }
+#endif // HYPERION_PLATFORM_IS_UNIX
+        };
+
+        [[nodiscard]] inline auto the_dump_thread() noexcept -> dump_thread& {
+            static auto instance = dump_thread{};
+            return instance;
+        }
+    } // namespace detail::flight_recorder
+
+    namespace flight_recorder {
+
+        /// @brief Whether triggered dumps are supported on this platform
+        /// @ingroup flight_recorder
+        /// @headerfile hyperion/platform/flight_recorder.h
+        static constexpr auto triggers_supported = HYPERION_PLATFORM_IS_UNIX;
+
+        /// @brief Starts the background thread that writes signal and latency triggered dumps.
+        ///
+        /// Each triggered dump is written to `<prefix>-<N>.json`, where `N` counts up from 0.
+        /// The file is renamed into place once it is complete.
+        /// @param prefix The path prefix of the dump files
+        /// @return Whether the thread was started. Fails if it is already running, or triggers
+        /// are not supported on this platform
+        /// @ingroup flight_recorder
+        /// @headerfile hyperion/platform/flight_recorder.h
+        [[nodiscard]] inline auto start_dump_thread(std::string prefix) -> bool {
+            return detail::flight_recorder::the_dump_thread().start(std::move(prefix));
+        }
+
+        /// @brief Stops the background dump thread, after it finishes any dump in progress.
+        /// This happens automatically at exit
+        /// @ingroup flight_recorder
+        /// @headerfile hyperion/platform/flight_recorder.h
+        inline auto stop_dump_thread() noexcept -> void {
+            detail::flight_recorder::the_dump_thread().stop();
+        }
+
+        /// @brief Requests a dump from the background dump thread without waiting for it. Does
+        /// nothing if the thread is not running or a triggered dump is already in progress.
+        /// Async-signal-safe
+        /// @ingroup flight_recorder
+        /// @headerfile hyperion/platform/flight_recorder.h
+        inline auto request_dump() noexcept -> void {
+            detail::flight_recorder::request_dump();
+        }
+
+        /// @brief Installs a handler for `signal_number` that requests a dump from the
+        /// background dump thread
+        /// @param signal_number The signal, such as `SIGUSR2`
+        /// @return Whether the handler was installed
+        /// @ingroup flight_recorder
+        /// @headerfile hyperion/platform/flight_recorder.h
+        [[nodiscard]] inline auto install_signal_trigger(int signal_number) noexcept -> bool {
+#if HYPERION_PLATFORM_IS_UNIX
+            struct sigaction action = {}; // NOLINT(*-member-init)
+            action.sa_handler = [](int) {
+                const auto saved_errno = errno;
+                detail::flight_recorder::request_dump();
+                errno = saved_errno;
+            };
+            ::sigemptyset(&action.sa_mask);
+            action.sa_flags = SA_RESTART;
+            return ::sigaction(signal_number, &action, nullptr) == 0;
+#else
+            static_cast<void>(signal_number);
+            return false;
+#endif // HYPERION_PLATFORM_IS_UNIX
+        }
+
+    } // namespace flight_recorder
+
+} // namespace hyperion::platform
+
+#if defined(HYPERION_ENABLE_TESTING) && HYPERION_ENABLE_TESTING
+
+    #include <boost/ut.hpp>
+
+    #include <algorithm>
+    #include <filesystem>
+    #include <fstream>
+    #include <iterator>
+
+namespace hyperion::_test::platform::flight_recorder {
+
+    // NOLINTNEXTLINE(google-build-using-namespace)
+    using namespace boost::ut;
+    namespace recorder = hyperion::platform::flight_recorder;
+
+    [[nodiscard]] inline auto read_file(const std::filesystem::path& path) -> std::string {
+        auto file = std::ifstream{path};
+        return {std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+    }
+
+    inline auto recorded_function() -> void {
+        static constexpr auto site
+            = recorder::zone_site{static_cast<const char*>(__func__), __FILE__, __LINE__};
+        const auto zone = recorder::zone{&site};
+    }
+
+    inline auto slow_function() -> void {
+        static constexpr auto site
+            = recorder::zone_site{static_cast<const char*>(__func__), __FILE__, __LINE__};
+        const auto zone = recorder::zone{&site};
+        std::this_thread::sleep_for(std::chrono::milliseconds{5});
+    }
+
+    // NOLINTNEXTLINE(cert-err58-cpp)
+    static const suite<"hyperion::platform::flight_recorder"> flight_recorder_tests = [] {
+        "dump"_test = [] {
+            const auto path = std::filesystem::temp_directory_path() / "hyperion_flight_dump.json";
+            std::thread{[] {
+                recorded_function();
+                recorder::start_frame("update \"frame\"");
+                recorder::end_frame("update \"frame\"");
+                recorder::mark_frame();
+                recorder::record_counter("queue_depth", 42.0);
+            }}.join();
+
+            expect(recorder::dump(path.string().c_str()));
+            const auto contents = read_file(path);
+            std::filesystem::remove(path);
+            expect(contents.starts_with(R"({"displayTimeUnit":"ns","traceEvents":[)"));
+            expect(contents.ends_with("]}\n"));
+            expect(contents.find(R"("name":"recorded_function","cat":"zone","ph":"X")")
+                   != std::string::npos);
+            expect(contents.find(R"("name":"update \"frame\"","cat":"frame","ph":"B")")
+                   != std::string::npos);
+            expect(contents.find(R"("name":"queue_depth","ph":"C")") != std::string::npos);
+            expect(contents.find(R"("value":42})") != std::string::npos);
+        };
+
+        "ring_wraps"_test = [] {
+            using namespace hyperion::platform::detail::flight_recorder; // NOLINT
+            auto latest = std::uint64_t{0};
+            auto collected = std::vector<recorded_event>{};
+            std::thread{[&] {
+                auto& ring = *local_ring();
+                static constexpr auto site = recorder::zone_site{"wrapped", __FILE__, __LINE__};
+                for(auto index = std::size_t{0}; index < k_capacity + 1000; ++index) {
+                    const auto zone = recorder::zone{&site};
+                }
+                latest = now();
+                ring.collect(0, collected);
+            }}.join();
+
+            const auto last = std::max_element(collected.begin(),
+                                               collected.end(),
+                                               [](const auto& lhs, const auto& rhs) {
+                                                   return lhs.time < rhs.time;
+                                               });
+            expect(collected.size() + 1 >= k_capacity && collected.size() <= k_capacity);
+            expect(last != collected.end() && last->time <= latest);
+
+            auto windowed = std::vector<recorded_event>{};
+            std::thread{[&] {
+                auto& ring = *local_ring();
+                recorded_function();
+                ring.collect(now() + 1'000'000'000U, windowed);
+            }}.join();
+            expect(windowed.empty());
+        };
+
+        "first_use"_test = [] {
+            using namespace hyperion::platform::detail::flight_recorder; // NOLINT
+            auto registered = std::vector<recorded_event>{};
+            auto unregistered = false;
+            auto acquired = false;
+            {
+                // a dump in progress holds the registry, so a thread's first event is dropped
+                // rather than waiting for it
+                const auto guard = std::scoped_lock{registry().mutex};
+                std::thread{[&] {
+                    recorder::mark_frame();
+                    unregistered = local_handle().ring == nullptr;
+                }}.join();
+            }
+
+            std::thread{[&] {
+                acquired = recorder::register_thread();
+                recorder::mark_frame();
+                local_ring()->collect(0, registered);
+            }}.join();
+
+            expect(that % unregistered);
+            expect(that % acquired);
+            expect(!registered.empty() && registered.back().kind == EventKind::Frame);
+        };
+
+        "triggers"_test = [] {
+            if constexpr(!recorder::triggers_supported) {
+                expect(!recorder::start_dump_thread("unsupported"));
+                return;
+            }
+
+            const auto prefix = std::filesystem::temp_directory_path() / "hyperion_flight";
+            // waits for the dump to be written, and the dump thread to be ready for the next
+            const auto wait_for = [](const std::filesystem::path& path) {
+                using hyperion::platform::detail::flight_recorder::g_triggers;
+                for(auto attempt = 0;
+                    attempt < 2'000
+                    && (!std::filesystem::exists(path)
+                        || !g_triggers.armed.load(std::memory_order_acquire));
+                    ++attempt)
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds{5});
+                }
+                return read_file(path);
+            };
+
+            expect(recorder::start_dump_thread(prefix.string()));
+            expect(!recorder::start_dump_thread(prefix.string()));
+
+            recorder::set_latency_threshold(std::chrono::milliseconds{1});
+            recorded_function();
+            slow_function();
+            recorder::set_latency_threshold(std::chrono::nanoseconds{0});
+            const auto latency_dump = prefix.string() + "-0.json";
+            expect(wait_for(latency_dump).find(R"("name":"slow_function")") != std::string::npos);
+
+            expect(recorder::install_signal_trigger(SIGUSR2));
+            expect(that % std::raise(SIGUSR2) == 0);
+            const auto signal_dump = prefix.string() + "-1.json";
+            expect(wait_for(signal_dump).ends_with("]}\n"));
+
+            recorder::stop_dump_thread();
+            std::filesystem::remove(latency_dump);
+            std::filesystem::remove(signal_dump);
+
+            // requests while stopped are ignored, and the thread can be restarted
+            recorder::request_dump();
+            expect(recorder::start_dump_thread(prefix.string()));
+            expect(that % std::raise(SIGUSR2) == 0);
+            const auto restarted_dump = prefix.string() + "-0.json";
+            expect(wait_for(restarted_dump).ends_with("]}\n"));
+
+            recorder::stop_dump_thread();
+            std::signal(SIGUSR2, SIG_DFL);
+            std::filesystem::remove(restarted_dump);
+        };
+    };
+
+} // namespace hyperion::_test::platform::flight_recorder
+
+#endif // defined(HYPERION_ENABLE_TESTING) && HYPERION_ENABLE_TESTING
+
+#endif // HYPERION_PLATFORM_FLIGHT_RECORDER_H
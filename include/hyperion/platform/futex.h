@@ -0,0 +1,632 @@
+/// @file futex.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Compact, futex-based synchronization primitives
+/// @version 0.4.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2024 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef HYPERION_PLATFORM_FUTEX_H
+#define HYPERION_PLATFORM_FUTEX_H
+
+#include <hyperion/platform.h>
+#include <hyperion/platform/cpu.h>
+#include <hyperion/platform/def.h>
+#include <hyperion/platform/types.h>
+
+#include <atomic>
+#include <concepts>
+#include <limits>
+#include <thread>
+
+#if HYPERION_PLATFORM_IS_LINUX
+    #include <linux/futex.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif // HYPERION_PLATFORM_IS_LINUX
+
+/// @ingroup platform
+/// @{
+///	@defgroup futex Futex Synchronization Primitives
+/// Hyperion provides a mutex, condition variable, event, and counting semaphore that each
+/// occupy a single 32-bit word, making them suitable for embedding in large numbers of objects.
+///
+/// Uncontended operations are a single atomic instruction. Contended waits first spin briefly
+/// (issuing the architecture's pause/yield hint, then yielding the thread) before sleeping in
+/// the kernel. On Linux, sleeping and waking use `futex(2)` directly; on other platforms they
+/// fall back to `std::atomic<u32>::wait` and `notify_one`/`notify_all`.
+///
+/// # Example
+/// @code {.cpp}
+/// struct node {
+///     hyperion::platform::futex_mutex lock;
+///     u32 refs;
+/// };
+///
+/// auto acquire(node& node) -> void {
+///     const auto guard = std::scoped_lock{node.lock};
+///     ++node.refs;
+/// }
+/// @endcode
+/// @headerfile hyperion/platform/futex.h
+/// @}
+
+namespace hyperion::platform {
+
+    namespace detail::futex {
+        static_assert(sizeof(std::atomic<u32>) == sizeof(u32)
+                          && std::atomic<u32>::is_always_lock_free,
+                      "futex-based primitives require a lock-free, 32-bit std::atomic<u32>");
+
+        static inline constexpr auto k_pause_spins = 64_usize;
+        static inline constexpr auto k_yield_spins = 4_usize;
+
+        /// @brief Spins until `pred` returns `true` or the spin budget is exhausted, first
+        /// issuing pause hints and then yielding the thread
+        /// @return Whether `pred` returned `true`
+        template<typename TPred>
+            requires std::predicate<TPred&>
+        [[nodiscard]] inline auto spin_until(TPred&& pred) noexcept -> bool {
+            for(auto spin = 0_usize; spin < k_pause_spins; ++spin) {
+                if(pred()) {
+                    return true;
+                }
+                cpu_relax();
+            }
+
+            for(auto spin = 0_usize; spin < k_yield_spins; ++spin) {
+                if(pred()) {
+                    return true;
+                }
+                std::this_thread::yield();
+            }
+
+            return pred();
+        }
+
+        /// @brief Blocks the calling thread while `word` holds `expected`.
+        /// May return spuriously; callers must re-check their condition.
+        inline auto wait(std::atomic<u32>& word, u32 expected) noexcept -> void {
+#if HYPERION_PLATFORM_IS_LINUX
+            // NOLINTNEXTLINE(*-vararg, *-reinterpret-cast)
+            syscall(SYS_futex, reinterpret_cast<u32*>(&word), FUTEX_WAIT_PRIVATE, expected,
+                    nullptr, nullptr, 0);
+#else
+            word.wait(expected, std::memory_order_relaxed);
+#endif // HYPERION_PLATFORM_IS_LINUX
+        }
+
+        /// @brief Wakes at most one thread blocked in `wait` on `word`
+        inline auto wake_one(std::atomic<u32>& word) noexcept -> void {
+#if HYPERION_PLATFORM_IS_LINUX
+            // NOLINTNEXTLINE(*-vararg, *-reinterpret-cast)
+            syscall(SYS_futex, reinterpret_cast<u32*>(&word), FUTEX_WAKE_PRIVATE, 1, nullptr,
+                    nullptr, 0);
+#else
+            word.notify_one();
+#endif // HYPERION_PLATFORM_IS_LINUX
+        }
+
+        /// @brief Wakes every thread blocked in `wait` on `word`
+        inline auto wake_all(std::atomic<u32>& word) noexcept -> void {
+#if HYPERION_PLATFORM_IS_LINUX
+            // NOLINTNEXTLINE(*-vararg, *-reinterpret-cast)
+            syscall(SYS_futex, reinterpret_cast<u32*>(&word), FUTEX_WAKE_PRIVATE,
+                    std::numeric_limits<int>::max(), nullptr, nullptr, 0);
+#else
+            word.notify_all();
+#endif // HYPERION_PLATFORM_IS_LINUX
+        }
+    } // namespace detail::futex
+
+    /// @brief A 4-byte, non-recursive mutex.
+    ///
+    /// Satisfies the standard _Lockable_ requirements, so it can be used with
+    /// `std::lock_guard`, `std::unique_lock`, and `std::scoped_lock`. Locking and unlocking an
+    /// uncontended `futex_mutex` is a single atomic instruction each, and unlocking only
+    /// enters the kernel if another thread is sleeping on the mutex.
+    ///
+    /// @ingroup futex
+    /// @headerfile hyperion/platform/futex.h
+    class futex_mutex {
+      public:
+        constexpr futex_mutex() noexcept = default;
+        futex_mutex(const futex_mutex&) = delete;
+        futex_mutex(futex_mutex&&) = delete;
+        ~futex_mutex() noexcept = default;
+        auto operator=(const futex_mutex&) -> futex_mutex& = delete;
+        auto operator=(futex_mutex&&) -> futex_mutex& = delete;
+
+        /// @brief Locks the mutex, blocking until it is available
+        auto lock() noexcept -> void {
+            auto state = k_unlocked;
+            if(m_state.compare_exchange_strong(state,
+                                               k_locked,
+                                               std::memory_order_acquire,
+                                               std::memory_order_relaxed)) [[likely]]
+            {
+                return;
+            }
+
+            lock_contended();
+        }
+
+        /// @brief Attempts to lock the mutex without blocking
+        /// @return Whether the mutex was locked
+        [[nodiscard]] auto try_lock() noexcept -> bool {
+            auto state = k_unlocked;
+            return m_state.compare_exchange_strong(state,
+                                                   k_locked,
+                                                   std::memory_order_acquire,
+                                                   std::memory_order_relaxed);
+        }
+
+        /// @brief Unlocks the mutex
+        /// @pre The calling thread holds the lock
+        auto unlock() noexcept -> void {
+            if(m_state.exchange(k_unlocked, std::memory_order_release) == k_contended)
+                [[unlikely]]
+            {
+                detail::futex::wake_one(m_state);
+            }
+        }
+
+      private:
+        static constexpr auto k_unlocked = 0_u32;
+        static constexpr auto k_locked = 1_u32;
+        static constexpr auto k_contended = 2_u32;
+
+        std::atomic<u32> m_state = k_unlocked;
+
+        auto lock_contended() noexcept -> void {
+            const auto acquired = detail::futex::spin_until([this]() noexcept {
+                auto state = m_state.load(std::memory_order_relaxed);
+                return state == k_unlocked
+                       && m_state.compare_exchange_weak(state,
+                                                        k_locked,
+                                                        std::memory_order_acquire,
+                                                        std::memory_order_relaxed);
+            });
+
+            if(acquired) {
+                return;
+            }
+
+            // Once we've marked the mutex as contended, we can never downgrade it back to
+            // `k_locked`, since other sleepers may depend on our unlock waking them
+            while(m_state.exchange(k_contended, std::memory_order_acquire) != k_unlocked) {
+                detail::futex::wait(m_state, k_contended);
+            }
+        }
+    };
+
+    /// @brief A 4-byte condition variable for use with `futex_mutex`, or any other _BasicLockable_
+    /// type.
+    ///
+    /// As with `std::condition_variable`, waits may wake spuriously, so callers should wait
+    /// on a predicate. Notifying only enters the kernel if a thread may be waiting.
+    ///
+    /// @ingroup futex
+    /// @headerfile hyperion/platform/futex.h
+    class futex_condition_variable {
+      public:
+        constexpr futex_condition_variable() noexcept = default;
+        futex_condition_variable(const futex_condition_variable&) = delete;
+        futex_condition_variable(futex_condition_variable&&) = delete;
+        ~futex_condition_variable() noexcept = default;
+        auto operator=(const futex_condition_variable&) -> futex_condition_variable& = delete;
+        auto operator=(futex_condition_variable&&) -> futex_condition_variable& = delete;
+
+        /// @brief Atomically unlocks `lock` and blocks until notified (or woken spuriously),
+        /// then re-locks `lock` before returning
+        /// @tparam TLock The type of the lock
+        /// @param lock The held lock
+        /// @pre The calling thread holds `lock`
+        template<typename TLock>
+        auto wait(TLock& lock) noexcept(noexcept(lock.unlock()) && noexcept(lock.lock()))
+            -> void {
+            const auto state = m_state.fetch_or(k_waiters, std::memory_order_relaxed)
+                               | k_waiters;
+            lock.unlock();
+            detail::futex::wait(m_state, state);
+            lock.lock();
+        }
+
+        /// @brief Blocks until `pred` returns `true`, re-checking it each time this is notified
+        /// @tparam TLock The type of the lock
+        /// @tparam TPred The type of the predicate
+        /// @param lock The held lock
+        /// @param pred The predicate to wait on
+        /// @pre The calling thread holds `lock`
+        template<typename TLock, typename TPred>
+            requires std::predicate<TPred&>
+        auto wait(TLock& lock, TPred pred) -> void {
+            while(!pred()) {
+                wait(lock);
+            }
+        }
+
+        /// @brief Wakes at least one thread waiting on this, if any
+        auto notify_one() noexcept -> void {
+            if((m_state.fetch_add(k_sequence_step, std::memory_order_relaxed) & k_waiters)
+               != 0_u32)
+            {
+                detail::futex::wake_one(m_state);
+            }
+        }
+
+        /// @brief Wakes every thread waiting on this
+        auto notify_all() noexcept -> void {
+            if((m_state.fetch_add(k_sequence_step, std::memory_order_relaxed) & k_waiters)
+               != 0_u32)
+            {
+                m_state.fetch_and(~k_waiters, std::memory_order_relaxed);
+                detail::futex::wake_all(m_state);
+            }
+        }
+
+      private:
+        // bit 0 flags possible waiters, the remaining bits form a wrapping sequence number
+        static constexpr auto k_waiters = 1_u32;
+        static constexpr auto k_sequence_step = 2_u32;
+
+        std::atomic<u32> m_state = 0_u32;
+    };
+
+    /// @brief A 4-byte, manually reset event.
+    ///
+    /// Threads block in `wait` until the event is `set`, which releases every current and
+    /// future waiter until the event is `reset`. Setting the event only enters the kernel if a
+    /// thread is sleeping on it.
+    ///
+    /// @ingroup futex
+    /// @headerfile hyperion/platform/futex.h
+    class futex_event {
+      public:
+        constexpr futex_event() noexcept = default;
+        /// @brief Constructs a `futex_event` that is initially set if `set` is `true`
+        /// @param set Whether the event is initially set
+        explicit constexpr futex_event(bool set) noexcept
+            : m_state{set ? k_set : k_unset} {
+        }
+        futex_event(const futex_event&) = delete;
+        futex_event(futex_event&&) = delete;
+        ~futex_event() noexcept = default;
+        auto operator=(const futex_event&) -> futex_event& = delete;
+        auto operator=(futex_event&&) -> futex_event& = delete;
+
+        /// @brief Sets the event, waking all waiters
+        auto set() noexcept -> void {
+            if(m_state.exchange(k_set, std::memory_order_release) == k_unset_with_waiters) {
+                detail::futex::wake_all(m_state);
+            }
+        }
+
+        /// @brief Resets the event, so that subsequent calls to `wait` block until it is set
+        auto reset() noexcept -> void {
+            auto state = k_set;
+            m_state.compare_exchange_strong(state, k_unset, std::memory_order_relaxed);
+        }
+
+        /// @brief Returns whether the event is currently set
+        /// @return Whether the event is set
+        [[nodiscard]] auto is_set() const noexcept -> bool {
+            return m_state.load(std::memory_order_acquire) == k_set;
+        }
+
+        /// @brief Blocks until the event is set
+        auto wait() noexcept -> void {
+            if(is_set()) [[likely]] {
+                return;
+            }
+
+            if(detail::futex::spin_until([this]() noexcept { return is_set(); })) {
+                return;
+            }
+
+            auto state = m_state.load(std::memory_order_acquire);
+            while(state != k_set) {
+                if(state == k_unset
+                   && !m_state.compare_exchange_weak(state,
+                                                     k_unset_with_waiters,
+                                                     std::memory_order_acquire,
+                                                     std::memory_order_acquire))
+                {
+                    continue;
+                }
+
+                detail::futex::wait(m_state, k_unset_with_waiters);
+                state = m_state.load(std::memory_order_acquire);
+            }
+        }
+
+      private:
+        static constexpr auto k_unset = 0_u32;
+        static constexpr auto k_set = 1_u32;
+        static constexpr auto k_unset_with_waiters = 2_u32;
+
+        std::atomic<u32> m_state = k_unset;
+    };
+
+    /// @brief A 4-byte counting semaphore.
+    ///
+    /// Acquiring an available count is a single compare-and-swap, and releasing only enters
+    /// the kernel if a thread may be sleeping on the semaphore. The count is limited to
+    /// `futex_semaphore::max()`.
+    ///
+    /// @ingroup futex
+    /// @headerfile hyperion/platform/futex.h
+    class futex_semaphore {
+      public:
+        /// @brief Constructs a `futex_semaphore` with the given initial count
+        /// @param count The initial count
+        /// @pre `count <= futex_semaphore::max()`
+        explicit constexpr futex_semaphore(u32 count = 0_u32) noexcept
+            : m_state{count} {
+        }
+        futex_semaphore(const futex_semaphore&) = delete;
+        futex_semaphore(futex_semaphore&&) = delete;
+        ~futex_semaphore() noexcept = default;
+        auto operator=(const futex_semaphore&) -> futex_semaphore& = delete;
+        auto operator=(futex_semaphore&&) -> futex_semaphore& = delete;
+
+        /// @brief Returns the maximum count of a `futex_semaphore`
+        /// @return The maximum count
+        [[nodiscard]] static constexpr auto max() noexcept -> u32 {
+            return k_count_mask;
+        }
+
+        /// @brief Increments the count by `update`, waking waiters if necessary
+        /// @param update The amount to increment by
+        /// @pre The resulting count does not exceed `max()`
+        auto release(u32 update = 1_u32) noexcept -> void {
+            if((m_state.fetch_add(update, std::memory_order_release) & k_waiters) != 0_u32) {
+                // waiters that lose the race for the new count will re-flag themselves
+                m_state.fetch_and(~k_waiters, std::memory_order_relaxed);
+                detail::futex::wake_all(m_state);
+            }
+        }
+
+        /// @brief Attempts to decrement the count without blocking
+        /// @return Whether the count was decremented
+        [[nodiscard]] auto try_acquire() noexcept -> bool {
+            auto state = m_state.load(std::memory_order_relaxed);
+            while((state & k_count_mask) != 0_u32) {
+                if(m_state.compare_exchange_weak(state,
+                                                 state - 1_u32,
+                                                 std::memory_order_acquire,
+                                                 std::memory_order_relaxed))
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        /// @brief Decrements the count, blocking until it is greater than zero
+        auto acquire() noexcept -> void {
+            if(try_acquire()) [[likely]] {
+                return;
+            }
+
+            if(detail::futex::spin_until([this]() noexcept { return try_acquire(); })) {
+                return;
+            }
+
+            while(true) {
+                auto state = m_state.load(std::memory_order_relaxed);
+                if((state & k_count_mask) != 0_u32) {
+                    if(m_state.compare_exchange_weak(state,
+                                                     state - 1_u32,
+                                                     std::memory_order_acquire,
+                                                     std::memory_order_relaxed))
+                    {
+                        return;
+                    }
+                    continue;
+                }
+
+                if((state & k_waiters) == 0_u32
+                   && !m_state.compare_exchange_weak(state,
+                                                     state | k_waiters,
+                                                     std::memory_order_relaxed,
+                                                     std::memory_order_relaxed))
+                {
+                    continue;
+                }
+
+                detail::futex::wait(m_state, k_waiters);
+            }
+        }
+
+        /// @brief Returns the current count
+        /// @return The current count
+        [[nodiscard]] auto count() const noexcept -> u32 {
+            return m_state.load(std::memory_order_relaxed) & k_count_mask;
+        }
+
+      private:
+        // the high bit flags possible waiters, the remaining bits are the count
+        static constexpr auto k_waiters = 1_u32 << 31_u32;
+        static constexpr auto k_count_mask = ~k_waiters;
+
+        std::atomic<u32> m_state;
+    };
+
+    static_assert(sizeof(futex_mutex) == 4_usize, "futex_mutex must be 4 bytes");
+    static_assert(sizeof(futex_condition_variable) == 4_usize,
+                  "futex_condition_variable must be 4 bytes");
+    static_assert(sizeof(futex_event) == 4_usize, "futex_event must be 4 bytes");
+    static_assert(sizeof(futex_semaphore) == 4_usize, "futex_semaphore must be 4 bytes");
+
+} // namespace hyperion::platform
+
+#if defined(HYPERION_ENABLE_TESTING) && HYPERION_ENABLE_TESTING
+
+    #include <boost/ut.hpp>
+
+    #include <mutex>
+    #include <vector>
+
+namespace hyperion::_test::platform::futex {
+
+    // NOLINTNEXTLINE(google-build-using-namespace)
+    using namespace boost::ut;
+
+    // NOLINTNEXTLINE(cert-err58-cpp)
+    static const suite<"hyperion::platform::futex"> futex_tests = [] {
+        "mutex"_test = [] {
+            constexpr auto threads = 4_usize;
+            constexpr auto increments = 20000_usize;
+
+            hyperion::platform::futex_mutex mutex;
+            expect(that % mutex.try_lock());
+            expect(that % !mutex.try_lock());
+            mutex.unlock();
+
+            auto counter = 0_usize;
+            std::vector<std::thread> workers;
+            workers.reserve(threads);
+            for(auto index = 0_usize; index < threads; ++index) {
+                workers.emplace_back([&]() {
+                    for(auto increment = 0_usize; increment < increments; ++increment) {
+                        const auto guard = std::scoped_lock{mutex};
+                        ++counter;
+                    }
+                });
+            }
+
+            for(auto& worker : workers) {
+                worker.join();
+            }
+
+            expect(that % counter == threads * increments);
+        };
+
+        "condition_variable"_test = [] {
+            constexpr auto items = 1000_usize;
+
+            hyperion::platform::futex_mutex mutex;
+            hyperion::platform::futex_condition_variable condition;
+            std::vector<usize> queue;
+            auto consumed = 0_usize;
+            auto sum = 0_usize;
+
+            std::thread consumer{[&]() {
+                auto lock = std::unique_lock{mutex};
+                while(consumed < items) {
+                    condition.wait(lock, [&]() { return !queue.empty(); });
+                    for(const auto item : queue) {
+                        sum += item;
+                    }
+                    consumed += queue.size();
+                    queue.clear();
+                }
+            }};
+
+            for(auto item = 1_usize; item <= items; ++item) {
+                {
+                    const auto guard = std::scoped_lock{mutex};
+                    queue.push_back(item);
+                }
+                condition.notify_one();
+            }
+
+            consumer.join();
+            expect(that % sum == items * (items + 1_usize) / 2_usize);
+        };
+
+        "event"_test = [] {
+            constexpr auto threads = 4_usize;
+
+            hyperion::platform::futex_event event;
+            expect(that % !event.is_set());
+
+            std::atomic<usize> woken = 0_usize;
+            std::vector<std::thread> waiters;
+            waiters.reserve(threads);
+            for(auto index = 0_usize; index < threads; ++index) {
+                waiters.emplace_back([&]() {
+                    event.wait();
+                    woken.fetch_add(1_usize, std::memory_order_relaxed);
+                });
+            }
+
+            event.set();
+            for(auto& waiter : waiters) {
+                waiter.join();
+            }
+
+            expect(that % woken.load() == threads);
+            expect(that % event.is_set());
+            event.reset();
+            expect(that % !event.is_set());
+
+            hyperion::platform::futex_event initially_set{true};
+            initially_set.wait();
+            expect(that % initially_set.is_set());
+        };
+
+        "semaphore"_test = [] {
+            constexpr auto threads = 4_usize;
+            constexpr auto rounds = 2000_usize;
+
+            hyperion::platform::futex_semaphore semaphore{2_u32};
+            expect(that % semaphore.try_acquire());
+            expect(that % semaphore.try_acquire());
+            expect(that % !semaphore.try_acquire());
+            semaphore.release(2_u32);
+            expect(that % semaphore.count() == 2_u32);
+
+            // at most two threads may hold the semaphore at a time
+            std::atomic<u32> holders = 0_u32;
+            std::atomic<bool> exceeded = false;
+            std::vector<std::thread> workers;
+            workers.reserve(threads);
+            for(auto index = 0_usize; index < threads; ++index) {
+                workers.emplace_back([&]() {
+                    for(auto round = 0_usize; round < rounds; ++round) {
+                        semaphore.acquire();
+                        if(holders.fetch_add(1_u32, std::memory_order_relaxed) >= 2_u32) {
+                            exceeded.store(true, std::memory_order_relaxed);
+                        }
+                        holders.fetch_sub(1_u32, std::memory_order_relaxed);
+                        semaphore.release();
+                    }
+                });
+            }
+
+            for(auto& worker : workers) {
+                worker.join();
+            }
+
+            expect(that % !exceeded.load());
+            expect(that % semaphore.count() == 2_u32);
+        };
+    };
+
+} // namespace hyperion::_test::platform::futex
+
+#endif // defined(HYPERION_ENABLE_TESTING) && HYPERION_ENABLE_TESTING
+
+#endif // HYPERION_PLATFORM_FUTEX_H
@@ -0,0 +1,176 @@
+/// @file hash.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Fast non-cryptographic hashing of integers and byte sequences
+/// @version 0.4.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2024 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef HYPERION_PLATFORM_HASH_H
+#define HYPERION_PLATFORM_HASH_H
+
+#include <hyperion/platform.h>
+#include <hyperion/platform/types.h>
+
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <span>
+#include <string_view>
+
+/// @ingroup platform
+/// @{
+///	@defgroup hash Hashing
+/// Hyperion provides small, fast, non-cryptographic hash functions for use by its probabilistic
+/// data structures, and by any code that needs well-distributed 64-bit hashes.
+///
+/// `hyperion::hash_mix` is a bijective mixer for 64-bit integers: distinct inputs always produce
+/// distinct outputs, and every input bit affects every output bit. `hyperion::hash_bytes` and
+/// `hyperion::hash_string` hash arbitrary byte sequences.
+///
+/// These hashes are not resistant to deliberately crafted collisions and must not be used
+/// where inputs are adversarial. Byte sequence hashes read 8-byte words in native byte order,
+/// so they differ between little- and big-endian platforms.
+///
+/// # Example
+/// @code {.cpp}
+/// const auto user_hash = hyperion::hash_mix(user_id);
+/// const auto name_hash = hyperion::hash_string("http.requests");
+/// @endcode
+/// @headerfile hyperion/platform/hash.h
+/// @}
+
+namespace hyperion {
+
+    /// @brief Mixes the bits of `value`, returning a well-distributed 64-bit hash.
+    ///
+    /// This is the finalizer of MurmurHash3. It is a bijection, so distinct values never
+    /// collide.
+    /// @param value The value to hash
+    /// @return The hash of `value`
+    /// @ingroup hash
+    /// @headerfile hyperion/platform/hash.h
+    [[nodiscard]] constexpr auto hash_mix(u64 value) noexcept -> u64 {
+        value ^= value >> 33U;
+        value *= 0xFF51AFD7ED558CCDULL;
+        value ^= value >> 33U;
+        value *= 0xC4CEB9FE1A85EC53ULL;
+        value ^= value >> 33U;
+        return value;
+    }
+
+    namespace detail::hash {
+        [[nodiscard]] constexpr auto absorb(u64 state, u64 word) noexcept -> u64 {
+            word *= 0x87C37B91114253D5ULL;
+            word = std::rotl(word, 31);
+            word *= 0x4CF5AD432745937FULL;
+            state ^= word;
+            return std::rotl(state, 27) * 5_u64 + 0x52DCE729_u64;
+        }
+    } // namespace detail::hash
+
+    /// @brief Hashes the byte sequence `bytes`.
+    ///
+    /// The bytes are consumed as 8-byte words, each scrambled and folded into the running state
+    /// in the style of MurmurHash3, then the state is finalized with `hash_mix`.
+    /// @param bytes The bytes to hash
+    /// @param seed The seed to start from, allowing independent hash functions to be derived
+    /// @return The hash of `bytes`
+    /// @ingroup hash
+    /// @headerfile hyperion/platform/hash.h
+    [[nodiscard]] inline auto
+    hash_bytes(std::span<const std::byte> bytes, u64 seed = 0_u64) noexcept -> u64 {
+        auto state = seed ^ (static_cast<u64>(bytes.size()) * 0x9E3779B97F4A7C15_u64);
+        auto offset = 0_usize;
+        for(; offset + sizeof(u64) <= bytes.size(); offset += sizeof(u64)) {
+            auto word = 0_u64;
+            std::memcpy(&word, bytes.data() + offset, sizeof(u64));
+            state = detail::hash::absorb(state, word);
+        }
+
+        if(offset != bytes.size()) {
+            auto word = 0_u64;
+            std::memcpy(&word, bytes.data() + offset, bytes.size() - offset);
+            state = detail::hash::absorb(state, word);
+        }
+
+        return hash_mix(state ^ static_cast<u64>(bytes.size()));
+    }
+
+    /// @brief Hashes the characters of `string`
+    /// @param string The string to hash
+    /// @param seed The seed to start from, allowing independent hash functions to be derived
+    /// @return The hash of `string`
+    /// @ingroup hash
+    /// @headerfile hyperion/platform/hash.h
+    [[nodiscard]] inline auto
+    hash_string(std::string_view string, u64 seed = 0_u64) noexcept -> u64 {
+        return hash_bytes(std::as_bytes(std::span{string.data(), string.size()}), seed);
+    }
+
+} // namespace hyperion
+
+#if defined(HYPERION_ENABLE_TESTING) && HYPERION_ENABLE_TESTING
+
+    #include <boost/ut.hpp>
+
+    #include <string>
+    #include <unordered_set>
+
+namespace hyperion::_test::platform::hash {
+
+    static_assert(hyperion::hash_mix(0_u64) == 0_u64);
+    static_assert(hyperion::hash_mix(1_u64) != hyperion::hash_mix(2_u64));
+
+    // NOLINTNEXTLINE(google-build-using-namespace)
+    using namespace boost::ut;
+
+    // NOLINTNEXTLINE(cert-err58-cpp)
+    static const suite<"hyperion::platform::hash"> hash_tests = [] {
+        "hash_string"_test = [] {
+            expect(that % hyperion::hash_string("hyperion") == hyperion::hash_string("hyperion"));
+            expect(that % hyperion::hash_string("hyperion") != hyperion::hash_string("hyperioN"));
+            expect(that % hyperion::hash_string("abc") != hyperion::hash_string("abc", 1_u64));
+            // trailing zero bytes must still change the hash
+            expect(that % hyperion::hash_string({"a\0", 2}) != hyperion::hash_string("a"));
+            expect(that % hyperion::hash_string("") != hyperion::hash_string({"\0", 1}));
+        };
+
+        "hash_string_distribution"_test = [] {
+            auto hashes = std::unordered_set<u64>{};
+            auto low_bits = std::unordered_set<u64>{};
+            for(auto index = 0; index < 10'000; ++index) {
+                const auto hash = hyperion::hash_string("key." + std::to_string(index));
+                hashes.insert(hash);
+                low_bits.insert(hash & 0x3FFF_u64);
+            }
+            expect(that % hashes.size() == 10'000_usize);
+            // 10'000 keys in 16'384 buckets should fill roughly 7'300 of them
+            expect(that % low_bits.size() > 6'800_usize);
+        };
+    };
+
+} // namespace hyperion::_test::platform::hash
+
+#endif // defined(HYPERION_ENABLE_TESTING) && HYPERION_ENABLE_TESTING
+
+#endif // HYPERION_PLATFORM_HASH_H
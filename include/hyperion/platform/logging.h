@@ -0,0 +1,1530 @@
+/// @file logging.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Asynchronous, binary logging with deferred formatting
+/// @version 0.4.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2024 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef HYPERION_PLATFORM_LOGGING_H
+#define HYPERION_PLATFORM_LOGGING_H
+
+#include <hyperion/platform.h>
+#include <hyperion/platform/coarse_clock.h>
+#include <hyperion/platform/def.h>
+#include <hyperion/platform/types.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <charconv>
+#include <chrono>
+#include <concepts>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#if HYPERION_STD_LIB_HAS_SOURCE_LOCATION
+    #include <source_location>
+#endif // HYPERION_STD_LIB_HAS_SOURCE_LOCATION
+
+/// @ingroup platform
+/// @{
+///	@defgroup logging Logging
+/// Hyperion provides an asynchronous logger that moves all formatting and I/O off of the
+/// logging thread.
+///
+/// Each `HYPERION_LOG` call site registers its metadata (level, format string, source location
+/// and argument types) at compile time in a `static constexpr` `hyperion::log_site`. At runtime,
+/// a log call only copies a pointer to that site, a timestamp (from
+/// `hyperion::platform::coarse_clock`), and the raw bytes of its arguments into a lock-free,
+/// single-producer ring buffer owned by the calling thread. A background thread drains the
+/// per-thread buffers into a `hyperion::log_sink`, which either formats the records as text
+/// (`hyperion::text_log_sink`) or dumps them as a self-describing binary stream for offline
+/// decoding (`hyperion::binary_log_sink` and `hyperion::decode_binary_log`).
+///
+/// Format strings use `{}` as the placeholder for each argument (with `{{` and `}}` as escaped
+/// braces), and the number of placeholders is checked against the number of arguments at
+/// compile time. Arguments may be booleans, characters, integers, floating point numbers,
+/// enums, strings (which are copied) and pointers (which are logged as addresses).
+///
+/// If a thread's buffer is full, its log calls are dropped rather than blocking, and the number
+/// of dropped records is reported by `hyperion::logger::dropped`.
+///
+/// # Example
+/// @code {.cpp}
+/// auto main() -> int {
+///     auto sink = hyperion::text_log_sink{stderr};
+///     auto& logger = hyperion::logger::global();
+///     logger.set_sink(&sink);
+///     logger.start();
+///
+///     HYPERION_LOG_INFO("accepted connection {} from {}", connection_id, address);
+///
+///     logger.stop();
+/// }
+/// @endcode
+/// @headerfile hyperion/platform/logging.h
+/// @}
+
+/// @def HYPERION_LOG_THREAD_BUFFER_SIZE
+/// @brief The size, in bytes, of each thread's log buffer. Must be a power of two.
+/// Defaults to 64KiB. Define this prior to including any Hyperion headers to change it.
+/// @ingroup logging
+/// @headerfile hyperion/platform/logging.h
+#ifndef HYPERION_LOG_THREAD_BUFFER_SIZE
+    #define HYPERION_LOG_THREAD_BUFFER_SIZE 65536 // NOLINT(cppcoreguidelines-macro-usage)
+#endif // HYPERION_LOG_THREAD_BUFFER_SIZE
+
+namespace hyperion {
+
+    /// @brief The severity of a log message
+    /// @ingroup logging
+    /// @headerfile hyperion/platform/logging.h
+    enum class LogLevel : u8 {
+        Trace = 0,
+        Debug,
+        Info,
+        Warn,
+        Error
+    };
+
+    /// @brief Returns the name of the given `LogLevel`
+    /// @param level The log level
+    /// @return The name of `level`
+    /// @ingroup logging
+    /// @headerfile hyperion/platform/logging.h
+    [[nodiscard]] constexpr auto log_level_name(LogLevel level) noexcept -> std::string_view {
+        switch(level) {
+            case LogLevel::Trace: return "TRACE";
+            case LogLevel::Debug: return "DEBUG";
+            case LogLevel::Info: return "INFO";
+            case LogLevel::Warn: return "WARN";
+            case LogLevel::Error: return "ERROR";
+        }
+        return "UNKNOWN";
+    }
+
+    /// @brief The compile-time metadata of a log call site
+    /// @ingroup logging
+    /// @headerfile hyperion/platform/logging.h
+    struct log_site {
+        /// @brief The severity of messages logged at this site
+        LogLevel level;
+        /// @brief The format string
+        std::string_view format;
+        /// @brief One type code per argument, describing how its bytes are encoded
+        std::string_view signature;
+        /// @brief The source file of the call site
+        std::string_view file;
+        /// @brief The source line of the call site
+        u32 line;
+    };
+
+    /// @brief A single log record, as delivered to a `log_sink`
+    /// @ingroup logging
+    /// @headerfile hyperion/platform/logging.h
+    struct log_record {
+        /// @brief The call site the record was logged from
+        const log_site* site;
+        /// @brief The time the record was logged at, in `platform::coarse_clock` nanoseconds
+        i64 timestamp;
+        /// @brief The index of the thread that logged the record, in order of each thread's
+        /// first log call
+        u32 thread;
+        /// @brief The encoded arguments
+        std::span<const byte> payload;
+    };
+
+    namespace detail::logging {
+        static inline constexpr auto k_buffer_size
+            = static_cast<usize>(HYPERION_LOG_THREAD_BUFFER_SIZE);
+        static_assert(std::has_single_bit(k_buffer_size) && k_buffer_size >= 1024_usize,
+                      "HYPERION_LOG_THREAD_BUFFER_SIZE must be a power of two of at least 1024");
+
+        static inline constexpr auto k_invalid_format = std::numeric_limits<usize>::max();
+
+        /// @brief Returns the number of `{}` placeholders in `format`, or `k_invalid_format` if
+        /// it contains an unescaped brace that is not part of a placeholder
+        [[nodiscard]] constexpr auto count_placeholders(std::string_view format) noexcept -> usize {
+            auto count = 0_usize;
+            for(auto index = 0_usize; index < format.size(); ++index) {
+                const auto current = format[index];
+                if(current != '{' && current != '}') {
+                    continue;
+                }
+
+                const auto next = index + 1_usize < format.size() ? format[index + 1_usize] : '\0';
+                if(current == '{' && next == '}') {
+                    ++count;
+                }
+                else if(current != next) {
+                    return k_invalid_format;
+                }
+                ++index;
+            }
+
+            return count;
+        }
+
+        /// @brief Converts a log argument to the canonical type it is encoded as
+        template<typename TType>
+        [[nodiscard]] constexpr auto normalize(const TType& value) noexcept {
+            using type = std::remove_cvref_t<TType>;
+            if constexpr(std::same_as<type, bool> || std::same_as<type, char>) {
+                return value;
+            }
+            else if constexpr(std::is_enum_v<type>) {
+                return normalize(static_cast<std::underlying_type_t<type>>(value));
+            }
+            else if constexpr(std::signed_integral<type>) {
+                return static_cast<i64>(value);
+            }
+            else if constexpr(std::unsigned_integral<type>) {
+                return static_cast<u64>(value);
+            }
+            else if constexpr(std::floating_point<type>) {
+                return static_cast<f64>(value);
+            }
+            else if constexpr(std::same_as<std::decay_t<type>, const char*>
+                              || std::same_as<std::decay_t<type>, char*>)
+            {
+                return value == nullptr ? std::string_view{"(null)"} : std::string_view{value};
+            }
+            else if constexpr(std::convertible_to<const type&, std::string_view>) {
+                return std::string_view{value};
+            }
+            else if constexpr(std::is_pointer_v<type> || std::is_null_pointer_v<type>) {
+                return static_cast<const void*>(value);
+            }
+            else {
+                static_assert(std::is_pointer_v<type>, "Unsupported log argument type");
+            }
+        }
+
+        template<typename TType>
+        using normalized_t = decltype(normalize(std::declval<const TType&>()));
+
+        template<typename TType>
+        [[nodiscard]] consteval auto type_code() noexcept -> char {
+            if constexpr(std::same_as<TType, bool>) {
+                return 'b';
+            }
+            else if constexpr(std::same_as<TType, char>) {
+                return 'c';
+            }
+            else if constexpr(std::same_as<TType, i64>) {
+                return 'i';
+            }
+            else if constexpr(std::same_as<TType, u64>) {
+                return 'u';
+            }
+            else if constexpr(std::same_as<TType, f64>) {
+                return 'f';
+            }
+            else if constexpr(std::same_as<TType, std::string_view>) {
+                return 's';
+            }
+            else {
+                return 'p';
+            }
+        }
+
+        template<typename... TArgs>
+        static inline constexpr auto signature
+            = std::array<char, sizeof...(TArgs) + 1_usize>{type_code<TArgs>()..., '\0'};
+
+        static inline constexpr auto k_scalar_size = sizeof(u64);
+
+        template<typename TType>
+        [[nodiscard]] constexpr auto encoded_size(const TType& value) noexcept -> usize {
+            if constexpr(std::same_as<TType, std::string_view>) {
+                return sizeof(u32) + value.size();
+            }
+            else {
+                return k_scalar_size;
+            }
+        }
+
+        template<typename TType>
+        auto encode(byte* out, const TType& value) noexcept -> byte* {
+            if constexpr(std::same_as<TType, std::string_view>) {
+                const auto size = static_cast<u32>(value.size());
+                std::memcpy(out, &size, sizeof(size));
+                std::memcpy(out + sizeof(size), value.data(), value.size()); // NOLINT
+                return out + sizeof(size) + value.size(); // NOLINT
+            }
+            else {
+                auto bits = 0_u64;
+                if constexpr(std::same_as<TType, const void*>) {
+                    // NOLINTNEXTLINE(*-reinterpret-cast)
+                    bits = static_cast<u64>(reinterpret_cast<std::uintptr_t>(value));
+                }
+                else if constexpr(std::same_as<TType, bool> || std::same_as<TType, char>) {
+                    bits = static_cast<u64>(static_cast<unsigned char>(value));
+                }
+                else {
+                    bits = std::bit_cast<u64>(value);
+                }
+                std::memcpy(out, &bits, sizeof(bits));
+                return out + sizeof(bits); // NOLINT(*-pointer-arithmetic)
+            }
+        }
+
+        /// @brief Reads the scalar at `offset` in `payload`, advancing `offset` past it
+        [[nodiscard]] inline auto
+        read_scalar(std::span<const byte> payload, usize& offset, u64& out) noexcept -> bool {
+            if(offset > payload.size() || payload.size() - offset < k_scalar_size) {
+                return false;
+            }
+
+            std::memcpy(&out, payload.data() + offset, sizeof(out)); // NOLINT
+            offset += k_scalar_size;
+            return true;
+        }
+
+        template<typename TType>
+        auto append_number(std::string& out, TType value) -> void {
+            auto buffer = std::array<char, 32>{};
+            const auto result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+            out.append(buffer.data(), result.ptr);
+        }
+
+        /// @brief Formats the argument with type `code` at `offset` in `payload` into `out`
+        [[nodiscard]] inline auto append_argument(char code,
+                                                  std::span<const byte> payload,
+                                                  usize& offset,
+                                                  std::string& out) -> bool {
+            if(code == 's') {
+                auto size = 0_u32;
+                if(offset > payload.size() || payload.size() - offset < sizeof(size)) {
+                    return false;
+                }
+                std::memcpy(&size, payload.data() + offset, sizeof(size)); // NOLINT
+                offset += sizeof(size);
+                if(payload.size() - offset < size) {
+                    return false;
+                }
+                // NOLINTNEXTLINE(*-reinterpret-cast, *-pointer-arithmetic)
+                out.append(reinterpret_cast<const char*>(payload.data() + offset), size);
+                offset += size;
+                return true;
+            }
+
+            auto bits = 0_u64;
+            if(!read_scalar(payload, offset, bits)) {
+                return false;
+            }
+
+            switch(code) {
+                case 'b': out.append(bits != 0_u64 ? "true" : "false"); return true;
+                case 'c': out.push_back(static_cast<char>(bits)); return true;
+                case 'i': append_number(out, std::bit_cast<i64>(bits)); return true;
+                case 'u': append_number(out, bits); return true;
+                case 'f': append_number(out, std::bit_cast<f64>(bits)); return true;
+                case 'p': {
+                    auto buffer = std::array<char, 16>{};
+                    const auto result
+                        = std::to_chars(buffer.data(), buffer.data() + buffer.size(), bits, 16);
+                    out.append("0x");
+                    out.append(buffer.data(), result.ptr);
+                    return true;
+                }
+                default: return false;
+            }
+        }
+
+        HYPERION_IGNORE_PADDING_WARNING_START;
+
+        struct record_header {
+            u32 size;
+            u32 payload_size;
+            const log_site* site;
+            i64 timestamp;
+        };
+
+        HYPERION_IGNORE_PADDING_WARNING_STOP;
+
+        // marks the remainder of the buffer before wrapping around as unused
+        static inline constexpr auto k_padding_flag = 1_u32 << 31_u32;
+        static inline constexpr auto k_record_alignment = alignof(u64);
+
+        [[nodiscard]] constexpr auto record_size(usize payload_size) noexcept -> usize {
+            const auto size = sizeof(record_header) + payload_size;
+            return (size + k_record_alignment - 1_usize) & ~(k_record_alignment - 1_usize);
+        }
+
+        HYPERION_IGNORE_PADDING_WARNING_START;
+
+        /// @brief A single-producer, single-consumer ring buffer of log records
+        class thread_buffer {
+          public:
+            explicit thread_buffer(u32 thread)
+                : m_data{std::make_unique<byte[]>(k_buffer_size)}, // NOLINT(*-avoid-c-arrays)
+                  m_thread{thread} {
+            }
+
+            /// @brief Reserves `size` contiguous bytes for a record. Producer only.
+            [[nodiscard]] auto reserve(usize size) noexcept -> byte* {
+                const auto tail = m_tail.load(std::memory_order_relaxed);
+                const auto offset = tail & (k_buffer_size - 1_usize);
+                const auto to_end = k_buffer_size - offset;
+                const auto needed = size <= to_end ? size : size + to_end;
+
+                if(size > k_buffer_size / 2_usize) [[unlikely]] {
+                    return nullptr;
+                }
+
+                if(needed > k_buffer_size - (tail - m_cached_head)) {
+                    m_cached_head = m_head.load(std::memory_order_acquire);
+                    if(needed > k_buffer_size - (tail - m_cached_head)) {
+                        return nullptr;
+                    }
+                }
+
+                if(size > to_end) {
+                    const auto padding = static_cast<u32>(to_end) | k_padding_flag;
+                    std::memcpy(m_data.get() + offset, &padding, sizeof(padding)); // NOLINT
+                    m_reserved_tail = tail + to_end + size;
+                    return m_data.get();
+                }
+
+                m_reserved_tail = tail + size;
+                return m_data.get() + offset; // NOLINT(*-pointer-arithmetic)
+            }
+
+            /// @brief Publishes the last reserved record. Producer only.
+            auto commit() noexcept -> void {
+                m_tail.store(m_reserved_tail, std::memory_order_release);
+            }
+
+            /// @brief Records that a log call was dropped. Producer only.
+            auto drop() noexcept -> void {
+                m_dropped.store(m_dropped.load(std::memory_order_relaxed) + 1_u64,
+                                std::memory_order_relaxed);
+            }
+
+            /// @brief Marks the owning thread as exited. Producer only.
+            auto close() noexcept -> void {
+                m_closed.store(true, std::memory_order_release);
+            }
+
+            /// @brief Invokes `on_record` for each published record. Consumer only.
+            /// @return The number of records consumed
+            template<typename TFunc>
+            auto consume(TFunc&& on_record) -> usize {
+                auto head = m_head.load(std::memory_order_relaxed);
+                const auto tail = m_tail.load(std::memory_order_acquire);
+                auto consumed = 0_usize;
+
+                while(head != tail) {
+                    const auto* data = m_data.get() + (head & (k_buffer_size - 1_usize)); // NOLINT
+                    auto size = 0_u32;
+                    std::memcpy(&size, data, sizeof(size));
+                    if((size & k_padding_flag) != 0_u32) {
+                        head += size & ~k_padding_flag;
+                        continue;
+                    }
+
+                    auto header = record_header{};
+                    std::memcpy(&header, data, sizeof(header));
+                    // NOLINTNEXTLINE(*-pointer-arithmetic)
+                    const auto payload = std::span<const byte>{data + sizeof(header),
+                                                               header.payload_size};
+                    on_record(log_record{header.site, header.timestamp, m_thread, payload});
+                    head += header.size;
+                    ++consumed;
+                }
+
+                m_head.store(head, std::memory_order_release);
+                return consumed;
+            }
+
+            /// @brief Returns whether the owning thread has exited and every record it logged
+            /// has been consumed. Consumer only.
+            [[nodiscard]] auto is_finished() const noexcept -> bool {
+                return m_closed.load(std::memory_order_acquire)
+                       && m_tail.load(std::memory_order_acquire)
+                              == m_head.load(std::memory_order_relaxed);
+            }
+
+            [[nodiscard]] auto dropped() const noexcept -> u64 {
+                return m_dropped.load(std::memory_order_relaxed);
+            }
+
+          private:
+            std::unique_ptr<byte[]> m_data; // NOLINT(*-avoid-c-arrays)
+            u32 m_thread;
+            std::atomic<bool> m_closed = false;
+            std::atomic<u64> m_dropped = 0_u64;
+            alignas(HYPERION_PLATFORM_CACHE_LINE_SIZE) std::atomic<usize> m_head = 0_usize;
+            alignas(HYPERION_PLATFORM_CACHE_LINE_SIZE) std::atomic<usize> m_tail = 0_usize;
+            usize m_cached_head = 0_usize;
+            usize m_reserved_tail = 0_usize;
+        };
+
+        HYPERION_IGNORE_PADDING_WARNING_STOP;
+
+        /// @brief The source of `logger` identifiers. Identifiers are never reused, so a thread's
+        /// buffer for a destroyed logger can't be mistaken for one belonging to a later logger
+        /// constructed at the same address.
+        // NOLINTNEXTLINE(*-avoid-non-const-global-variables)
+        inline constinit std::atomic<u64> g_next_logger_id = 1_u64;
+
+        /// @brief The calling thread's log buffers, one per logger it has written to, closed when
+        /// the thread exits. Each buffer is shared with its logger, so it remains valid for
+        /// whichever of the two outlives the other.
+        struct producer {
+            struct entry {
+                u64 logger;
+                std::shared_ptr<thread_buffer> buffer;
+            };
+
+            /// @brief The identifier of the logger `buffer` belongs to
+            u64 logger = 0_u64;
+            /// @brief The buffer of the logger this thread most recently wrote to
+            thread_buffer* buffer = nullptr;
+            std::vector<entry> entries;
+            bool exited = false;
+
+            constexpr producer() noexcept = default;
+            producer(const producer&) = delete;
+            producer(producer&&) = delete;
+            ~producer() noexcept {
+                for(const auto& current : entries) {
+                    current.buffer->close();
+                }
+                entries.clear();
+                logger = 0_u64;
+                buffer = nullptr;
+                exited = true;
+            }
+            auto operator=(const producer&) -> producer& = delete;
+            auto operator=(producer&&) -> producer& = delete;
+
+            /// @brief Returns this thread's buffer for the logger with the given identifier, if
+            /// it has one
+            [[nodiscard]] auto find(u64 id) const noexcept -> thread_buffer* {
+                for(const auto& current : entries) {
+                    if(current.logger == id) {
+                        return current.buffer.get();
+                    }
+                }
+                return nullptr;
+            }
+
+            /// @brief Releases the buffers of loggers that have since been destroyed
+            auto prune() noexcept -> void {
+                std::erase_if(entries,
+                              [](const entry& current) { return current.buffer.use_count() == 1; });
+            }
+        };
+
+        inline thread_local producer t_producer; // NOLINT(*-avoid-non-const-global-variables)
+
+        /// @brief A source position, taken from `std::source_location` where available
+        struct source_position {
+            std::string_view file;
+            u32 line;
+        };
+
+        /// @brief The metadata of a log call site known before its argument types are
+        struct site_info {
+            LogLevel level;
+            std::string_view format;
+            source_position position;
+        };
+    } // namespace detail::logging
+
+    /// @brief Formats a log message, substituting its encoded arguments into its format string
+    /// @param format The format string, e.g. `log_site::format`
+    /// @param signature The argument type codes, e.g. `log_site::signature`
+    /// @param payload The encoded arguments, e.g. `log_record::payload`
+    /// @param out The string to append the message to
+    /// @return Whether the format string and payload were well-formed
+    /// @ingroup logging
+    /// @headerfile hyperion/platform/logging.h
+    [[nodiscard]] inline auto format_message(std::string_view format,
+                                             std::string_view signature,
+                                             std::span<const byte> payload,
+                                             std::string& out) -> bool {
+        auto argument = 0_usize;
+        auto offset = 0_usize;
+        for(auto index = 0_usize; index < format.size(); ++index) {
+            const auto current = format[index];
+            const auto next = index + 1_usize < format.size() ? format[index + 1_usize] : '\0';
+            if(current == '{' && next == '}') {
+                if(argument >= signature.size()
+                   || !detail::logging::append_argument(signature[argument], payload, offset, out))
+                {
+                    return false;
+                }
+                ++argument;
+                ++index;
+            }
+            else if(current == '{' || current == '}') {
+                if(next != current) {
+                    return false;
+                }
+                out.push_back(current);
+                ++index;
+            }
+            else {
+                out.push_back(current);
+            }
+        }
+
+        return argument == signature.size();
+    }
+
+    /// @brief Receives log records from the `logger`'s backend.
+    ///
+    /// `consume` and `flush` are only ever called by one thread at a time.
+    /// @ingroup logging
+    /// @headerfile hyperion/platform/logging.h
+    class log_sink {
+      public:
+        log_sink() noexcept = default;
+        log_sink(const log_sink&) = delete;
+        log_sink(log_sink&&) = delete;
+        virtual ~log_sink() noexcept = default;
+        auto operator=(const log_sink&) -> log_sink& = delete;
+        auto operator=(log_sink&&) -> log_sink& = delete;
+
+        /// @brief Processes a single log record
+        /// @param record The record
+        virtual auto consume(const log_record& record) -> void = 0;
+
+        /// @brief Flushes any output buffered by the sink
+        virtual auto flush() -> void {
+        }
+    };
+
+    /// @brief A `log_sink` that formats records as lines of text and writes them to a file
+    /// @ingroup logging
+    /// @headerfile hyperion/platform/logging.h
+    class text_log_sink final : public log_sink {
+      public:
+        /// @brief Constructs a `text_log_sink` writing to `file`
+        /// @param file The file to write to. Must outlive the sink.
+        explicit text_log_sink(std::FILE* file) noexcept
+            : m_file{file} {
+        }
+
+        text_log_sink(const text_log_sink&) = delete;
+        text_log_sink(text_log_sink&&) = delete;
+        ~text_log_sink() noexcept final = default;
+        auto operator=(const text_log_sink&) -> text_log_sink& = delete;
+        auto operator=(text_log_sink&&) -> text_log_sink& = delete;
+
+        auto consume(const log_record& record) -> void final {
+            const auto& site = *record.site;
+            const auto micros = record.timestamp / 1000_i64;
+
+            m_line.clear();
+            m_line.push_back('[');
+            detail::logging::append_number(m_line, micros / 1'000'000_i64);
+            m_line.push_back('.');
+            auto fraction = std::array<char, 6>{'0', '0', '0', '0', '0', '0'};
+            auto remainder = micros % 1'000'000_i64;
+            for(auto digit = fraction.rbegin(); digit != fraction.rend(); ++digit) {
+                *digit = static_cast<char>('0' + remainder % 10_i64);
+                remainder /= 10_i64;
+            }
+            m_line.append(fraction.data(), fraction.size());
+            m_line.append("] [");
+            m_line.append(log_level_name(site.level));
+            m_line.append("] [");
+            detail::logging::append_number(m_line, record.thread);
+            m_line.append("] ");
+            const auto separator = site.file.find_last_of("/\\");
+            m_line.append(separator == std::string_view::npos ? site.file
+                                                               : site.file.substr(separator + 1));
+            m_line.push_back(':');
+            detail::logging::append_number(m_line, site.line);
+            m_line.append(": ");
+            if(!format_message(site.format, site.signature, record.payload, m_line)) {
+                m_line.append("<malformed log record>");
+            }
+            m_line.push_back('\n');
+
+            std::fwrite(m_line.data(), 1, m_line.size(), m_file);
+        }
+
+        auto flush() -> void final {
+            std::fflush(m_file);
+        }
+
+      private:
+        std::FILE* m_file;
+        std::string m_line;
+    };
+
+    namespace detail::logging {
+        static inline constexpr auto k_binary_magic
+            = std::array<char, 8>{'H', 'Y', 'P', 'L', 'O', 'G', '0', '1'};
+        static inline constexpr auto k_site_entry = static_cast<byte>(1);
+        static inline constexpr auto k_record_entry = static_cast<byte>(2);
+
+        template<typename TType>
+        auto append_raw(std::string& out, const TType& value) -> void {
+            // NOLINTNEXTLINE(*-reinterpret-cast)
+            out.append(reinterpret_cast<const char*>(&value), sizeof(TType));
+        }
+
+        inline auto append_string(std::string& out, std::string_view value) -> void {
+            append_raw(out, static_cast<u32>(value.size()));
+            out.append(value);
+        }
+
+        /// @brief Reads values from a binary log, tracking whether it was truncated
+        class binary_reader {
+          public:
+            explicit binary_reader(std::span<const byte> data) noexcept
+                : m_data{data} {
+            }
+
+            template<typename TType>
+            [[nodiscard]] auto read() noexcept -> TType {
+                auto value = TType{};
+                if(m_data.size() - m_offset < sizeof(TType)) {
+                    m_failed = true;
+                    m_offset = m_data.size();
+                    return value;
+                }
+                std::memcpy(&value, m_data.data() + m_offset, sizeof(TType)); // NOLINT
+                m_offset += sizeof(TType);
+                return value;
+            }
+
+            [[nodiscard]] auto read_bytes(usize size) noexcept -> std::span<const byte> {
+                if(m_data.size() - m_offset < size) {
+                    m_failed = true;
+                    m_offset = m_data.size();
+                    return {};
+                }
+                const auto bytes = m_data.subspan(m_offset, size);
+                m_offset += size;
+                return bytes;
+            }
+
+            [[nodiscard]] auto read_string() noexcept -> std::string_view {
+                const auto bytes = read_bytes(read<u32>());
+                // NOLINTNEXTLINE(*-reinterpret-cast)
+                return {reinterpret_cast<const char*>(bytes.data()), bytes.size()};
+            }
+
+            [[nodiscard]] auto done() const noexcept -> bool {
+                return m_offset == m_data.size();
+            }
+
+            [[nodiscard]] auto failed() const noexcept -> bool {
+                return m_failed;
+            }
+
+          private:
+            std::span<const byte> m_data;
+            usize m_offset = 0_usize;
+            bool m_failed = false;
+        };
+    } // namespace detail::logging
+
+    /// @brief A `log_sink` that writes records, unformatted, to a binary file for offline
+    /// decoding with `decode_binary_log`.
+    ///
+    /// The metadata of each call site is written once, before the first record logged from it,
+    /// so the output is self-describing. Values are written in the native byte order.
+    /// @ingroup logging
+    /// @headerfile hyperion/platform/logging.h
+    class binary_log_sink final : public log_sink {
+      public:
+        /// @brief Constructs a `binary_log_sink` writing to `file`
+        /// @param file The file to write to. Must outlive the sink.
+        explicit binary_log_sink(std::FILE* file) noexcept
+            : m_file{file} {
+            std::fwrite(detail::logging::k_binary_magic.data(),
+                        1,
+                        detail::logging::k_binary_magic.size(),
+                        m_file);
+        }
+
+        binary_log_sink(const binary_log_sink&) = delete;
+        binary_log_sink(binary_log_sink&&) = delete;
+        ~binary_log_sink() noexcept final = default;
+        auto operator=(const binary_log_sink&) -> binary_log_sink& = delete;
+        auto operator=(binary_log_sink&&) -> binary_log_sink& = delete;
+
+        auto consume(const log_record& record) -> void final {
+            using detail::logging::append_raw;
+            using detail::logging::append_string;
+
+            // NOLINTNEXTLINE(*-reinterpret-cast)
+            const auto site_id = static_cast<u64>(reinterpret_cast<std::uintptr_t>(record.site));
+            m_entry.clear();
+            if(m_known_sites.insert(record.site).second) {
+                append_raw(m_entry, detail::logging::k_site_entry);
+                append_raw(m_entry, site_id);
+                append_raw(m_entry, record.site->level);
+                append_raw(m_entry, record.site->line);
+                append_string(m_entry, record.site->file);
+                append_string(m_entry, record.site->format);
+                append_string(m_entry, record.site->signature);
+            }
+
+            append_raw(m_entry, detail::logging::k_record_entry);
+            append_raw(m_entry, site_id);
+            append_raw(m_entry, record.timestamp);
+            append_raw(m_entry, record.thread);
+            append_raw(m_entry, static_cast<u32>(record.payload.size()));
+            // NOLINTNEXTLINE(*-reinterpret-cast)
+            m_entry.append(reinterpret_cast<const char*>(record.payload.data()),
+                           record.payload.size());
+
+            std::fwrite(m_entry.data(), 1, m_entry.size(), m_file);
+        }
+
+        auto flush() -> void final {
+            std::fflush(m_file);
+        }
+
+      private:
+        std::FILE* m_file;
+        std::string m_entry;
+        std::unordered_set<const log_site*> m_known_sites;
+    };
+
+    /// @brief A log message decoded from a binary log
+    /// @ingroup logging
+    /// @headerfile hyperion/platform/logging.h
+    struct decoded_log_message {
+        /// @brief The severity of the message
+        LogLevel level;
+        /// @brief The time the message was logged at, in `platform::coarse_clock` nanoseconds
+        i64 timestamp;
+        /// @brief The index of the thread that logged the message
+        u32 thread;
+        /// @brief The source file of the call site
+        std::string_view file;
+        /// @brief The source line of the call site
+        u32 line;
+        /// @brief The formatted message
+        std::string_view message;
+    };
+
+    /// @brief Decodes the output of a `binary_log_sink`, invoking `on_message` with each
+    /// formatted message in order
+    /// @tparam TFunc The type of the message handler
+    /// @param data The binary log
+    /// @param on_message The function to invoke with each message
+    /// @return Whether `data` was a complete, well-formed binary log
+    /// @ingroup logging
+    /// @headerfile hyperion/platform/logging.h
+    template<typename TFunc>
+        requires std::invocable<TFunc&, const decoded_log_message&>
+    [[nodiscard]] auto decode_binary_log(std::span<const byte> data, TFunc&& on_message) -> bool {
+        auto reader = detail::logging::binary_reader{data};
+        const auto magic = reader.read_bytes(detail::logging::k_binary_magic.size());
+        if(reader.failed()
+           || std::memcmp(magic.data(),
+                          detail::logging::k_binary_magic.data(),
+                          detail::logging::k_binary_magic.size())
+                  != 0)
+        {
+            return false;
+        }
+
+        std::unordered_map<u64, log_site> sites;
+        std::string message;
+        while(!reader.done()) {
+            const auto entry = reader.read<byte>();
+            const auto site_id = reader.read<u64>();
+            if(entry == detail::logging::k_site_entry) {
+                const auto level = reader.read<LogLevel>();
+                const auto line = reader.read<u32>();
+                const auto file = reader.read_string();
+                const auto format = reader.read_string();
+                const auto signature = reader.read_string();
+                sites.insert_or_assign(site_id, log_site{level, format, signature, file, line});
+            }
+            else if(entry == detail::logging::k_record_entry) {
+                const auto timestamp = reader.read<i64>();
+                const auto thread = reader.read<u32>();
+                const auto payload = reader.read_bytes(reader.read<u32>());
+                const auto site = sites.find(site_id);
+                if(reader.failed() || site == sites.end()) {
+                    return false;
+                }
+
+                message.clear();
+                if(!format_message(site->second.format, site->second.signature, payload, message)) {
+                    return false;
+                }
+                on_message(decoded_log_message{site->second.level,
+                                               timestamp,
+                                               thread,
+                                               site->second.file,
+                                               site->second.line,
+                                               message});
+            }
+            else {
+                return false;
+            }
+
+            if(reader.failed()) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /// @brief The process-wide asynchronous logger that `HYPERION_LOG` calls write to.
+    ///
+    /// Records are buffered per thread until they are drained into the attached `log_sink`,
+    /// either by the background thread started with `start`, or synchronously by `flush`.
+    /// @ingroup logging
+    /// @headerfile hyperion/platform/logging.h
+    class logger {
+      public:
+        constexpr logger() noexcept = default;
+        logger(const logger&) = delete;
+        logger(logger&&) = delete;
+        ~logger() noexcept {
+            stop();
+        }
+        auto operator=(const logger&) -> logger& = delete;
+        auto operator=(logger&&) -> logger& = delete;
+
+        /// @brief Returns the process-wide logger, which is never destroyed
+        /// @return The global logger
+        [[nodiscard]] static auto global() noexcept -> logger&;
+
+        /// @brief Sets the minimum level of messages to record. Messages below this level are
+        /// discarded at the call site, before any arguments are copied.
+        /// @param level The minimum level
+        auto set_level(LogLevel level) noexcept -> void {
+            m_level.store(static_cast<u8>(level), std::memory_order_relaxed);
+        }
+
+        /// @brief Returns the minimum level of messages to record
+        /// @return The minimum level
+        [[nodiscard]] auto level() const noexcept -> LogLevel {
+            return static_cast<LogLevel>(m_level.load(std::memory_order_relaxed));
+        }
+
+        /// @brief Returns whether messages of the given level are recorded
+        /// @param level The level to check
+        /// @return Whether `level` is at least the minimum level
+        [[nodiscard]] auto is_enabled(LogLevel level) const noexcept -> bool {
+            return static_cast<u8>(level) >= m_level.load(std::memory_order_relaxed);
+        }
+
+        /// @brief Sets the sink records are drained into. With no sink, drained records are
+        /// discarded.
+        /// @param sink The sink, or `nullptr`. Must remain valid until it is replaced.
+        auto set_sink(log_sink* sink) -> void {
+            const auto drain_guard = std::scoped_lock{m_drain_mutex};
+            const auto guard = std::scoped_lock{m_mutex};
+            m_sink = sink;
+        }
+
+        /// @brief Starts a background thread that drains buffered records into the sink
+        /// @param poll_interval How long the background thread sleeps when there are no records
+        auto start(std::chrono::microseconds poll_interval = std::chrono::microseconds{1000})
+            -> void {
+            if(m_backend != nullptr) {
+                return;
+            }
+
+            m_backend = std::make_unique<backend>();
+            m_backend->thread = std::thread{[this, poll_interval]() { run(poll_interval); }};
+        }
+
+        /// @brief Stops the background thread, if running, then drains every buffered record
+        /// into the sink and flushes it
+        auto stop() -> void {
+            if(m_backend != nullptr) {
+                {
+                    const auto guard = std::scoped_lock{m_backend->mutex};
+                    m_backend->stop = true;
+                }
+                m_backend->condition.notify_one();
+                m_backend->thread.join();
+                m_backend.reset();
+            }
+
+            flush();
+        }
+
+        /// @brief Synchronously drains every buffered record into the sink and flushes it
+        auto flush() -> void {
+            const auto guard = std::scoped_lock{m_drain_mutex};
+            ignore_result(drain());
+            if(m_sink != nullptr) {
+                m_sink->flush();
+            }
+        }
+
+        /// @brief Returns the total number of log calls dropped because a thread's buffer was
+        /// full
+        /// @return The number of dropped log calls
+        [[nodiscard]] auto dropped() const -> u64 {
+            const auto guard = std::scoped_lock{m_mutex};
+            auto dropped = m_retired_dropped;
+            for(const auto& buffer : m_buffers) {
+                dropped += buffer->dropped();
+            }
+            return dropped;
+        }
+
+        /// @brief Records a log call. Invoked via `HYPERION_LOG`.
+        template<typename... TArgs>
+        auto write(const log_site& site, const TArgs&... args) noexcept -> void {
+            if(!is_enabled(site.level)) {
+                return;
+            }
+
+            const auto& producer = detail::logging::t_producer;
+            auto* buffer = producer.buffer;
+            if(buffer == nullptr || producer.logger != m_id.load(std::memory_order_relaxed))
+                [[unlikely]]
+            {
+                buffer = register_thread();
+                if(buffer == nullptr) {
+                    return;
+                }
+            }
+
+            const auto payload_size = (0_usize + ... + detail::logging::encoded_size(args));
+            const auto size = detail::logging::record_size(payload_size);
+            auto* out = buffer->reserve(size);
+            if(out == nullptr) [[unlikely]] {
+                buffer->drop();
+                return;
+            }
+
+            const auto header = detail::logging::record_header{
+                static_cast<u32>(size),
+                static_cast<u32>(payload_size),
+                &site,
+                platform::coarse_clock::now().time_since_epoch().count()};
+            std::memcpy(out, &header, sizeof(header));
+            if constexpr(sizeof...(TArgs) != 0_usize) {
+                auto* cursor = out + sizeof(header); // NOLINT(*-pointer-arithmetic)
+                ((cursor = detail::logging::encode(cursor, args)), ...);
+            }
+            buffer->commit();
+        }
+
+      private:
+        struct backend {
+            std::thread thread;
+            std::mutex mutex;
+            std::condition_variable condition;
+            bool stop = false;
+        };
+
+        using buffer_list = std::vector<std::shared_ptr<detail::logging::thread_buffer>>;
+
+        std::atomic<u8> m_level = static_cast<u8>(LogLevel::Info);
+        /// @brief Assigned on first use, so the global logger remains constant-initialized
+        std::atomic<u64> m_id = 0_u64;
+        /// @brief Guards the sink and the set of buffers. Never held while calling the sink.
+        mutable std::mutex m_mutex;
+        /// @brief Serializes draining, as each buffer supports a single consumer. Acquired
+        /// before `m_mutex` when both are held.
+        std::mutex m_drain_mutex;
+        log_sink* m_sink = nullptr;
+        buffer_list m_buffers;
+        /// @brief The buffers being drained. Only accessed with `m_drain_mutex` held.
+        buffer_list m_batch;
+        u32 m_next_thread = 0_u32;
+        u64 m_retired_dropped = 0_u64;
+        std::unique_ptr<backend> m_backend;
+
+        static auto ignore_result(usize) noexcept -> void {
+        }
+
+        /// @brief Returns the calling thread's buffer for this logger, creating it if necessary
+        [[nodiscard]] auto register_thread() noexcept -> detail::logging::thread_buffer* {
+            auto& producer = detail::logging::t_producer;
+            if(producer.exited) [[unlikely]] {
+                return nullptr;
+            }
+
+            try {
+                const auto guard = std::scoped_lock{m_mutex};
+                auto id = m_id.load(std::memory_order_relaxed);
+                if(id == 0_u64) {
+                    id = detail::logging::g_next_logger_id.fetch_add(1_u64,
+                                                                     std::memory_order_relaxed);
+                    m_id.store(id, std::memory_order_relaxed);
+                }
+
+                auto* buffer = producer.find(id);
+                if(buffer == nullptr) {
+                    producer.prune();
+                    auto shared = std::make_shared<detail::logging::thread_buffer>(m_next_thread);
+                    producer.entries.reserve(producer.entries.size() + 1_usize);
+                    m_buffers.push_back(shared);
+                    ++m_next_thread;
+                    buffer = shared.get();
+                    producer.entries.push_back({id, std::move(shared)});
+                }
+
+                producer.logger = id;
+                producer.buffer = buffer;
+                return buffer;
+            }
+            catch(...) {
+                return nullptr;
+            }
+        }
+
+        /// @brief Drains every thread's buffer into the sink. Requires `m_drain_mutex` to be
+        /// held. `m_mutex` is only held to take and retire the batch of buffers, so threads
+        /// registering with the logger are never blocked behind a slow sink.
+        [[nodiscard]] auto drain() noexcept -> usize {
+            auto* sink = static_cast<log_sink*>(nullptr);
+            try {
+                const auto guard = std::scoped_lock{m_mutex};
+                m_batch.assign(m_buffers.begin(), m_buffers.end());
+                sink = m_sink;
+            }
+            catch(...) {
+                // the records stay buffered until a later drain
+                return 0_usize;
+            }
+
+            auto drained = 0_usize;
+            for(auto& buffer : m_batch) {
+                drained += buffer->consume([sink](const log_record& record) noexcept {
+                    if(sink == nullptr) {
+                        return;
+                    }
+
+                    try {
+                        sink->consume(record);
+                    }
+                    catch(...) { // NOLINT(bugprone-empty-catch)
+                        // a failing sink loses the record, but must not take down the logger
+                    }
+                });
+            }
+
+            const auto guard = std::scoped_lock{m_mutex};
+            std::erase_if(m_buffers, [this](const auto& buffer) {
+                if(!buffer->is_finished()) {
+                    return false;
+                }
+                m_retired_dropped += buffer->dropped();
+                return true;
+            });
+            m_batch.clear();
+
+            return drained;
+        }
+
+        auto run(std::chrono::microseconds poll_interval) noexcept -> void {
+            while(true) {
+                auto drained = 0_usize;
+                {
+                    const auto guard = std::scoped_lock{m_drain_mutex};
+                    drained = drain();
+                }
+
+                auto lock = std::unique_lock{m_backend->mutex};
+                if(m_backend->stop) {
+                    return;
+                }
+
+                if(drained == 0_usize) {
+                    m_backend->condition.wait_for(lock, poll_interval);
+                }
+            }
+        }
+    };
+
+    namespace detail::logging {
+        /// @brief Storage for the global logger that is constant-initialized and never
+        /// destroyed, so logging remains valid during static initialization and destruction
+        union global_logger_storage {
+            logger instance;
+
+            constexpr global_logger_storage() noexcept
+                : instance{} {
+            }
+            global_logger_storage(const global_logger_storage&) = delete;
+            global_logger_storage(global_logger_storage&&) = delete;
+            ~global_logger_storage() noexcept { // NOLINT(modernize-use-equals-default)
+            }
+            auto operator=(const global_logger_storage&) -> global_logger_storage& = delete;
+            auto operator=(global_logger_storage&&) -> global_logger_storage& = delete;
+        };
+
+        // NOLINTNEXTLINE(*-avoid-non-const-global-variables)
+        inline constinit global_logger_storage g_logger;
+
+        /// @brief The entry point of `HYPERION_LOG`. `TSiteInfo` is a closure type unique to
+        /// each call site, so each call site instantiates its own `static constexpr` metadata.
+        template<typename TSiteInfo, typename... TArgs>
+        inline auto write(TSiteInfo /*unused*/, const TArgs&... args) noexcept -> void {
+            static constexpr auto info = TSiteInfo{}();
+            static_assert(count_placeholders(info.format) == sizeof...(TArgs),
+                          "The number of `{}` placeholders in a log format string must match the "
+                          "number of arguments");
+            static constexpr auto& codes = signature<normalized_t<TArgs>...>;
+            static constexpr auto site = log_site{info.level,
+                                                  info.format,
+                                                  std::string_view{codes.data(), sizeof...(TArgs)},
+                                                  info.position.file,
+                                                  info.position.line};
+
+            auto& logger = g_logger.instance;
+            if(!logger.is_enabled(info.level)) {
+                return;
+            }
+
+            logger.write(site, normalize(args)...);
+        }
+    } // namespace detail::logging
+
+    inline auto logger::global() noexcept -> logger& {
+        return detail::logging::g_logger.instance;
+    }
+
+} // namespace hyperion
+
+#if HYPERION_STD_LIB_HAS_SOURCE_LOCATION
+    #define HYPERION_LOG_SOURCE_POSITION() /** NOLINT(cppcoreguidelines-macro-usage) **/ \
+        ::hyperion::detail::logging::source_position {                                  \
+            std::source_location::current().file_name(),                                \
+                std::source_location::current().line()                                  \
+        }
+#else
+    #define HYPERION_LOG_SOURCE_POSITION() /** NOLINT(cppcoreguidelines-macro-usage) **/ \
+        ::hyperion::detail::logging::source_position {                                  \
+            __FILE__, static_cast<::hyperion::u32>(__LINE__)                             \
+        }
+#endif // HYPERION_STD_LIB_HAS_SOURCE_LOCATION
+
+/// @def HYPERION_LOG
+/// @brief Logs a message with the given `hyperion::LogLevel`, format string and arguments to
+/// the global `hyperion::logger`. The format string must be a string literal using `{}` as the
+/// placeholder for each argument.
+/// @ingroup logging
+/// @headerfile hyperion/platform/logging.h
+#define HYPERION_LOG(level, format, ...) /** NOLINT(cppcoreguidelines-macro-usage) **/ \
+    ::hyperion::detail::logging::write(                                                \
+        []() noexcept {                                                                \
+            return ::hyperion::detail::logging::site_info{(level),                     \
+                                                          (format),                    \
+                                                          HYPERION_LOG_SOURCE_POSITION()}; \
+        } __VA_OPT__(, ) __VA_ARGS__)
+
+/// @def HYPERION_LOG_TRACE
+/// @brief Logs a message with `hyperion::LogLevel::Trace`. See `HYPERION_LOG`.
+/// @ingroup logging
+/// @headerfile hyperion/platform/logging.h
+#define HYPERION_LOG_TRACE(...) /** NOLINT(cppcoreguidelines-macro-usage) **/ \
+    HYPERION_LOG(::hyperion::LogLevel::Trace, __VA_ARGS__)
+
+/// @def HYPERION_LOG_DEBUG
+/// @brief Logs a message with `hyperion::LogLevel::Debug`. See `HYPERION_LOG`.
+/// @ingroup logging
+/// @headerfile hyperion/platform/logging.h
+#define HYPERION_LOG_DEBUG(...) /** NOLINT(cppcoreguidelines-macro-usage) **/ \
+    HYPERION_LOG(::hyperion::LogLevel::Debug, __VA_ARGS__)
+
+/// @def HYPERION_LOG_INFO
+/// @brief Logs a message with `hyperion::LogLevel::Info`. See `HYPERION_LOG`.
+/// @ingroup logging
+/// @headerfile hyperion/platform/logging.h
+#define HYPERION_LOG_INFO(...) /** NOLINT(cppcoreguidelines-macro-usage) **/ \
+    HYPERION_LOG(::hyperion::LogLevel::Info, __VA_ARGS__)
+
+/// @def HYPERION_LOG_WARN
+/// @brief Logs a message with `hyperion::LogLevel::Warn`. See `HYPERION_LOG`.
+/// @ingroup logging
+/// @headerfile hyperion/platform/logging.h
+#define HYPERION_LOG_WARN(...) /** NOLINT(cppcoreguidelines-macro-usage) **/ \
+    HYPERION_LOG(::hyperion::LogLevel::Warn, __VA_ARGS__)
+
+/// @def HYPERION_LOG_ERROR
+/// @brief Logs a message with `hyperion::LogLevel::Error`. See `HYPERION_LOG`.
+/// @ingroup logging
+/// @headerfile hyperion/platform/logging.h
+#define HYPERION_LOG_ERROR(...) /** NOLINT(cppcoreguidelines-macro-usage) **/ \
+    HYPERION_LOG(::hyperion::LogLevel::Error, __VA_ARGS__)
+
+#if defined(HYPERION_ENABLE_TESTING) && HYPERION_ENABLE_TESTING
+
+    #include <boost/ut.hpp>
+
+namespace hyperion::_test::platform::logging {
+
+    // NOLINTNEXTLINE(google-build-using-namespace)
+    using namespace boost::ut;
+
+    static_assert(detail::logging::count_placeholders("a {} b {} {{}}") == 2_usize);
+    static_assert(detail::logging::count_placeholders("{") == detail::logging::k_invalid_format);
+    static_assert(detail::logging::count_placeholders("}") == detail::logging::k_invalid_format);
+
+    class capture_sink final : public log_sink {
+      public:
+        std::vector<std::string> messages;
+        std::vector<u32> threads;
+
+        capture_sink() noexcept = default;
+        capture_sink(const capture_sink&) = delete;
+        capture_sink(capture_sink&&) = delete;
+        ~capture_sink() noexcept final = default;
+        auto operator=(const capture_sink&) -> capture_sink& = delete;
+        auto operator=(capture_sink&&) -> capture_sink& = delete;
+
+        auto consume(const log_record& record) -> void final {
+            auto& message = messages.emplace_back();
+            threads.push_back(record.thread);
+            const auto& site = *record.site;
+            if(!format_message(site.format, site.signature, record.payload, message)) {
+                message = "<malformed>";
+            }
+        }
+    };
+
+    enum class color : u8 {
+        Red = 3
+    };
+
+    // NOLINTNEXTLINE(cert-err58-cpp)
+    static const suite<"hyperion::platform::logging"> logging_tests = [] {
+        "formatting"_test = [] {
+            auto sink = capture_sink{};
+            auto& logger = hyperion::logger::global();
+            logger.set_sink(&sink);
+
+            const char* name = "world";
+            const char* null_name = nullptr;
+            const auto text = std::string{"owned"};
+            HYPERION_LOG_INFO("hello {}", name);
+            HYPERION_LOG_WARN("{} {} {} {} {} {}", -42, 42_u64, 1.5, true, 'c', color::Red);
+            HYPERION_LOG_ERROR("{{escaped}} {} {} {}", text, std::string_view{"view"}, null_name);
+            HYPERION_LOG_INFO("no arguments");
+            HYPERION_LOG_INFO("{}", static_cast<const void*>(nullptr));
+            logger.flush();
+            logger.set_sink(nullptr);
+
+            expect(that % sink.messages.size() == 5_usize);
+            expect(sink.messages[0] == "hello world");
+            expect(sink.messages[1] == "-42 42 1.5 true c 3");
+            expect(sink.messages[2] == "{escaped} owned view (null)");
+            expect(sink.messages[3] == "no arguments");
+            expect(sink.messages[4] == "0x0");
+        };
+
+        "level_filter"_test = [] {
+            auto sink = capture_sink{};
+            auto& logger = hyperion::logger::global();
+            logger.set_sink(&sink);
+
+            logger.set_level(LogLevel::Warn);
+            HYPERION_LOG_DEBUG("filtered {}", 1);
+            HYPERION_LOG_INFO("filtered {}", 2);
+            HYPERION_LOG_ERROR("kept {}", 3);
+            logger.set_level(LogLevel::Info);
+            logger.flush();
+            logger.set_sink(nullptr);
+
+            expect(that % sink.messages.size() == 1_usize);
+            expect(sink.messages[0] == "kept 3");
+        };
+
+        "background_multithreaded"_test = [] {
+            constexpr auto threads = 4_usize;
+            constexpr auto messages = 2000_usize;
+
+            auto sink = capture_sink{};
+            auto& logger = hyperion::logger::global();
+            logger.set_sink(&sink);
+            logger.start(std::chrono::microseconds{100});
+
+            std::vector<std::thread> workers;
+            workers.reserve(threads);
+            for(auto index = 0_usize; index < threads; ++index) {
+                workers.emplace_back([index]() {
+                    for(auto message = 0_usize; message < messages; ++message) {
+                        HYPERION_LOG_INFO("{} {}", index, message);
+                        if(message % 256_usize == 0_usize) {
+                            // give the backend a chance to keep up, so nothing is dropped
+                            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+                        }
+                    }
+                });
+            }
+
+            for(auto& worker : workers) {
+                worker.join();
+            }
+            logger.stop();
+            logger.set_sink(nullptr);
+
+            // each thread's messages are delivered in order
+            const auto dropped = logger.dropped();
+            auto next = std::vector<usize>(threads, 0_usize);
+            auto in_order = true;
+            for(const auto& message : sink.messages) {
+                const auto separator = message.find(' ');
+                const auto thread = std::stoul(message.substr(0, separator));
+                const auto sequence = std::stoul(message.substr(separator + 1));
+                in_order = in_order && sequence >= next[thread];
+                next[thread] = sequence + 1_usize;
+            }
+
+            expect(that % in_order);
+            expect(that % (sink.messages.size() + dropped) == threads * messages);
+        };
+
+        "drops_when_full"_test = [] {
+            auto& logger = hyperion::logger::global();
+            const auto before = logger.dropped();
+
+            std::thread{[]() {
+                const auto padding = std::string(200_usize, 'x');
+                for(auto message = 0_usize;
+                    message < detail::logging::k_buffer_size / 64_usize;
+                    ++message)
+                {
+                    HYPERION_LOG_INFO("{}", padding);
+                }
+            }}.join();
+
+            // the exited thread's buffer is reclaimed, but its drop count is retained
+            logger.flush();
+            expect(that % logger.dropped() > before);
+        };
+
+        "multiple_loggers"_test = [] {
+            static constexpr auto site = log_site{LogLevel::Info,
+                                                  "{}",
+                                                  std::string_view{"i"},
+                                                  "logging.h",
+                                                  0_u32};
+
+            auto global_sink = capture_sink{};
+            auto& global = hyperion::logger::global();
+            global.set_sink(&global_sink);
+
+            auto first_sink = capture_sink{};
+            {
+                auto first = hyperion::logger{};
+                first.set_sink(&first_sink);
+                global.write(site, i64{1});
+                first.write(site, i64{2});
+                global.write(site, i64{3});
+                first.write(site, i64{4});
+                first.flush();
+            }
+
+            // the destroyed logger's buffer is released without disturbing the others, and a
+            // later logger doesn't inherit it
+            auto second_sink = capture_sink{};
+            auto second = hyperion::logger{};
+            second.set_sink(&second_sink);
+            second.write(site, i64{5});
+            global.write(site, i64{6});
+            second.flush();
+            global.flush();
+            global.set_sink(nullptr);
+
+            expect(that % global_sink.messages.size() == 3_usize);
+            expect(that % first_sink.messages.size() == 2_usize);
+            expect(that % second_sink.messages.size() == 1_usize);
+            if(global_sink.messages.size() == 3_usize && first_sink.messages.size() == 2_usize
+               && second_sink.messages.size() == 1_usize)
+            {
+                expect(global_sink.messages[0] == "1");
+                expect(global_sink.messages[1] == "3");
+                expect(global_sink.messages[2] == "6");
+                expect(first_sink.messages[0] == "2");
+                expect(first_sink.messages[1] == "4");
+                expect(second_sink.messages[0] == "5");
+            }
+        };
+
+        "binary_round_trip"_test = [] {
+            auto* file = std::tmpfile();
+            expect(that % file != nullptr);
+            if(file == nullptr) {
+                return;
+            }
+
+            {
+                auto sink = binary_log_sink{file};
+                auto& logger = hyperion::logger::global();
+                logger.set_sink(&sink);
+                for(auto index = 0; index < 3; ++index) {
+                    HYPERION_LOG_WARN("value {} of {}", index, std::string_view{"three"});
+                }
+                logger.flush();
+                logger.set_sink(nullptr);
+            }
+
+            std::vector<byte> data(static_cast<usize>(std::ftell(file)));
+            std::rewind(file);
+            expect(that % std::fread(data.data(), 1, data.size(), file) == data.size());
+            std::fclose(file); // NOLINT(cert-err33-c)
+
+            std::vector<std::string> messages;
+            auto level = LogLevel::Trace;
+            const auto valid = decode_binary_log(data, [&](const decoded_log_message& message) {
+                messages.emplace_back(message.message);
+                level = message.level;
+            });
+
+            expect(that % valid);
+            expect(that % messages.size() == 3_usize);
+            expect(messages[2] == "value 2 of three");
+            expect(level == LogLevel::Warn);
+
+            data.pop_back();
+            expect(that % !decode_binary_log(data, [](const decoded_log_message&) {}));
+        };
+    };
+
+} // namespace hyperion::_test::platform::logging
+
+#endif // defined(HYPERION_ENABLE_TESTING) && HYPERION_ENABLE_TESTING
+
+#endif // HYPERION_PLATFORM_LOGGING_H
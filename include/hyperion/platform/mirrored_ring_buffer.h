@@ -0,0 +1,394 @@
+/// @file mirrored_ring_buffer.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief A byte ring buffer whose storage is mapped twice back-to-back, so every read and write
+/// is contiguous
+/// @version 0.4.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2024 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef HYPERION_PLATFORM_MIRRORED_RING_BUFFER_H
+#define HYPERION_PLATFORM_MIRRORED_RING_BUFFER_H
+
+#include <hyperion/platform.h>
+#include <hyperion/platform/assert.h>
+#include <hyperion/platform/def.h>
+#include <hyperion/platform/expected.h>
+#include <hyperion/platform/types.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <span>
+#include <utility>
+
+#if HYPERION_PLATFORM_IS_LINUX
+    #include <sys/mman.h>
+    #include <unistd.h>
+#endif // HYPERION_PLATFORM_IS_LINUX
+
+/// @ingroup platform
+/// @{
+///	@defgroup mirrored_ring_buffer Mirrored Ring Buffer
+/// `hyperion::platform::mirrored_ring_buffer` is a byte ring buffer whose storage is mapped
+/// twice, back-to-back, in virtual memory: the byte at `data()[i + capacity()]` is the same
+/// physical byte as `data()[i]`. As a result, the readable and writable regions of the buffer
+/// are always single contiguous `std::span<std::byte>`s, no matter where they wrap, so parsers
+/// can decode messages straddling the wrap point in place, without copying them out or
+/// branching on the wrap.
+///
+/// On Linux the storage is an anonymous `memfd_create` file mapped twice with `mmap`. The
+/// capacity is rounded up to a multiple of the page size. Mirroring is not yet implemented on
+/// other platforms, where `create` returns `MirroredRingError::Unsupported`.
+///
+/// The buffer is not internally synchronized.
+///
+/// # Example
+/// @code {.cpp}
+/// auto ring = hyperion::platform::mirrored_ring_buffer::create(64_usize * 1024_usize);
+///
+/// auto writable = ring->writable();
+/// const auto received = ::recv(socket, writable.data(), writable.size(), 0);
+/// ring->commit(static_cast<usize>(received));
+///
+/// // a frame that wrapped around the end of the buffer is still contiguous here
+/// while(const auto frame_size = parse_frame(ring->readable())) {
+///     ring->consume(frame_size);
+/// }
+/// @endcode
+/// @headerfile hyperion/platform/mirrored_ring_buffer.h
+/// @}
+
+namespace hyperion::platform {
+
+    /// @brief Errors that can occur when creating a `mirrored_ring_buffer`
+    /// @ingroup mirrored_ring_buffer
+    /// @headerfile hyperion/platform/mirrored_ring_buffer.h
+    enum class MirroredRingError : u8 {
+        /// @brief Mirrored mappings are not supported on this platform
+        Unsupported,
+        /// @brief The requested capacity was zero, or too large to map twice
+        InvalidCapacity,
+        /// @brief The backing memory could not be created or sized
+        CreateFailed,
+        /// @brief The backing memory could not be mapped twice
+        MapFailed,
+    };
+
+    /// @brief A byte ring buffer whose storage is mapped twice back-to-back, so that its
+    /// readable and writable regions are always contiguous
+    /// @ingroup mirrored_ring_buffer
+    /// @headerfile hyperion/platform/mirrored_ring_buffer.h
+    class mirrored_ring_buffer {
+      public:
+        /// @brief Whether mirrored ring buffers can be created on this platform
+        static constexpr auto is_supported = HYPERION_PLATFORM_IS_LINUX;
+
+        mirrored_ring_buffer(const mirrored_ring_buffer&) = delete;
+        mirrored_ring_buffer(mirrored_ring_buffer&& other) noexcept
+            : m_data{std::exchange(other.m_data, nullptr)},
+              m_capacity{std::exchange(other.m_capacity, 0_usize)},
+              m_read{std::exchange(other.m_read, 0_usize)},
+              m_size{std::exchange(other.m_size, 0_usize)} {
+        }
+
+        ~mirrored_ring_buffer() noexcept {
+            release();
+        }
+
+        auto operator=(const mirrored_ring_buffer&) -> mirrored_ring_buffer& = delete;
+        auto operator=(mirrored_ring_buffer&& other) noexcept -> mirrored_ring_buffer& {
+            if(this != &other) {
+                release();
+                m_data = std::exchange(other.m_data, nullptr);
+                m_capacity = std::exchange(other.m_capacity, 0_usize);
+                m_read = std::exchange(other.m_read, 0_usize);
+                m_size = std::exchange(other.m_size, 0_usize);
+            }
+            return *this;
+        }
+
+        /// @brief Creates a mirrored ring buffer with room for at least `min_capacity` bytes
+        /// @param min_capacity The minimum capacity, in bytes
+        /// @return The ring buffer, or the reason it could not be created
+        [[nodiscard]] static auto create(usize min_capacity) noexcept
+            -> expected<mirrored_ring_buffer, MirroredRingError> {
+            if(min_capacity == 0_usize) {
+                return unexpected{MirroredRingError::InvalidCapacity};
+            }
+
+#if HYPERION_PLATFORM_IS_LINUX
+            const auto page_size = static_cast<usize>(::sysconf(_SC_PAGESIZE));
+            if(min_capacity > (static_cast<usize>(-1) / 2_usize) - page_size) {
+                return unexpected{MirroredRingError::InvalidCapacity};
+            }
+            const auto capacity = (min_capacity + page_size - 1_usize) / page_size * page_size;
+
+            const auto descriptor = ::memfd_create("hyperion_mirrored_ring", MFD_CLOEXEC);
+            if(descriptor < 0) {
+                return unexpected{MirroredRingError::CreateFailed};
+            }
+            if(::ftruncate(descriptor, static_cast<off_t>(capacity)) != 0) {
+                ::close(descriptor);
+                return unexpected{MirroredRingError::CreateFailed};
+            }
+
+            // reserve the address range for both copies first, so that nothing else can be
+            // mapped between them, then map the file over each half
+            auto* const reserved = ::mmap(nullptr,
+                                          2_usize * capacity,
+                                          PROT_NONE,
+                                          MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE,
+                                          -1,
+                                          0);
+            if(reserved == MAP_FAILED) { // NOLINT(*-cstyle-cast, performance-no-int-to-ptr)
+                ::close(descriptor);
+                return unexpected{MirroredRingError::MapFailed};
+            }
+
+            auto* const base = static_cast<std::byte*>(reserved);
+            const auto map_half = [&](std::byte* address) noexcept {
+                return ::mmap(address,
+                              capacity,
+                              PROT_READ | PROT_WRITE,
+                              MAP_SHARED | MAP_FIXED,
+                              descriptor,
+                              0)
+                       == address;
+            };
+            const auto mapped = map_half(base) && map_half(base + capacity);
+            ::close(descriptor);
+            if(!mapped) {
+                ::munmap(reserved, 2_usize * capacity);
+                return unexpected{MirroredRingError::MapFailed};
+            }
+
+            return mirrored_ring_buffer{base, capacity};
+#else
+            return unexpected{MirroredRingError::Unsupported};
+#endif // HYPERION_PLATFORM_IS_LINUX
+        }
+
+        /// @brief Returns the capacity of the buffer, in bytes
+        /// @return The capacity
+        [[nodiscard]] auto capacity() const noexcept -> usize {
+            return m_capacity;
+        }
+
+        /// @brief Returns the number of readable bytes
+        /// @return The number of readable bytes
+        [[nodiscard]] auto size() const noexcept -> usize {
+            return m_size;
+        }
+
+        /// @brief Returns whether there are no readable bytes
+        /// @return Whether the buffer is empty
+        [[nodiscard]] auto empty() const noexcept -> bool {
+            return m_size == 0_usize;
+        }
+
+        /// @brief Returns whether there is no room to write
+        /// @return Whether the buffer is full
+        [[nodiscard]] auto full() const noexcept -> bool {
+            return m_size == m_capacity;
+        }
+
+        /// @brief Returns the readable bytes, as a single contiguous span
+        /// @return The readable bytes
+        [[nodiscard]] auto readable() const noexcept -> std::span<std::byte> {
+            return {m_data + m_read, m_size};
+        }
+
+        /// @brief Returns the free space, as a single contiguous span. Bytes written to it
+        /// become readable once `commit`ed
+        /// @return The free space
+        [[nodiscard]] auto writable() const noexcept -> std::span<std::byte> {
+            return {m_data + m_read + m_size, m_capacity - m_size};
+        }
+
+        /// @brief Makes the first `count` bytes of `writable()` readable
+        /// @param count The number of bytes written
+        /// @pre `count <= writable().size()`
+        auto commit(usize count) noexcept -> void {
+            HYPERION_DEBUG_ASSERT(count <= m_capacity - m_size,
+                                  "mirrored_ring_buffer::commit past the end of writable()");
+            m_size += count;
+        }
+
+        /// @brief Discards the first `count` bytes of `readable()`
+        /// @param count The number of bytes read
+        /// @pre `count <= size()`
+        auto consume(usize count) noexcept -> void {
+            HYPERION_DEBUG_ASSERT(count <= m_size,
+                                  "mirrored_ring_buffer::consume past the end of readable()");
+            m_size -= count;
+            m_read += count;
+            // branchless wrap: m_read + count is always less than 2 * m_capacity
+            m_read -= m_capacity & (0_usize - static_cast<usize>(m_read >= m_capacity));
+        }
+
+        /// @brief Copies as much of `bytes` as fits into the buffer
+        /// @param bytes The bytes to write
+        /// @return The number of bytes written
+        auto write(std::span<const std::byte> bytes) noexcept -> usize {
+            const auto count = std::min(bytes.size(), m_capacity - m_size);
+            if(count != 0_usize) {
+                std::memcpy(writable().data(), bytes.data(), count);
+                commit(count);
+            }
+            return count;
+        }
+
+        /// @brief Discards every readable byte
+        auto clear() noexcept -> void {
+            m_read = 0_usize;
+            m_size = 0_usize;
+        }
+
+        /// @brief Returns the start of the mapping. It is `2 * capacity()` bytes long, and
+        /// `data()[i + capacity()]` aliases `data()[i]`
+        /// @return The start of the mapping
+        [[nodiscard]] auto data() const noexcept -> std::byte* {
+            return m_data;
+        }
+
+      private:
+        std::byte* m_data = nullptr;
+        usize m_capacity = 0;
+        usize m_read = 0;
+        usize m_size = 0;
+
+        mirrored_ring_buffer(std::byte* data, usize capacity) noexcept
+            : m_data{data}, m_capacity{capacity} {
+        }
+
+        auto release() noexcept -> void {
+#if HYPERION_PLATFORM_IS_LINUX
+            if(m_data != nullptr) {
+                ::munmap(m_data, 2_usize * m_capacity);
+                m_data = nullptr;
+            }
+#endif // HYPERION_PLATFORM_IS_LINUX
+        }
+    };
+
+} // namespace hyperion::platform
+
+#if defined(HYPERION_ENABLE_TESTING) && HYPERION_ENABLE_TESTING
+
+    #include <boost/ut.hpp>
+    #include <hyperion/platform/ignore.h>
+
+    #include <array>
+    #include <vector>
+
+namespace hyperion::_test::platform::mirrored_ring_buffer {
+
+    // NOLINTNEXTLINE(google-build-using-namespace)
+    using namespace boost::ut;
+    using hyperion::platform::MirroredRingError;
+
+    // NOLINTNEXTLINE(cert-err58-cpp)
+    static const suite<"hyperion::platform::mirrored_ring_buffer"> mirrored_ring_buffer_tests = [] {
+        "create"_test = [] {
+            expect(hyperion::platform::mirrored_ring_buffer::create(0_usize).error()
+                   == MirroredRingError::InvalidCapacity);
+
+            auto ring = hyperion::platform::mirrored_ring_buffer::create(1_usize);
+            if constexpr(hyperion::platform::mirrored_ring_buffer::is_supported) {
+                expect(that % ring.has_value());
+                expect(that % ring->capacity() >= 1_usize);
+                expect(that % ring->empty());
+                expect(that % ring->writable().size() == ring->capacity());
+            }
+            else {
+                expect(ring.error() == MirroredRingError::Unsupported);
+            }
+        };
+
+        if constexpr(hyperion::platform::mirrored_ring_buffer::is_supported) {
+            "mirrored_mapping"_test = [] {
+                auto ring = hyperion::platform::mirrored_ring_buffer::create(1_usize);
+                const auto capacity = ring->capacity();
+                ring->data()[3] = std::byte{0x5A};
+                expect(ring->data()[capacity + 3_usize] == std::byte{0x5A});
+                ring->data()[capacity + 7_usize] = std::byte{0xA5};
+                expect(ring->data()[7] == std::byte{0xA5});
+            };
+
+            "wraparound_is_contiguous"_test = [] {
+                auto ring = hyperion::platform::mirrored_ring_buffer::create(1_usize);
+                const auto capacity = ring->capacity();
+
+                // move the read position close to the end of the buffer
+                auto filler = std::array<std::byte, 16>{};
+                while(ring->size() + filler.size() < capacity - 8_usize) {
+                    hyperion::ignore(ring->write(filler));
+                }
+                ring->consume(ring->size());
+
+                auto message = std::array<std::byte, 32>{};
+                for(auto index = 0_usize; index < message.size(); ++index) {
+                    message[index] = static_cast<std::byte>(index);
+                }
+                expect(that % ring->write(message) == message.size());
+
+                // the message straddles the wrap point, but reads back contiguously
+                const auto readable = ring->readable();
+                expect(that % readable.size() == message.size());
+                expect(std::equal(readable.begin(), readable.end(), message.begin()));
+                // and its tail was physically written at the start of the storage
+                const auto start = static_cast<usize>(readable.data() - ring->data());
+                expect(that % (start + message.size()) > capacity);
+                const auto last = start + message.size() - 1_usize - capacity;
+                expect(ring->data()[last] == message.back());
+
+                ring->consume(message.size());
+                expect(that % ring->empty());
+                expect(that % ring->readable().data() < ring->data() + capacity);
+            };
+
+            "write_respects_capacity"_test = [] {
+                auto ring = hyperion::platform::mirrored_ring_buffer::create(1_usize);
+                const auto capacity = ring->capacity();
+                auto bytes = std::vector<std::byte>(capacity + 100_usize, std::byte{1});
+                expect(that % ring->write(bytes) == capacity);
+                expect(that % ring->full());
+                expect(that % ring->write(bytes) == 0_usize);
+
+                ring->consume(100_usize);
+                expect(that % ring->writable().size() == 100_usize);
+                ring->clear();
+                expect(that % ring->empty());
+
+                auto moved = std::move(*ring);
+                expect(that % moved.capacity() == capacity);
+                expect(that % ring->capacity() == 0_usize);
+            };
+        }
+    };
+
+} // namespace hyperion::_test::platform::mirrored_ring_buffer
+
+#endif // defined(HYPERION_ENABLE_TESTING) && HYPERION_ENABLE_TESTING
+
+#endif // HYPERION_PLATFORM_MIRRORED_RING_BUFFER_H
@@ -0,0 +1,685 @@
+/// @file numa.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief NUMA-aware allocation, memory policy and first-touch placement helpers
+/// @version 0.4.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2024 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef HYPERION_PLATFORM_NUMA_H
+#define HYPERION_PLATFORM_NUMA_H
+
+#include <hyperion/platform.h>
+#include <hyperion/platform/assert.h>
+#include <hyperion/platform/expected.h>
+#include <hyperion/platform/types.h>
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <new>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if HYPERION_PLATFORM_IS_LINUX
+    #include <cerrno>
+    #include <sched.h>
+    #include <sys/mman.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif // HYPERION_PLATFORM_IS_LINUX
+
+/// @ingroup platform
+/// @{
+///	@defgroup numa NUMA Placement
+/// On multi-socket machines memory is attached to a particular socket, or NUMA node, and
+/// accessing another node's memory costs substantially more latency and bandwidth than
+/// accessing local memory. Hyperion provides helpers to control where memory is placed:
+///
+/// - `hyperion::platform::numa_buffer` allocates page-aligned memory bound to a given node,
+/// to the calling thread's node, or interleaved page by page across all nodes.
+/// - `hyperion::platform::bind_memory_to_current_node` sets the calling thread's memory
+/// policy, so that all of its future allocations are placed on its current node.
+/// - `hyperion::platform::migrate_to_node` moves already-allocated pages to a node.
+/// - `hyperion::platform::parallel_first_touch` initializes a buffer from worker threads
+/// spread across the nodes. Linux places a page on the node of the thread that first touches
+/// it, so a buffer initialized this way is distributed in contiguous chunks, matching a
+/// computation that partitions it across threads the same way.
+///
+/// On Linux these issue the `mbind`, `set_mempolicy` and `getcpu` system calls directly, so
+/// there is no dependency on `libnuma`. On other platforms, and on hosts with a single NUMA
+/// node, there is nothing to place: allocations are ordinary page-aligned memory and policy
+/// changes succeed without effect.
+///
+/// # Example
+/// @code {.cpp}
+/// using namespace hyperion::platform;
+/// // one table per node, each read only by threads on that node
+/// auto tables = std::vector<numa_buffer>{};
+/// for(auto node = 0_usize; node < numa_node_count(); ++node) {
+///     tables.push_back(numa_buffer::allocate_on_node(table_size, node).value());
+/// }
+///
+/// // a large array processed in equal chunks by 32 threads
+/// auto data = numa_buffer::allocate(1_usize << 30U).value();
+/// parallel_first_touch(data.bytes(), 32_usize);
+/// @endcode
+/// @headerfile hyperion/platform/numa.h
+/// @}
+
+namespace hyperion::platform {
+
+    /// @brief Errors that can occur when allocating or placing memory on NUMA nodes
+    /// @ingroup numa
+    /// @headerfile hyperion/platform/numa.h
+    enum class NumaError : u8 {
+        /// @brief The requested node does not exist
+        InvalidNode,
+        /// @brief The requested size was zero, or the memory could not be allocated
+        AllocationFailed,
+        /// @brief The memory policy could not be applied
+        PolicyFailed,
+        /// @brief The pages could not be moved to the requested node
+        MigrationFailed,
+    };
+
+    namespace detail::numa {
+        /// @brief Parses a Linux sysfs list, such as `0-3,8,10-11`, into its elements
+        [[nodiscard]] inline auto parse_list(std::string_view list) -> std::vector<usize> {
+            auto elements = std::vector<usize>{};
+            const auto parse_number = [&list]() {
+                auto number = 0_usize;
+                while(!list.empty() && list.front() >= '0' && list.front() <= '9') {
+                    number = number * 10_usize + static_cast<usize>(list.front() - '0');
+                    list.remove_prefix(1_usize);
+                }
+                return number;
+            };
+
+            while(!list.empty() && list.front() >= '0' && list.front() <= '9') {
+                const auto first = parse_number();
+                auto last = first;
+                if(!list.empty() && list.front() == '-') {
+                    list.remove_prefix(1_usize);
+                    last = parse_number();
+                }
+                for(auto element = first; element <= last; ++element) {
+                    elements.push_back(element);
+                }
+                if(!list.empty() && list.front() == ',') {
+                    list.remove_prefix(1_usize);
+                }
+            }
+            return elements;
+        }
+
+        [[nodiscard]] inline auto read_file(const char* path) -> std::string {
+            auto file = std::ifstream{path};
+            return {std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+        }
+
+        [[nodiscard]] inline auto page_size() noexcept -> usize {
+#if HYPERION_PLATFORM_IS_LINUX
+            static const auto size = static_cast<usize>(::sysconf(_SC_PAGESIZE));
+            return size;
+#else
+            return 4096_usize;
+#endif // HYPERION_PLATFORM_IS_LINUX
+        }
+
+        /// @brief The largest node count supported by the node masks passed to the kernel
+        static constexpr auto k_max_nodes = 1024_usize;
+        static constexpr auto k_mask_bits = sizeof(unsigned long) * 8_usize;
+        using node_mask = std::array<unsigned long, k_max_nodes / k_mask_bits>;
+
+#if HYPERION_PLATFORM_IS_LINUX
+        // from <linux/mempolicy.h>, which not every toolchain ships
+        static constexpr auto k_policy_default = 0;
+        static constexpr auto k_policy_bind = 2;
+        static constexpr auto k_policy_interleave = 3;
+        static constexpr auto k_move_pages = 2U;
+
+        /// @brief Returns whether a failed memory policy call can be ignored: when the host has
+        /// a single node, so there is nothing to place, and the kernel merely refused the call
+        [[nodiscard]] inline auto ignorable(usize node_count) noexcept -> bool {
+            return node_count == 1_usize && (errno == ENOSYS || errno == EPERM);
+        }
+
+        // the kernel treats `maxnode` as one more than the number of bits in the mask
+        inline auto
+        mbind(void* address, usize size, int mode, const node_mask* mask, unsigned flags) noexcept
+            -> bool {
+            return ::syscall(SYS_mbind,
+                             address,
+                             size,
+                             mode,
+                             mask == nullptr ? nullptr : mask->data(),
+                             mask == nullptr ? 0_usize : k_max_nodes + 1_usize,
+                             flags)
+                   == 0;
+        }
+
+        inline auto set_mempolicy(int mode, const node_mask* mask) noexcept -> bool {
+            return ::syscall(SYS_set_mempolicy,
+                             mode,
+                             mask == nullptr ? nullptr : mask->data(),
+                             mask == nullptr ? 0_usize : k_max_nodes + 1_usize)
+                   == 0;
+        }
+#endif // HYPERION_PLATFORM_IS_LINUX
+
+        [[nodiscard]] inline auto single_node_mask(usize node) noexcept -> node_mask {
+            auto mask = node_mask{};
+            // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+            mask[node / k_mask_bits] = 1UL << (node % k_mask_bits);
+            return mask;
+        }
+    } // namespace detail::numa
+
+    /// @brief Returns the number of NUMA nodes on the host.
+    ///
+    /// On Linux this is read from `/sys/devices/system/node/online` the first time it is
+    /// called. Elsewhere, or if it cannot be determined, this is 1.
+    /// @return The number of NUMA nodes
+    /// @ingroup numa
+    /// @headerfile hyperion/platform/numa.h
+    [[nodiscard]] inline auto numa_node_count() noexcept -> usize {
+        static const auto count = []() noexcept -> usize {
+#if HYPERION_PLATFORM_IS_LINUX
+            try {
+                const auto nodes = detail::numa::parse_list(
+                    detail::numa::read_file("/sys/devices/system/node/online"));
+                if(!nodes.empty()) {
+                    return std::min(nodes.back() + 1_usize, detail::numa::k_max_nodes);
+                }
+            }
+            catch(...) { // NOLINT(bugprone-empty-catch)
+            }
+#endif // HYPERION_PLATFORM_IS_LINUX
+            return 1_usize;
+        }();
+        return count;
+    }
+
+    /// @brief Returns the NUMA node of the CPU the calling thread is running on.
+    ///
+    /// The thread may be migrated to another CPU at any time, so this is a hint unless the
+    /// thread's affinity is restricted to a single node.
+    /// @return The current NUMA node, or 0 if it cannot be determined
+    /// @ingroup numa
+    /// @headerfile hyperion/platform/numa.h
+    [[nodiscard]] inline auto current_numa_node() noexcept -> usize {
+#if HYPERION_PLATFORM_IS_LINUX
+        auto cpu = 0U;
+        auto node = 0U;
+        if(::syscall(SYS_getcpu, &cpu, &node, nullptr) == 0) {
+            return static_cast<usize>(node);
+        }
+#endif // HYPERION_PLATFORM_IS_LINUX
+        return 0_usize;
+    }
+
+    /// @brief Returns the CPUs belonging to NUMA node `node`.
+    ///
+    /// On Linux this is read from `/sys/devices/system/node/node<N>/cpulist`. Elsewhere, or if
+    /// it cannot be determined, every CPU is considered part of every node.
+    /// @param node The node
+    /// @return The CPUs of `node`
+    /// @ingroup numa
+    /// @headerfile hyperion/platform/numa.h
+    [[nodiscard]] inline auto numa_node_cpus(usize node) -> std::vector<usize> {
+#if HYPERION_PLATFORM_IS_LINUX
+        const auto path = "/sys/devices/system/node/node" + std::to_string(node) + "/cpulist";
+        if(auto cpus = detail::numa::parse_list(detail::numa::read_file(path.c_str()));
+           !cpus.empty())
+        {
+            return cpus;
+        }
+#else
+        static_cast<void>(node);
+#endif // HYPERION_PLATFORM_IS_LINUX
+        auto cpus = std::vector<usize>(std::max(std::thread::hardware_concurrency(), 1U));
+        for(auto index = 0_usize; index < cpus.size(); ++index) {
+            cpus[index] = index;
+        }
+        return cpus;
+    }
+
+    /// @brief An owning, page-aligned allocation whose pages are placed according to a NUMA
+    /// memory policy
+    ///
+    /// The policy is applied before the memory is first touched, so every page is allocated
+    /// on the requested node(s) when it is first written. The contents are initially zero.
+    /// @ingroup numa
+    /// @headerfile hyperion/platform/numa.h
+    class numa_buffer {
+      public:
+        numa_buffer(const numa_buffer&) = delete;
+        numa_buffer(numa_buffer&& other) noexcept
+            : m_data{std::exchange(other.m_data, nullptr)},
+              m_size{std::exchange(other.m_size, 0_usize)} {
+        }
+
+        ~numa_buffer() noexcept {
+            release();
+        }
+
+        auto operator=(const numa_buffer&) -> numa_buffer& = delete;
+        auto operator=(numa_buffer&& other) noexcept -> numa_buffer& {
+            if(this != &other) {
+                release();
+                m_data = std::exchange(other.m_data, nullptr);
+                m_size = std::exchange(other.m_size, 0_usize);
+            }
+            return *this;
+        }
+
+        /// @brief Allocates `size` bytes with the default policy, placing each page on the node
+        /// of the thread that first touches it. Use with `parallel_first_touch`
+        /// @param size The size of the allocation, in bytes
+        /// @return The allocation, or the reason it could not be made
+        [[nodiscard]] static auto allocate(usize size) noexcept
+            -> expected<numa_buffer, NumaError> {
+            return map(size);
+        }
+
+        /// @brief Allocates `size` bytes on NUMA node `node`
+        /// @param size The size of the allocation, in bytes
+        /// @param node The node to place the memory on
+        /// @return The allocation, or the reason it could not be made
+        [[nodiscard]] static auto allocate_on_node(usize size, usize node) noexcept
+            -> expected<numa_buffer, NumaError> {
+            if(node >= numa_node_count()) {
+                return unexpected{NumaError::InvalidNode};
+            }
+
+            auto buffer = map(size);
+            if(!buffer) {
+                return buffer;
+            }
+#if HYPERION_PLATFORM_IS_LINUX
+            const auto mask = detail::numa::single_node_mask(node);
+            if(!detail::numa::mbind(buffer->m_data,
+                                    buffer->m_size,
+                                    detail::numa::k_policy_bind,
+                                    &mask,
+                                    0U)
+               && !detail::numa::ignorable(numa_node_count()))
+            {
+                return unexpected{NumaError::PolicyFailed};
+            }
+#endif // HYPERION_PLATFORM_IS_LINUX
+            return buffer;
+        }
+
+        /// @brief Allocates `size` bytes on the NUMA node the calling thread is running on
+        /// @param size The size of the allocation, in bytes
+        /// @return The allocation, or the reason it could not be made
+        [[nodiscard]] static auto allocate_local(usize size) noexcept
+            -> expected<numa_buffer, NumaError> {
+            return allocate_on_node(size, current_numa_node());
+        }
+
+        /// @brief Allocates `size` bytes interleaved page by page across every NUMA node, for
+        /// memory shared by threads on all nodes
+        /// @param size The size of the allocation, in bytes
+        /// @return The allocation, or the reason it could not be made
+        [[nodiscard]] static auto allocate_interleaved(usize size) noexcept
+            -> expected<numa_buffer, NumaError> {
+            auto buffer = map(size);
+            if(!buffer) {
+                return buffer;
+            }
+#if HYPERION_PLATFORM_IS_LINUX
+            auto mask = detail::numa::node_mask{};
+            for(auto node = 0_usize; node < numa_node_count(); ++node) {
+                // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                mask[node / detail::numa::k_mask_bits] |= 1UL << (node % detail::numa::k_mask_bits);
+            }
+            if(!detail::numa::mbind(buffer->m_data,
+                                    buffer->m_size,
+                                    detail::numa::k_policy_interleave,
+                                    &mask,
+                                    0U)
+               && !detail::numa::ignorable(numa_node_count()))
+            {
+                return unexpected{NumaError::PolicyFailed};
+            }
+#endif // HYPERION_PLATFORM_IS_LINUX
+            return buffer;
+        }
+
+        /// @brief Returns a pointer to the memory
+        /// @return The memory
+        [[nodiscard]] auto data() const noexcept -> std::byte* {
+            return m_data;
+        }
+
+        /// @brief Returns the size of the allocation, which is rounded up to a whole number of
+        /// pages
+        /// @return The size, in bytes
+        [[nodiscard]] auto size() const noexcept -> usize {
+            return m_size;
+        }
+
+        /// @brief Returns the memory as a span of bytes
+        /// @return The memory
+        [[nodiscard]] auto bytes() const noexcept -> std::span<std::byte> {
+            return {m_data, m_size};
+        }
+
+      private:
+        std::byte* m_data = nullptr;
+        usize m_size = 0_usize;
+
+        numa_buffer(std::byte* data, usize size) noexcept : m_data{data}, m_size{size} {
+        }
+
+        [[nodiscard]] static auto map(usize size) noexcept -> expected<numa_buffer, NumaError> {
+            const auto page_size = detail::numa::page_size();
+            if(size == 0_usize || size > static_cast<usize>(-1) - page_size) {
+                return unexpected{NumaError::AllocationFailed};
+            }
+            const auto rounded = (size + page_size - 1_usize) / page_size * page_size;
+
+#if HYPERION_PLATFORM_IS_LINUX
+            auto* const address = ::mmap(nullptr,
+                                         rounded,
+                                         PROT_READ | PROT_WRITE,
+                                         MAP_PRIVATE | MAP_ANONYMOUS,
+                                         -1,
+                                         0);
+            if(address == MAP_FAILED) { // NOLINT(*-cstyle-cast, performance-no-int-to-ptr)
+                return unexpected{NumaError::AllocationFailed};
+            }
+            return numa_buffer{static_cast<std::byte*>(address), rounded};
+#else
+            auto* const address
+                = ::operator new(rounded, std::align_val_t{page_size}, std::nothrow);
+            if(address == nullptr) {
+                return unexpected{NumaError::AllocationFailed};
+            }
+            std::memset(address, 0, rounded);
+            return numa_buffer{static_cast<std::byte*>(address), rounded};
+#endif // HYPERION_PLATFORM_IS_LINUX
+        }
+
+        auto release() noexcept -> void {
+            if(m_data == nullptr) {
+                return;
+            }
+#if HYPERION_PLATFORM_IS_LINUX
+            ::munmap(m_data, m_size);
+#else
+            ::operator delete(m_data, std::align_val_t{detail::numa::page_size()});
+#endif // HYPERION_PLATFORM_IS_LINUX
+            m_data = nullptr;
+            m_size = 0_usize;
+        }
+    };
+
+    /// @brief Sets the calling thread's memory policy to allocate all of its future memory on
+    /// the NUMA node it is currently running on.
+    ///
+    /// This is most useful for threads whose affinity is restricted to a single node.
+    /// @return Nothing, or the reason the policy could not be set
+    /// @ingroup numa
+    /// @headerfile hyperion/platform/numa.h
+    inline auto bind_memory_to_current_node() noexcept -> expected<void, NumaError> {
+#if HYPERION_PLATFORM_IS_LINUX
+        const auto mask = detail::numa::single_node_mask(current_numa_node());
+        if(!detail::numa::set_mempolicy(detail::numa::k_policy_bind, &mask)
+           && !detail::numa::ignorable(numa_node_count()))
+        {
+            return unexpected{NumaError::PolicyFailed};
+        }
+#endif // HYPERION_PLATFORM_IS_LINUX
+        return {};
+    }
+
+    /// @brief Resets the calling thread's memory policy to the system default, which places
+    /// memory on the node of the thread that first touches it
+    /// @return Nothing, or the reason the policy could not be reset
+    /// @ingroup numa
+    /// @headerfile hyperion/platform/numa.h
+    inline auto reset_memory_policy() noexcept -> expected<void, NumaError> {
+#if HYPERION_PLATFORM_IS_LINUX
+        if(!detail::numa::set_mempolicy(detail::numa::k_policy_default, nullptr)
+           && !detail::numa::ignorable(numa_node_count()))
+        {
+            return unexpected{NumaError::PolicyFailed};
+        }
+#endif // HYPERION_PLATFORM_IS_LINUX
+        return {};
+    }
+
+    /// @brief Moves the pages of `memory` to NUMA node `node`, and binds them there.
+    ///
+    /// The policy applies to whole pages, so it also affects any other data sharing the first
+    /// and last pages of `memory`.
+    /// @param memory The memory to move
+    /// @param node The node to move it to
+    /// @return Nothing, or the reason the memory could not be moved
+    /// @ingroup numa
+    /// @headerfile hyperion/platform/numa.h
+    inline auto migrate_to_node(std::span<std::byte> memory, usize node) noexcept
+        -> expected<void, NumaError> {
+        if(node >= numa_node_count()) {
+            return unexpected{NumaError::InvalidNode};
+        }
+        if(memory.empty()) {
+            return {};
+        }
+
+#if HYPERION_PLATFORM_IS_LINUX
+        const auto page_size = detail::numa::page_size();
+        // NOLINTBEGIN(*-pro-type-reinterpret-cast, performance-no-int-to-ptr)
+        const auto first = reinterpret_cast<std::uintptr_t>(memory.data()) / page_size * page_size;
+        const auto last = reinterpret_cast<std::uintptr_t>(memory.data() + memory.size());
+        const auto length = (last - first + page_size - 1_usize) / page_size * page_size;
+        const auto mask = detail::numa::single_node_mask(node);
+        if(!detail::numa::mbind(reinterpret_cast<void*>(first),
+                                length,
+                                detail::numa::k_policy_bind,
+                                &mask,
+                                detail::numa::k_move_pages)
+           && !detail::numa::ignorable(numa_node_count()))
+        {
+            return unexpected{NumaError::MigrationFailed};
+        }
+        // NOLINTEND(*-pro-type-reinterpret-cast, performance-no-int-to-ptr)
+#endif // HYPERION_PLATFORM_IS_LINUX
+        return {};
+    }
+
+    /// @brief Initializes `values` from `thread_count` worker threads spread across the NUMA
+    /// nodes, so that its pages are placed on the nodes of the threads that first touch them.
+    ///
+    /// `values` is divided into `thread_count` contiguous chunks of whole pages, and worker `i`
+    /// calls `initialize(chunk, i)` on the `i`th chunk while running on a CPU of node
+    /// `i * numa_node_count() / thread_count`. Computations that divide `values` the same way
+    /// then find each chunk local to the node running it. On single-node hosts the workers are
+    /// not pinned.
+    ///
+    /// `values` must not have been touched yet for its pages to be placed.
+    /// @tparam TType The element type
+    /// @param values The memory to initialize
+    /// @param thread_count The number of worker threads, and chunks
+    /// @param initialize The callback initializing each chunk
+    /// @ingroup numa
+    /// @headerfile hyperion/platform/numa.h
+    template<typename TType, typename TCallback>
+        requires std::is_trivially_copyable_v<TType>
+                 && std::invocable<TCallback&, std::span<TType>, usize>
+    inline auto
+    parallel_first_touch(std::span<TType> values, usize thread_count, TCallback&& initialize)
+        -> void {
+        HYPERION_ASSERT(thread_count != 0_usize, "parallel_first_touch requires a thread");
+
+        const auto node_count = numa_node_count();
+        const auto page_elements = std::max(detail::numa::page_size() / sizeof(TType), 1_usize);
+        const auto pages = (values.size() + page_elements - 1_usize) / page_elements;
+
+        auto node_cpus = std::vector<std::vector<usize>>{};
+        if(node_count > 1_usize) {
+            for(auto node = 0_usize; node < node_count; ++node) {
+                node_cpus.push_back(numa_node_cpus(node));
+            }
+        }
+
+        auto workers = std::vector<std::jthread>{};
+        workers.reserve(thread_count);
+        for(auto worker = 0_usize; worker < thread_count; ++worker) {
+            const auto begin = std::min(worker * pages / thread_count * page_elements,
+                                        values.size());
+            const auto end = std::min((worker + 1_usize) * pages / thread_count * page_elements,
+                                      values.size());
+            workers.emplace_back([&, worker, begin, end] {
+#if HYPERION_PLATFORM_IS_LINUX
+                if(!node_cpus.empty()) {
+                    auto cpus = cpu_set_t{};
+                    CPU_ZERO(&cpus);
+                    for(const auto cpu : node_cpus[worker * node_count / thread_count]) {
+                        CPU_SET(cpu, &cpus);
+                    }
+                    static_cast<void>(::sched_setaffinity(0, sizeof(cpus), &cpus));
+                }
+#endif // HYPERION_PLATFORM_IS_LINUX
+                initialize(values.subspan(begin, end - begin), worker);
+            });
+        }
+    }
+
+    /// @brief Zero-initializes `values` from `thread_count` worker threads spread across the
+    /// NUMA nodes. See the overload taking an initialization callback
+    /// @tparam TType The element type
+    /// @param values The memory to initialize
+    /// @param thread_count The number of worker threads, and chunks
+    /// @ingroup numa
+    /// @headerfile hyperion/platform/numa.h
+    template<typename TType>
+        requires std::is_trivially_copyable_v<TType>
+    inline auto parallel_first_touch(
+        std::span<TType> values,
+        usize thread_count = std::max(std::thread::hardware_concurrency(), 1U)) -> void {
+        parallel_first_touch(values, thread_count, [](std::span<TType> chunk, usize) {
+            std::fill(chunk.begin(), chunk.end(), TType{});
+        });
+    }
+
+} // namespace hyperion::platform
+
+#if defined(HYPERION_ENABLE_TESTING) && HYPERION_ENABLE_TESTING
+
+    #include <boost/ut.hpp>
+
+namespace hyperion::_test::platform::numa {
+
+    // NOLINTNEXTLINE(google-build-using-namespace)
+    using namespace boost::ut;
+    // NOLINTNEXTLINE(google-build-using-namespace)
+    using namespace hyperion::platform;
+
+    // NOLINTNEXTLINE(cert-err58-cpp)
+    static const suite<"hyperion::platform::numa"> numa_tests = [] {
+        "parse_list"_test = [] {
+            expect(hyperion::platform::detail::numa::parse_list("0-3,8,10-11\n")
+                   == std::vector<usize>{0, 1, 2, 3, 8, 10, 11});
+            expect(hyperion::platform::detail::numa::parse_list("").empty());
+        };
+
+        "topology"_test = [] {
+            expect(that % numa_node_count() >= 1_usize);
+            expect(that % current_numa_node() < numa_node_count());
+            expect(!numa_node_cpus(0_usize).empty());
+        };
+
+        "allocation"_test = [] {
+            auto on_node = numa_buffer::allocate_on_node(10'000_usize, 0_usize);
+            expect(on_node.has_value());
+            expect(that % (on_node->size() % 4096_usize) == 0_usize);
+            expect(that % on_node->size() >= 10'000_usize);
+            on_node->bytes().back() = std::byte{1};
+
+            expect(numa_buffer::allocate_local(4096_usize).has_value());
+            expect(numa_buffer::allocate_interleaved(1_usize << 20U).has_value());
+            expect(numa_buffer::allocate_on_node(4096_usize, numa_node_count()).error()
+                   == NumaError::InvalidNode);
+            expect(numa_buffer::allocate(0_usize).error() == NumaError::AllocationFailed);
+
+            auto moved = std::move(*on_node);
+            expect(that % moved.bytes().back() == std::byte{1});
+            expect(migrate_to_node(moved.bytes().subspan(100, 5'000), 0_usize).has_value());
+            expect(that % moved.bytes().back() == std::byte{1});
+        };
+
+        "memory_policy"_test = [] {
+            // policies are per thread, so apply them on a scratch thread
+            auto bound = false;
+            auto reset = false;
+            std::jthread{[&] {
+                bound = bind_memory_to_current_node().has_value();
+                auto values = std::vector<u64>(100'000, 7_u64);
+                reset = reset_memory_policy().has_value() && values.back() == 7_u64;
+            }}.join();
+            expect(bound);
+            expect(reset);
+        };
+
+        "parallel_first_touch"_test = [] {
+            auto buffer = numa_buffer::allocate(1_usize << 20U);
+            expect(buffer.has_value());
+            const auto values = std::span{reinterpret_cast<u32*>(buffer->data()), // NOLINT
+                                          buffer->size() / sizeof(u32)};
+
+            parallel_first_touch(values, 5_usize, [](std::span<u32> chunk, usize worker) {
+                std::fill(chunk.begin(), chunk.end(), static_cast<u32>(worker + 1_usize));
+            });
+            auto all_touched = true;
+            auto previous = 1_u32;
+            for(const auto value : values) {
+                all_touched = all_touched && value >= previous && value <= 5_u32;
+                previous = value;
+            }
+            expect(all_touched);
+            expect(that % values.back() == 5_u32);
+
+            parallel_first_touch(values, 3_usize);
+            expect(std::all_of(values.begin(), values.end(), [](u32 value) { return value == 0; }));
+        };
+    };
+
+} // namespace hyperion::_test::platform::numa
+
+#endif // defined(HYPERION_ENABLE_TESTING) && HYPERION_ENABLE_TESTING
+
+#endif // HYPERION_PLATFORM_NUMA_H
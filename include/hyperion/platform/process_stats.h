@@ -0,0 +1,518 @@
+/// @file process_stats.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Low-overhead sampling of process memory, page-fault, scheduling and CPU-time statistics
+/// @version 0.4.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2024 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+#ifndef HYPERION_PLATFORM_PROCESS_STATS_H
+#define HYPERION_PLATFORM_PROCESS_STATS_H
+
+#include <hyperion/platform.h>
+#include <hyperion/platform/def.h>
+#include <hyperion/platform/expected.h>
+#include <hyperion/platform/types.h>
+
+#include <array>
+#include <charconv>
+#include <chrono>
+#include <string_view>
+#include <utility>
+
+#if HYPERION_PLATFORM_IS_LINUX
+    #include <fcntl.h>
+    #include <sys/resource.h>
+    #include <unistd.h>
+#endif // HYPERION_PLATFORM_IS_LINUX
+
+/// @ingroup platform
+/// @{
+///	@defgroup process_stats Process Statistics
+/// `hyperion::platform::process_stats_sampler` takes snapshots of the calling process's
+/// resident memory, page faults, context switches and CPU time, cheaply enough to sample every
+/// frame or request. It is intended for correlating latency spikes with page-fault storms,
+/// transparent huge page compaction, or scheduler preemption in-process, at the program's own
+/// resolution, rather than through an external collector.
+///
+/// Each sample reads `/proc/self/stat` for the current resident and virtual memory sizes, and
+/// calls `getrusage` for page faults, context switches and CPU time. The procfs files are
+/// opened once, when the sampler is created, and re-read in place, so a sample is one `pread`
+/// and one `getrusage` call, with no allocation. Optionally, each sample also reads
+/// `/proc/self/smaps_rollup` for the proportional set size, swap usage, and memory backed by
+/// transparent huge pages. This requires the kernel to walk all of the process's mappings, so
+/// is considerably more expensive, and is off by default.
+///
+/// `sample_and_plot` additionally records each statistic as a profiling plot with
+/// `HYPERION_PROFILE_PLOT`, feeding `TracyPlot` in builds with Tracy profiling enabled.
+/// Counters are plotted as their change since the previous sample, so that a burst of faults
+/// shows as a spike.
+///
+/// The statistics are only available on Linux. Elsewhere, `create` returns
+/// `ProcessStatsError::Unsupported`.
+///
+/// # Example
+/// @code {.cpp}
+/// auto sampler = hyperion::platform::process_stats_sampler::create().value();
+///
+/// while(running) {
+///     process_frame();
+///     HYPERION_PROFILE_MARK_FRAME();
+///     hyperion::ignore(sampler.sample_and_plot());
+/// }
+/// @endcode
+/// @headerfile hyperion/platform/process_stats.h
+/// @}
+
+namespace hyperion::platform {
+
+    /// @brief Errors that can occur when sampling process statistics
+    /// @ingroup process_stats
+    /// @headerfile hyperion/platform/process_stats.h
+    enum class ProcessStatsError : u8 {
+        /// @brief Process statistics are not supported on this platform
+        Unsupported,
+        /// @brief A statistics file could not be opened
+        OpenFailed,
+        /// @brief The statistics could not be read or parsed
+        ReadFailed,
+    };
+
+    /// @brief A snapshot of the calling process's resource usage
+    /// @ingroup process_stats
+    /// @headerfile hyperion/platform/process_stats.h
+    struct process_stats {
+        /// @brief The resident set size, in bytes
+        usize resident_bytes = 0_usize;
+        /// @brief The peak resident set size over the process's lifetime, in bytes
+        usize peak_resident_bytes = 0_usize;
+        /// @brief The size of the process's virtual address space, in bytes
+        usize virtual_bytes = 0_usize;
+        /// @brief The number of page faults serviced without I/O
+        u64 minor_faults = 0_u64;
+        /// @brief The number of page faults that required I/O
+        u64 major_faults = 0_u64;
+        /// @brief The number of times the process gave up the CPU voluntarily, usually by
+        /// blocking
+        u64 voluntary_context_switches = 0_u64;
+        /// @brief The number of times the process was preempted
+        u64 involuntary_context_switches = 0_u64;
+        /// @brief The CPU time spent in user mode
+        std::chrono::microseconds user_time{};
+        /// @brief The CPU time spent in the kernel
+        std::chrono::microseconds system_time{};
+        /// @brief The proportional set size, in bytes. Only sampled when the sampler reads
+        /// `/proc/self/smaps_rollup`
+        usize proportional_bytes = 0_usize;
+        /// @brief The amount of the process's memory swapped out, in bytes. Only sampled when
+        /// the sampler reads `/proc/self/smaps_rollup`
+        usize swapped_bytes = 0_usize;
+        /// @brief The amount of anonymous memory backed by transparent huge pages, in bytes.
+        /// Only sampled when the sampler reads `/proc/self/smaps_rollup`
+        usize huge_page_bytes = 0_usize;
+    };
+
+    namespace detail::process_stats {
+        [[nodiscard]] inline auto parse_number(std::string_view text, u64& value) noexcept
+            -> bool {
+            const auto* const end = text.data() + text.size(); // NOLINT(*-pointer-arithmetic)
+            return std::from_chars(text.data(), end, value).ec == std::errc{};
+        }
+
+        /// @brief Parses the virtual and resident sizes from the contents of `/proc/<pid>/stat`
+        /// @param contents The file contents
+        /// @param page_size The system's page size
+        /// @param stats The snapshot to fill in
+        /// @return Whether the contents could be parsed
+        [[nodiscard]] inline auto
+        parse_stat(std::string_view contents, usize page_size, platform::process_stats& stats)
+            noexcept -> bool {
+            // the executable name, field 2, is parenthesized and may itself contain spaces or
+            // parentheses, so fields are counted from the last closing parenthesis
+            const auto name_end = contents.rfind(')');
+            if(name_end == std::string_view::npos) {
+                return false;
+            }
+            contents.remove_prefix(name_end + 1_usize);
+
+            static constexpr auto k_virtual_field = 23_usize;
+            static constexpr auto k_resident_field = 24_usize;
+            auto field = 2_usize;
+            auto virtual_bytes = 0_u64;
+            auto resident_pages = 0_u64;
+            while(field < k_resident_field) {
+                const auto start = contents.find_first_not_of(' ');
+                if(start == std::string_view::npos) {
+                    return false;
+                }
+                contents.remove_prefix(start);
+                const auto token = contents.substr(0_usize, contents.find(' '));
+                contents.remove_prefix(token.size());
+                ++field;
+
+                if(field == k_virtual_field && !parse_number(token, virtual_bytes)) {
+                    return false;
+                }
+                if(field == k_resident_field && !parse_number(token, resident_pages)) {
+                    return false;
+                }
+            }
+
+            stats.virtual_bytes = static_cast<usize>(virtual_bytes);
+            stats.resident_bytes = static_cast<usize>(resident_pages) * page_size;
+            return true;
+        }
+
+        /// @brief Parses the proportional set size, swap usage, and transparent huge page usage
+        /// from the contents of `/proc/<pid>/smaps_rollup`
+        /// @param contents The file contents
+        /// @param stats The snapshot to fill in
+        /// @return Whether the contents could be parsed
+        [[nodiscard]] inline auto
+        parse_smaps_rollup(std::string_view contents, platform::process_stats& stats) noexcept
+            -> bool {
+            auto found = 0_usize;
+            while(!contents.empty()) {
+                const auto line_end = contents.find('\n');
+                auto line = contents.substr(0_usize, line_end);
+                contents.remove_prefix(line_end == std::string_view::npos ? contents.size()
+                                                                          : line_end + 1_usize);
+
+                // lines look like `Pss:                1234 kB`
+                const auto colon = line.find(':');
+                if(colon == std::string_view::npos) {
+                    continue;
+                }
+                const auto key = line.substr(0_usize, colon);
+                line.remove_prefix(colon + 1_usize);
+                const auto start = line.find_first_not_of(' ');
+                if(start == std::string_view::npos) {
+                    continue;
+                }
+                line.remove_prefix(start);
+
+                auto* destination = static_cast<usize*>(nullptr);
+                if(key == "Pss") {
+                    destination = &stats.proportional_bytes;
+                }
+                else if(key == "Swap") {
+                    destination = &stats.swapped_bytes;
+                }
+                else if(key == "AnonHugePages") {
+                    destination = &stats.huge_page_bytes;
+                }
+                auto kibibytes = 0_u64;
+                if(destination != nullptr
+                   && parse_number(line.substr(0_usize, line.find(' ')), kibibytes))
+                {
+                    *destination = static_cast<usize>(kibibytes) * 1024_usize;
+                    ++found;
+                }
+            }
+            return found != 0_usize;
+        }
+    } // namespace detail::process_stats
+
+    /// @brief Samples the calling process's resource usage
+    ///
+    /// A sampler is not internally synchronized; use one per sampling thread.
+    /// @ingroup process_stats
+    /// @headerfile hyperion/platform/process_stats.h
+    class process_stats_sampler {
+      public:
+        /// @brief Whether process statistics can be sampled on this platform
+        static constexpr auto is_supported = HYPERION_PLATFORM_IS_LINUX;
+
+        process_stats_sampler(const process_stats_sampler&) = delete;
+        process_stats_sampler(process_stats_sampler&& other) noexcept
+            : m_stat{std::exchange(other.m_stat, -1)},
+              m_smaps_rollup{std::exchange(other.m_smaps_rollup, -1)},
+              m_page_size{other.m_page_size},
+              m_previous{other.m_previous},
+              m_has_previous{std::exchange(other.m_has_previous, false)} {
+        }
+
+        ~process_stats_sampler() noexcept {
+            release();
+        }
+
+        auto operator=(const process_stats_sampler&) -> process_stats_sampler& = delete;
+        auto operator=(process_stats_sampler&& other) noexcept -> process_stats_sampler& {
+            if(this != &other) {
+                release();
+                m_stat = std::exchange(other.m_stat, -1);
+                m_smaps_rollup = std::exchange(other.m_smaps_rollup, -1);
+                m_page_size = other.m_page_size;
+                m_previous = other.m_previous;
+                m_has_previous = std::exchange(other.m_has_previous, false);
+            }
+            return *this;
+        }
+
+        /// @brief Creates a sampler for the calling process
+        /// @param read_smaps_rollup Whether to also sample `/proc/self/smaps_rollup`, for the
+        /// proportional set size, swap, and transparent huge page usage. This is considerably
+        /// more expensive than the other statistics
+        /// @return The sampler, or the reason it could not be created
+        [[nodiscard]] static auto create(bool read_smaps_rollup = false) noexcept
+            -> expected<process_stats_sampler, ProcessStatsError> {
+#if HYPERION_PLATFORM_IS_LINUX
+            auto sampler = process_stats_sampler{};
+            sampler.m_page_size = static_cast<usize>(::sysconf(_SC_PAGESIZE));
+            sampler.m_stat = ::open("/proc/self/stat", O_RDONLY | O_CLOEXEC); // NOLINT
+            if(sampler.m_stat < 0) {
+                return unexpected{ProcessStatsError::OpenFailed};
+            }
+            if(read_smaps_rollup) {
+                // NOLINTNEXTLINE(*-vararg)
+                sampler.m_smaps_rollup = ::open("/proc/self/smaps_rollup", O_RDONLY | O_CLOEXEC);
+                if(sampler.m_smaps_rollup < 0) {
+                    return unexpected{ProcessStatsError::OpenFailed};
+                }
+            }
+            return sampler;
+#else
+            static_cast<void>(read_smaps_rollup);
+            return unexpected{ProcessStatsError::Unsupported};
+#endif // HYPERION_PLATFORM_IS_LINUX
+        }
+
+        /// @brief Takes a snapshot of the process's resource usage
+        /// @return The snapshot, or the reason it could not be taken
+        [[nodiscard]] auto sample() noexcept -> expected<process_stats, ProcessStatsError> {
+            auto stats = process_stats{};
+#if HYPERION_PLATFORM_IS_LINUX
+            auto buffer = std::array<char, 4096_usize>{};
+            const auto read = [&buffer](int descriptor) noexcept -> std::string_view {
+                const auto size = ::pread(descriptor, buffer.data(), buffer.size(), 0);
+                return size <= 0 ? std::string_view{}
+                                 : std::string_view{buffer.data(), static_cast<usize>(size)};
+            };
+
+            if(!detail::process_stats::parse_stat(read(m_stat), m_page_size, stats)) {
+                return unexpected{ProcessStatsError::ReadFailed};
+            }
+            if(m_smaps_rollup >= 0
+               && !detail::process_stats::parse_smaps_rollup(read(m_smaps_rollup), stats))
+            {
+                return unexpected{ProcessStatsError::ReadFailed};
+            }
+
+            auto usage = rusage{};
+            if(::getrusage(RUSAGE_SELF, &usage) != 0) {
+                return unexpected{ProcessStatsError::ReadFailed};
+            }
+            const auto to_duration = [](const timeval& time) noexcept {
+                return std::chrono::seconds{time.tv_sec} + std::chrono::microseconds{time.tv_usec};
+            };
+            // ru_maxrss is in kibibytes
+            stats.peak_resident_bytes = static_cast<usize>(usage.ru_maxrss) * 1024_usize;
+            stats.minor_faults = static_cast<u64>(usage.ru_minflt);
+            stats.major_faults = static_cast<u64>(usage.ru_majflt);
+            stats.voluntary_context_switches = static_cast<u64>(usage.ru_nvcsw);
+            stats.involuntary_context_switches = static_cast<u64>(usage.ru_nivcsw);
+            stats.user_time = to_duration(usage.ru_utime);
+            stats.system_time = to_duration(usage.ru_stime);
+            return stats;
+#else
+            return unexpected{ProcessStatsError::Unsupported};
+#endif // HYPERION_PLATFORM_IS_LINUX
+        }
+
+        /// @brief Takes a snapshot of the process's resource usage and records it as profiling
+        /// plots.
+        ///
+        /// Memory sizes are plotted as they are, while counters and CPU times are plotted as
+        /// their change since the previous call. Nothing is plotted unless profiling is enabled.
+        /// @return The snapshot, or the reason it could not be taken
+        [[nodiscard]] auto sample_and_plot() noexcept
+            -> expected<process_stats, ProcessStatsError> {
+            auto stats = sample();
+            if(!stats) {
+                return stats;
+            }
+
+#if HYPERION_PLATFORM_PROFILING_ENABLED
+            const auto& previous = m_has_previous ? m_previous : *stats;
+            const auto plot_size = [](const char* name, usize value) noexcept {
+                HYPERION_PROFILE_PLOT(name, static_cast<i64>(value));
+            };
+            const auto plot_delta = [](const char* name, u64 current, u64 last) noexcept {
+                HYPERION_PROFILE_PLOT(name, static_cast<i64>(current - last));
+            };
+            plot_size("hyperion::process::resident_bytes", stats->resident_bytes);
+            plot_size("hyperion::process::virtual_bytes", stats->virtual_bytes);
+            plot_delta("hyperion::process::minor_faults",
+                       stats->minor_faults,
+                       previous.minor_faults);
+            plot_delta("hyperion::process::major_faults",
+                       stats->major_faults,
+                       previous.major_faults);
+            plot_delta("hyperion::process::voluntary_context_switches",
+                       stats->voluntary_context_switches,
+                       previous.voluntary_context_switches);
+            plot_delta("hyperion::process::involuntary_context_switches",
+                       stats->involuntary_context_switches,
+                       previous.involuntary_context_switches);
+            plot_delta("hyperion::process::user_time_us",
+                       static_cast<u64>(stats->user_time.count()),
+                       static_cast<u64>(previous.user_time.count()));
+            plot_delta("hyperion::process::system_time_us",
+                       static_cast<u64>(stats->system_time.count()),
+                       static_cast<u64>(previous.system_time.count()));
+            if(m_smaps_rollup >= 0) {
+                plot_size("hyperion::process::proportional_bytes", stats->proportional_bytes);
+                plot_size("hyperion::process::swapped_bytes", stats->swapped_bytes);
+                plot_size("hyperion::process::huge_page_bytes", stats->huge_page_bytes);
+            }
+#endif // HYPERION_PLATFORM_PROFILING_ENABLED
+
+            m_previous = *stats;
+            m_has_previous = true;
+            return stats;
+        }
+
+      private:
+        int m_stat = -1;
+        int m_smaps_rollup = -1;
+        usize m_page_size = 0_usize;
+        process_stats m_previous{};
+        bool m_has_previous = false;
+
+        process_stats_sampler() noexcept = default;
+
+        auto release() noexcept -> void {
+#if HYPERION_PLATFORM_IS_LINUX
+            if(m_stat >= 0) {
+                ::close(m_stat);
+            }
+            if(m_smaps_rollup >= 0) {
+                ::close(m_smaps_rollup);
+            }
+#endif // HYPERION_PLATFORM_IS_LINUX
+            m_stat = -1;
+            m_smaps_rollup = -1;
+        }
+    };
+
+} // namespace hyperion::platform
+
+#if defined(HYPERION_ENABLE_TESTING) && HYPERION_ENABLE_TESTING
+
+    #include <boost/ut.hpp>
+
+    #if HYPERION_PLATFORM_IS_LINUX
+        #include <sys/mman.h>
+    #endif // HYPERION_PLATFORM_IS_LINUX
+
+namespace hyperion::_test::platform::process_stats {
+
+    // NOLINTNEXTLINE(google-build-using-namespace)
+    using namespace boost::ut;
+    // NOLINTNEXTLINE(google-build-using-namespace)
+    using namespace hyperion::platform;
+
+    // NOLINTNEXTLINE(cert-err58-cpp)
+    static const suite<"hyperion::platform::process_stats"> process_stats_tests = [] {
+        "parse_stat"_test = [] {
+            // an executable name containing spaces and parentheses
+            static constexpr auto contents = std::string_view{
+                "4242 (my (odd) app) S 1 4242 4242 0 -1 4194560 1000 0 3 0 15 7 0 0 20 0 1 0 "
+                "123456 10485760 300 18446744073709551615 1 1 0 0 0 0 0 0 0 0 0 0 17 0 0 0 0\n"};
+            auto stats = hyperion::platform::process_stats{};
+            expect(
+                hyperion::platform::detail::process_stats::parse_stat(contents, 4096_usize, stats));
+            expect(that % stats.virtual_bytes == 10'485'760_usize);
+            expect(that % stats.resident_bytes == 300_usize * 4096_usize);
+
+            expect(!hyperion::platform::detail::process_stats::parse_stat("4242 (app) S 1 2",
+                                                                          4096_usize,
+                                                                          stats));
+        };
+
+        "parse_smaps_rollup"_test = [] {
+            static constexpr auto contents = std::string_view{
+                "00400000-7fffffffe000 ---p 00000000 00:00 0    [rollup]\n"
+                "Rss:                2048 kB\n"
+                "Pss:                1024 kB\n"
+                "Swap:                  8 kB\n"
+                "AnonHugePages:       512 kB\n"};
+            auto stats = hyperion::platform::process_stats{};
+            expect(hyperion::platform::detail::process_stats::parse_smaps_rollup(contents, stats));
+            expect(that % stats.proportional_bytes == 1024_usize * 1024_usize);
+            expect(that % stats.swapped_bytes == 8_usize * 1024_usize);
+            expect(that % stats.huge_page_bytes == 512_usize * 1024_usize);
+        };
+
+        "sample"_test = [] {
+            auto sampler = process_stats_sampler::create();
+            if constexpr(!process_stats_sampler::is_supported) {
+                expect(sampler.error() == ProcessStatsError::Unsupported);
+                return;
+            }
+            expect(sampler.has_value());
+
+            const auto before = sampler->sample_and_plot();
+            expect(before.has_value());
+            expect(that % before->resident_bytes > 0_usize);
+            expect(that % before->virtual_bytes >= before->resident_bytes);
+            expect(that % before->peak_resident_bytes > 0_usize);
+
+    #if HYPERION_PLATFORM_IS_LINUX
+            // touching freshly mapped memory faults its pages in
+            static constexpr auto size = 8_usize * 1024_usize * 1024_usize;
+            auto* const memory = static_cast<u8*>(
+                ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+            expect(memory != MAP_FAILED); // NOLINT(*-cstyle-cast, performance-no-int-to-ptr)
+            for(auto index = 0_usize; index < size; index += 4096_usize) {
+                memory[index] = 1; // NOLINT(*-pro-bounds-pointer-arithmetic)
+            }
+            auto moved = std::move(*sampler);
+            const auto after = moved.sample_and_plot();
+            ::munmap(memory, size);
+            expect(after.has_value());
+            expect(that % after->minor_faults > before->minor_faults);
+            expect(after->user_time + after->system_time
+                   >= before->user_time + before->system_time);
+    #endif // HYPERION_PLATFORM_IS_LINUX
+        };
+
+        "smaps_rollup"_test = [] {
+            auto sampler = process_stats_sampler::create(true);
+            if(!sampler) {
+                // smaps_rollup requires Linux 4.14
+                expect(sampler.error() == ProcessStatsError::OpenFailed
+                       || sampler.error() == ProcessStatsError::Unsupported);
+                return;
+            }
+            const auto stats = sampler->sample();
+            expect(stats.has_value());
+            expect(that % stats->proportional_bytes > 0_usize);
+        };
+    };
+
+} // namespace hyperion::_test::platform::process_stats
+
+#endif // defined(HYPERION_ENABLE_TESTING) && HYPERION_ENABLE_TESTING
+
+#endif // HYPERION_PLATFORM_PROCESS_STATS_H
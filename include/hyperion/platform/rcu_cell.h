@@ -0,0 +1,466 @@
+/// @file rcu_cell.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Read-copy-update cell for read-mostly shared values
+/// @version 0.4.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2024 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef HYPERION_PLATFORM_RCU_CELL_H
+#define HYPERION_PLATFORM_RCU_CELL_H
+
+#include <hyperion/platform.h>
+#include <hyperion/platform/cpu.h>
+#include <hyperion/platform/def.h>
+#include <hyperion/platform/types.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/// @ingroup platform
+/// @{
+///	@defgroup rcu_cell RCU Cell
+/// `hyperion::rcu_cell<T>` holds a read-mostly value (configuration, routing tables, etc) that
+/// many threads read concurrently and that is occasionally replaced wholesale.
+///
+/// Readers obtain a snapshot of the current value with a single atomic increment of a per-CPU,
+/// cache-line-padded counter and a load of the current version. Taking a snapshot never blocks,
+/// never allocates, and never writes to a cache line shared with readers on other CPUs.
+/// Writers publish a new version and defer reclamation of the previous one until every reader
+/// that could still observe it has released its snapshot.
+///
+/// # Example
+/// @code {.cpp}
+/// hyperion::rcu_cell<config> g_config{load_config()};
+///
+/// auto handle_request(const request& req) -> void {
+///     const auto snapshot = g_config.read();
+///     apply(snapshot->limits, req);
+/// }
+///
+/// auto reload() -> void {
+///     g_config.store(load_config());
+/// }
+/// @endcode
+/// @headerfile hyperion/platform/rcu_cell.h
+/// @}
+
+namespace hyperion {
+
+    namespace detail::rcu {
+        HYPERION_IGNORE_PADDING_WARNING_START;
+
+        struct alignas(HYPERION_PLATFORM_CACHE_LINE_SIZE) reader_slot {
+            std::array<std::atomic<usize>, 2> readers = {0_usize, 0_usize};
+        };
+
+        HYPERION_IGNORE_PADDING_WARNING_STOP;
+
+        static_assert(sizeof(reader_slot) == HYPERION_PLATFORM_CACHE_LINE_SIZE,
+                      "reader_slot must occupy exactly one cache line");
+
+        [[nodiscard]] inline auto default_slot_count() noexcept -> usize {
+            const auto threads = std::max(std::thread::hardware_concurrency(), 1U);
+            return std::bit_ceil(static_cast<usize>(threads));
+        }
+    } // namespace detail::rcu
+
+    /// @brief A read-copy-update cell holding a shared, read-mostly value of type `TType`.
+    ///
+    /// Readers take wait-free, allocation-free snapshots via `read()`. Writers are serialized
+    /// with each other, publish new versions via `store`, `emplace`, or `update`, and reclaim
+    /// superseded versions once a grace period has elapsed, i.e. once every reader that
+    /// could have observed them has released its snapshot.
+    ///
+    /// Grace periods are tracked with a pair of reader counters per CPU. Publishing a version
+    /// flips which counter new readers register with, so superseded versions only wait on the
+    /// (bounded) set of readers that were already active. Writers never block on readers;
+    /// superseded versions are reclaimed opportunistically on subsequent writes or explicitly
+    /// via `reclaim()`, and `synchronize()` waits for all of them to be reclaimed.
+    ///
+    /// @tparam TType The type of the held value
+    /// @ingroup rcu_cell
+    /// @headerfile hyperion/platform/rcu_cell.h
+    template<typename TType>
+        requires std::is_object_v<TType>
+    class rcu_cell {
+      public:
+        /// @brief A snapshot of the value of an `rcu_cell` at the time it was taken.
+        ///
+        /// The referenced value remains valid for the lifetime of the snapshot, regardless of
+        /// concurrent writes to the cell. Snapshots should be short-lived, as they delay the
+        /// reclamation of superseded versions.
+        class snapshot {
+          public:
+            snapshot(const snapshot&) = delete;
+            constexpr snapshot(snapshot&& other) noexcept
+                : m_value(std::exchange(other.m_value, nullptr)),
+                  m_readers(std::exchange(other.m_readers, nullptr)) {
+            }
+            ~snapshot() noexcept {
+                if(m_readers != nullptr) {
+                    m_readers->fetch_sub(1_usize, std::memory_order_release);
+                }
+            }
+            auto operator=(const snapshot&) -> snapshot& = delete;
+            auto operator=(snapshot&&) -> snapshot& = delete;
+
+            /// @brief Returns the snapshotted value
+            /// @return The value
+            [[nodiscard]] constexpr auto get() const noexcept -> const TType& {
+                return *m_value;
+            }
+
+            [[nodiscard]] constexpr auto operator*() const noexcept -> const TType& {
+                return *m_value;
+            }
+
+            [[nodiscard]] constexpr auto operator->() const noexcept -> const TType* {
+                return m_value;
+            }
+
+          private:
+            friend class rcu_cell;
+
+            constexpr snapshot(const TType* value, std::atomic<usize>* readers) noexcept
+                : m_value(value), m_readers(readers) {
+            }
+
+            const TType* m_value;
+            std::atomic<usize>* m_readers;
+        };
+
+        /// @brief Constructs an `rcu_cell` holding a value constructed from `args`
+        ///
+        /// @param args The arguments to construct the initial value with
+        template<typename... TArgs>
+            requires std::constructible_from<TType, TArgs...>
+        explicit rcu_cell(std::in_place_t /*unused*/, TArgs&&... args)
+            : m_current(new TType(std::forward<TArgs>(args)...)), // NOLINT
+              m_slot_count(detail::rcu::default_slot_count()),
+              m_slots(std::make_unique<detail::rcu::reader_slot[]>(m_slot_count)) {
+        }
+
+        /// @brief Constructs an `rcu_cell` holding `value`
+        ///
+        /// @param value The initial value
+        explicit rcu_cell(TType value)
+            requires std::move_constructible<TType>
+            : rcu_cell(std::in_place, std::move(value)) {
+        }
+
+        /// @brief Constructs an `rcu_cell` holding a default-constructed value
+        rcu_cell()
+            requires std::default_initializable<TType>
+            : rcu_cell(std::in_place) {
+        }
+
+        rcu_cell(const rcu_cell&) = delete;
+        rcu_cell(rcu_cell&&) = delete;
+
+        /// @brief Destroys the `rcu_cell`, its current value, and all superseded values
+        /// @pre No snapshots of this cell are alive
+        ~rcu_cell() noexcept {
+            delete m_current.load(std::memory_order_acquire); // NOLINT
+            for(auto& retired : m_retired) {
+                delete retired.value; // NOLINT
+            }
+        }
+
+        auto operator=(const rcu_cell&) -> rcu_cell& = delete;
+        auto operator=(rcu_cell&&) -> rcu_cell& = delete;
+
+        /// @brief Takes a snapshot of the current value. Wait-free and allocation-free.
+        /// @return The snapshot
+        [[nodiscard]] auto read() const noexcept -> snapshot {
+            auto& slot = m_slots[platform::current_cpu() & (m_slot_count - 1_usize)];
+            const auto phase = m_phase.load(std::memory_order_relaxed);
+            auto& readers = slot.readers[phase]; // NOLINT(*-pro-bounds-constant-array-index)
+            readers.fetch_add(1_usize, std::memory_order_seq_cst);
+            return snapshot{m_current.load(std::memory_order_seq_cst), &readers};
+        }
+
+        /// @brief Returns a copy of the current value
+        /// @return A copy of the value
+        [[nodiscard]] auto load() const -> TType
+            requires std::copy_constructible<TType>
+        {
+            return read().get();
+        }
+
+        /// @brief Publishes `value` as the new version of this cell
+        ///
+        /// @param value The new value
+        auto store(TType value) -> void
+            requires std::move_constructible<TType>
+        {
+            emplace(std::move(value));
+        }
+
+        /// @brief Publishes a new version of this cell, constructed in place from `args`
+        ///
+        /// @param args The arguments to construct the new value with
+        template<typename... TArgs>
+            requires std::constructible_from<TType, TArgs...>
+        auto emplace(TArgs&&... args) -> void {
+            auto next = std::make_unique<TType>(std::forward<TArgs>(args)...);
+            const auto lock = std::scoped_lock{m_writer};
+            publish(next.release());
+        }
+
+        /// @brief Publishes the result of invoking `func` on the current value as the new
+        /// version of this cell. Concurrent updates are serialized, so `func` always observes
+        /// the latest version.
+        ///
+        /// @param func The function computing the new value from the current one
+        template<typename TFunc>
+            requires std::invocable<TFunc, const TType&>
+                     && std::constructible_from<TType, std::invoke_result_t<TFunc, const TType&>>
+        auto update(TFunc&& func) -> void {
+            const auto lock = std::scoped_lock{m_writer};
+            auto next = std::make_unique<TType>(
+                std::invoke(std::forward<TFunc>(func),
+                            std::as_const(*m_current.load(std::memory_order_relaxed))));
+            publish(next.release());
+        }
+
+        /// @brief Reclaims every superseded version whose grace period has elapsed,
+        /// without waiting on readers
+        /// @return The number of versions reclaimed
+        auto reclaim() -> usize {
+            const auto lock = std::scoped_lock{m_writer};
+            return poll();
+        }
+
+        /// @brief Waits until every superseded version has been reclaimed
+        auto synchronize() -> void {
+            auto lock = std::unique_lock{m_writer};
+            poll();
+            while(!m_retired.empty()) {
+                lock.unlock();
+                std::this_thread::yield();
+                lock.lock();
+                poll();
+            }
+        }
+
+        /// @brief Returns the number of superseded versions awaiting reclamation
+        /// @return The number of pending versions
+        [[nodiscard]] auto pending() const -> usize {
+            const auto lock = std::scoped_lock{m_writer};
+            return m_retired.size();
+        }
+
+      private:
+        struct retired_version {
+            TType* value;
+            u64 grace_periods;
+        };
+
+        auto publish(TType* next) -> void {
+            auto* previous = m_current.exchange(next, std::memory_order_seq_cst);
+            m_retired.push_back({.value = previous, .grace_periods = m_grace_periods});
+            poll();
+        }
+
+        [[nodiscard]] auto drained(usize phase) const noexcept -> bool {
+            for(auto i = 0_usize; i < m_slot_count; ++i) {
+                // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                if(m_slots[i].readers[phase].load(std::memory_order_seq_cst) != 0_usize) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // A version retired after `n` completed grace periods may still be referenced by
+        // readers registered with either counter, so it is only safe to reclaim once both
+        // counters have drained after its retirement, i.e. once `n + 2` periods have completed.
+        auto poll() -> usize {
+            auto reclaimed = 0_usize;
+            while(true) {
+                if(m_draining) {
+                    if(!drained(m_phase.load(std::memory_order_relaxed) ^ 1_usize)) {
+                        break;
+                    }
+                    m_draining = false;
+                    ++m_grace_periods;
+                }
+
+                const auto expired = std::ranges::partition(m_retired, [&](const auto& retired) {
+                    return retired.grace_periods + 2_u64 > m_grace_periods;
+                });
+                for(auto& retired : expired) {
+                    delete retired.value; // NOLINT
+                    ++reclaimed;
+                }
+                m_retired.erase(expired.begin(), expired.end());
+
+                if(m_retired.empty()) {
+                    break;
+                }
+
+                // begin a new grace period: redirect new readers to the other counter, then
+                // wait for the readers registered with the current one to drain
+                m_phase.store(m_phase.load(std::memory_order_relaxed) ^ 1_usize,
+                              std::memory_order_seq_cst);
+                m_draining = true;
+            }
+            return reclaimed;
+        }
+
+        alignas(HYPERION_PLATFORM_CACHE_LINE_SIZE) std::atomic<TType*> m_current;
+        std::atomic<usize> m_phase = 0_usize;
+        usize m_slot_count;
+        std::unique_ptr<detail::rcu::reader_slot[]> m_slots; // NOLINT(*-avoid-c-arrays)
+
+        alignas(HYPERION_PLATFORM_CACHE_LINE_SIZE) mutable std::mutex m_writer;
+        std::vector<retired_version> m_retired;
+        u64 m_grace_periods = 0_u64;
+        bool m_draining = false;
+    };
+
+} // namespace hyperion
+
+#if defined(HYPERION_ENABLE_TESTING) && HYPERION_ENABLE_TESTING
+
+    #include <boost/ut.hpp>
+
+    #include <string>
+
+namespace hyperion::_test::platform::rcu_cell {
+
+    // NOLINTNEXTLINE(google-build-using-namespace)
+    using namespace boost::ut;
+
+    struct tracked {
+        static inline std::atomic<i64> live = 0_i64; // NOLINT
+
+        explicit tracked(u64 val) noexcept : value(val) {
+            live.fetch_add(1_i64, std::memory_order_relaxed);
+        }
+        tracked(const tracked& other) noexcept : value(other.value) {
+            live.fetch_add(1_i64, std::memory_order_relaxed);
+        }
+        tracked(tracked&&) = delete;
+        ~tracked() noexcept {
+            value = 0_u64;
+            live.fetch_sub(1_i64, std::memory_order_relaxed);
+        }
+        auto operator=(const tracked&) -> tracked& = delete;
+        auto operator=(tracked&&) -> tracked& = delete;
+
+        u64 value;
+    };
+
+    // NOLINTNEXTLINE(cert-err58-cpp)
+    static const suite<"hyperion::platform::rcu_cell"> rcu_cell_tests = [] {
+        "read_observes_latest_store"_test = [] {
+            hyperion::rcu_cell<std::string> cell{std::string{"first"}};
+            expect(that % cell.load() == std::string{"first"});
+            cell.store("second");
+            expect(that % *cell.read() == std::string{"second"});
+            cell.update([](const std::string& value) { return value + "!"; });
+            expect(that % cell.read()->size() == 7_usize);
+        };
+
+        "snapshots_outlive_updates"_test = [] {
+            const auto live = tracked::live.load();
+            {
+                hyperion::rcu_cell<tracked> cell{std::in_place, 1_u64};
+                {
+                    const auto snapshot = cell.read();
+                    cell.emplace(2_u64);
+                    cell.emplace(3_u64);
+                    expect(that % cell.reclaim() == 0_usize);
+                    expect(that % snapshot->value == 1_u64);
+                    expect(that % cell.read()->value == 3_u64);
+                }
+                cell.synchronize();
+                expect(that % cell.pending() == 0_usize);
+                expect(that % tracked::live.load() == live + 1_i64);
+            }
+            expect(that % tracked::live.load() == live);
+        };
+
+        "unobserved_versions_are_reclaimed_on_write"_test = [] {
+            const auto live = tracked::live.load();
+            hyperion::rcu_cell<tracked> cell{std::in_place, 1_u64};
+            for(auto i = 2_u64; i < 100_u64; ++i) {
+                cell.emplace(i);
+            }
+            expect(that % cell.pending() == 0_usize);
+            expect(that % tracked::live.load() == live + 1_i64);
+        };
+
+        "concurrent_readers_observe_consistent_versions"_test = [] {
+            struct pair {
+                u64 first;
+                u64 second;
+            };
+
+            hyperion::rcu_cell<pair> cell{pair{0_u64, 0_u64}};
+            std::atomic<bool> done = false;
+            std::atomic<usize> failures = 0_usize;
+
+            std::vector<std::thread> readers;
+            for(auto i = 0; i < 4; ++i) {
+                readers.emplace_back([&] {
+                    auto last = 0_u64;
+                    while(!done.load(std::memory_order_relaxed)) {
+                        const auto snapshot = cell.read();
+                        if(snapshot->first != snapshot->second || snapshot->first < last) {
+                            failures.fetch_add(1_usize);
+                        }
+                        last = snapshot->first;
+                    }
+                });
+            }
+
+            for(auto i = 1_u64; i < 5'000_u64; ++i) {
+                cell.store(pair{i, i});
+            }
+            done.store(true);
+            for(auto& reader : readers) {
+                reader.join();
+            }
+
+            cell.synchronize();
+            expect(that % failures.load() == 0_usize);
+            expect(that % cell.pending() == 0_usize);
+        };
+    };
+
+} // namespace hyperion::_test::platform::rcu_cell
+
+#endif // HYPERION_ENABLE_TESTING
+
+#endif // HYPERION_PLATFORM_RCU_CELL_H
@@ -0,0 +1,1133 @@
+/// @file reclamation.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Safe memory reclamation (hazard pointers and epoch-based reclamation) for lock-free
+/// data structures
+/// @version 0.4.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2024 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef HYPERION_PLATFORM_RECLAMATION_H
+#define HYPERION_PLATFORM_RECLAMATION_H
+
+#include <hyperion/platform.h>
+#include <hyperion/platform/def.h>
+#include <hyperion/platform/types.h>
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/// @ingroup platform
+/// @{
+///	@defgroup reclamation Memory Reclamation
+/// Hyperion provides two safe memory reclamation schemes for lock-free data structures:
+/// hazard pointers and epoch-based reclamation. Both defer the destruction of objects that have
+/// been unlinked from a shared structure until no reader can still hold a reference to them,
+/// and both reclaim retired objects in batches so the cost of a reclamation scan is amortized
+/// over many retirements.
+///
+/// Per-thread records are padded to `HYPERION_PLATFORM_CACHE_LINE_SIZE`, so readers publishing
+/// their hazards or epochs never contend on a shared cache line.
+///
+/// # Example
+/// @code {.cpp}
+/// std::atomic<route_table*> g_routes;
+///
+/// auto lookup(u32 key) -> u32 {
+///     auto hazard = hyperion::hazard_pointer_domain::global().make_hazard_pointer();
+///     const auto* routes = hazard.protect(g_routes);
+///     return routes->find(key);
+/// }
+///
+/// auto update(route_table* next) -> void {
+///     auto* previous = g_routes.exchange(next);
+///     hyperion::hazard_pointer_domain::global().retire(previous);
+/// }
+/// @endcode
+/// @headerfile hyperion/platform/reclamation.h
+/// @}
+
+namespace hyperion {
+
+    namespace detail::reclamation {
+        HYPERION_IGNORE_PADDING_WARNING_START;
+
+        struct retired {
+            void* object = nullptr;
+            void (*reclaim)(void*) noexcept = nullptr;
+            retired* next = nullptr;
+            u64 epoch = 0;
+        };
+
+        struct alignas(HYPERION_PLATFORM_CACHE_LINE_SIZE) hazard_record {
+            std::atomic<const void*> pointer = nullptr;
+            std::atomic<bool> in_use = false;
+            hazard_record* next = nullptr;
+        };
+
+        struct alignas(HYPERION_PLATFORM_CACHE_LINE_SIZE) epoch_record {
+            // `(epoch << 1) | 1` while pinned, `0` while quiescent
+            std::atomic<u64> state = 0;
+            std::atomic<bool> in_use = false;
+            epoch_record* next = nullptr;
+        };
+
+        HYPERION_IGNORE_PADDING_WARNING_STOP;
+
+        static_assert(sizeof(hazard_record) % HYPERION_PLATFORM_CACHE_LINE_SIZE == 0,
+                      "hazard_record must occupy whole cache lines");
+        static_assert(sizeof(epoch_record) % HYPERION_PLATFORM_CACHE_LINE_SIZE == 0,
+                      "epoch_record must occupy whole cache lines");
+
+        template<typename TType, typename TDeleter>
+        auto reclaim_with(void* object) noexcept -> void {
+            TDeleter{}(static_cast<TType*>(object));
+        }
+
+        inline auto push(std::atomic<retired*>& head, retired* first, retired* last) noexcept
+            -> void {
+            auto* current = head.load(std::memory_order_relaxed);
+            do {
+                last->next = current;
+            } while(!head.compare_exchange_weak(current,
+                                                first,
+                                                std::memory_order_release,
+                                                std::memory_order_relaxed));
+        }
+
+        inline auto reclaim_all(retired* list) noexcept -> usize {
+            auto count = 0_usize;
+            while(list != nullptr) {
+                auto* next = list->next;
+                list->reclaim(list->object);
+                delete list; // NOLINT(cppcoreguidelines-owning-memory)
+                list = next;
+                ++count;
+            }
+            return count;
+        }
+
+        template<typename TRecord>
+        auto acquire_record(std::atomic<TRecord*>& head, std::atomic<usize>& count) -> TRecord* {
+            for(auto* record = head.load(std::memory_order_acquire); record != nullptr;
+                record = record->next)
+            {
+                auto expected = false;
+                if(!record->in_use.load(std::memory_order_relaxed)
+                   && record->in_use.compare_exchange_strong(expected,
+                                                             true,
+                                                             std::memory_order_acquire,
+                                                             std::memory_order_relaxed))
+                {
+                    return record;
+                }
+            }
+
+            auto* record = new TRecord{}; // NOLINT(cppcoreguidelines-owning-memory)
+            record->in_use.store(true, std::memory_order_relaxed);
+            auto* current = head.load(std::memory_order_relaxed);
+            do {
+                record->next = current;
+            } while(!head.compare_exchange_weak(current,
+                                                record,
+                                                std::memory_order_release,
+                                                std::memory_order_relaxed));
+            count.fetch_add(1_usize, std::memory_order_relaxed);
+            return record;
+        }
+
+        template<typename TRecord>
+        auto free_records(TRecord* record) noexcept -> void {
+            while(record != nullptr) {
+                auto* next = record->next;
+                delete record; // NOLINT(cppcoreguidelines-owning-memory)
+                record = next;
+            }
+        }
+    } // namespace detail::reclamation
+
+    /// @brief Concept requiring that `TDeleter` is a stateless deleter for `TType`
+    /// that can be default-constructed at reclamation time
+    /// @ingroup reclamation
+    /// @headerfile hyperion/platform/reclamation.h
+    template<typename TDeleter, typename TType>
+    concept StatelessDeleter = std::is_empty_v<TDeleter> && std::default_initializable<TDeleter>
+                               && std::invocable<TDeleter, TType*>;
+
+    class hazard_pointer_domain;
+
+    /// @brief An owning handle to a single hazard pointer slot of a `hazard_pointer_domain`.
+    ///
+    /// While a `hazard_pointer` protects an object, the owning domain will not reclaim that
+    /// object, even if it has been retired. Acquiring a `hazard_pointer` is comparatively
+    /// expensive (it may scan the domain's records), so they are intended to be held for the
+    /// duration of a series of operations, rather than re-acquired for every load.
+    ///
+    /// # Example
+    /// @code {.cpp}
+    /// auto hazard = domain.make_hazard_pointer();
+    /// const auto* node = hazard.protect(head);
+    /// // `node` can be safely dereferenced until `hazard` protects something else or is
+    /// // destroyed
+    /// @endcode
+    /// @ingroup reclamation
+    /// @headerfile hyperion/platform/reclamation.h
+    class hazard_pointer {
+      public:
+        /// @brief Constructs an empty `hazard_pointer` that can't protect anything
+        constexpr hazard_pointer() noexcept = default;
+        hazard_pointer(const hazard_pointer&) = delete;
+        constexpr hazard_pointer(hazard_pointer&& other) noexcept
+            : m_record(std::exchange(other.m_record, nullptr)) {
+        }
+        ~hazard_pointer() noexcept {
+            release();
+        }
+        auto operator=(const hazard_pointer&) -> hazard_pointer& = delete;
+        auto operator=(hazard_pointer&& other) noexcept -> hazard_pointer& {
+            if(this != &other) {
+                release();
+                m_record = std::exchange(other.m_record, nullptr);
+            }
+            return *this;
+        }
+
+        /// @brief Returns whether this `hazard_pointer` is empty
+        /// (i.e. it is not associated with a hazard pointer slot)
+        /// @return whether this is empty
+        [[nodiscard]] constexpr auto empty() const noexcept -> bool {
+            return m_record == nullptr;
+        }
+
+        /// @brief Loads the pointer stored in `source` and protects it from reclamation
+        ///
+        /// @tparam TType The type of the pointed-to object
+        /// @param source The atomic pointer to load and protect
+        /// @return The protected pointer
+        /// @pre `!empty()`
+        template<typename TType>
+        [[nodiscard]] auto protect(const std::atomic<TType*>& source) noexcept -> TType* {
+            auto* pointer = source.load(std::memory_order_relaxed);
+            while(!try_protect(pointer, source)) {
+            }
+            return pointer;
+        }
+
+        /// @brief Attempts to protect `pointer`, which was previously loaded from `source`.
+        ///
+        /// If `source` no longer contains `pointer`, `pointer` is updated to the current value
+        /// of `source` and `false` is returned.
+        ///
+        /// @tparam TType The type of the pointed-to object
+        /// @param pointer The previously loaded value of `source`
+        /// @param source The atomic pointer `pointer` was loaded from
+        /// @return whether `pointer` was protected
+        /// @pre `!empty()`
+        template<typename TType>
+        [[nodiscard]] auto
+        try_protect(TType*& pointer, const std::atomic<TType*>& source) noexcept -> bool {
+            auto* const expected = pointer;
+            reset_protection(expected);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            pointer = source.load(std::memory_order_acquire);
+            if(pointer != expected) {
+                reset_protection();
+                return false;
+            }
+            return true;
+        }
+
+        /// @brief Protects `pointer` without validating it against a source.
+        /// The caller is responsible for ensuring `pointer` has not been retired.
+        ///
+        /// @param pointer The pointer to protect
+        /// @pre `!empty()`
+        auto reset_protection(const void* pointer) noexcept -> void {
+            m_record->pointer.store(pointer, std::memory_order_release);
+        }
+
+        /// @brief Clears the protection currently held by this `hazard_pointer`
+        /// @pre `!empty()`
+        auto reset_protection(std::nullptr_t = nullptr) noexcept -> void {
+            m_record->pointer.store(nullptr, std::memory_order_release);
+        }
+
+      private:
+        friend class hazard_pointer_domain;
+
+        explicit constexpr hazard_pointer(detail::reclamation::hazard_record* record) noexcept
+            : m_record(record) {
+        }
+
+        auto release() noexcept -> void {
+            if(m_record != nullptr) {
+                m_record->pointer.store(nullptr, std::memory_order_release);
+                m_record->in_use.store(false, std::memory_order_release);
+                m_record = nullptr;
+            }
+        }
+
+        detail::reclamation::hazard_record* m_record = nullptr;
+    };
+
+    HYPERION_IGNORE_PADDING_WARNING_START;
+
+    /// @brief A set of hazard pointer slots and the objects retired against them.
+    ///
+    /// Retired objects are accumulated in a lock-free list and reclaimed in a single batched scan
+    /// once the number of retired objects reaches the domain's reclamation threshold (or twice
+    /// the number of hazard pointer slots, whichever is larger), so a scan is performed at most
+    /// once per `threshold / 2` retirements.
+    ///
+    /// Objects retired to a domain are guaranteed to have been reclaimed once the domain is
+    /// destroyed. No `hazard_pointer` acquired from a domain may outlive it.
+    ///
+    /// @ingroup reclamation
+    /// @headerfile hyperion/platform/reclamation.h
+    class hazard_pointer_domain {
+      public:
+        /// @brief The default number of retired objects that triggers a reclamation scan
+        static constexpr auto default_reclaim_threshold = 64_usize;
+
+        /// @brief Constructs a `hazard_pointer_domain`
+        /// @param reclaim_threshold The number of retired objects that triggers a
+        /// reclamation scan
+        explicit hazard_pointer_domain(usize reclaim_threshold
+                                       = default_reclaim_threshold) noexcept
+            : m_threshold(reclaim_threshold) {
+        }
+        hazard_pointer_domain(const hazard_pointer_domain&) = delete;
+        hazard_pointer_domain(hazard_pointer_domain&&) = delete;
+        ~hazard_pointer_domain() noexcept {
+            detail::reclamation::reclaim_all(
+                m_retired.exchange(nullptr, std::memory_order_acquire));
+            detail::reclamation::free_records(m_records.load(std::memory_order_acquire));
+        }
+        auto operator=(const hazard_pointer_domain&) -> hazard_pointer_domain& = delete;
+        auto operator=(hazard_pointer_domain&&) -> hazard_pointer_domain& = delete;
+
+        /// @brief Returns the process-wide default `hazard_pointer_domain`
+        /// @return The global domain
+        [[nodiscard]] static auto global() noexcept -> hazard_pointer_domain& {
+            HYPERION_NO_DESTROY static hazard_pointer_domain domain;
+            return domain;
+        }
+
+        /// @brief Acquires a hazard pointer slot from this domain
+        /// @return A `hazard_pointer` owning the acquired slot
+        [[nodiscard]] auto make_hazard_pointer() -> hazard_pointer {
+            return hazard_pointer{
+                detail::reclamation::acquire_record(m_records, m_record_count)};
+        }
+
+        /// @brief Retires `object`, reclaiming it with a default-constructed `TDeleter` once no
+        /// `hazard_pointer` protects it.
+        ///
+        /// @tparam TType The type of the retired object
+        /// @tparam TDeleter The (stateless) deleter to reclaim `object` with
+        /// @param object The object to retire. It must already be unreachable for new readers
+        template<typename TType, typename TDeleter = std::default_delete<TType>>
+            requires StatelessDeleter<TDeleter, TType>
+        auto retire(TType* object, [[maybe_unused]] TDeleter deleter = TDeleter{}) -> void {
+            retire(static_cast<void*>(const_cast<std::remove_cv_t<TType>*>(object)),
+                   &detail::reclamation::reclaim_with<std::remove_cv_t<TType>, TDeleter>);
+        }
+
+        /// @brief Retires `object`, reclaiming it with `reclaim` once no `hazard_pointer`
+        /// protects it.
+        ///
+        /// @param object The object to retire. It must already be unreachable for new readers
+        /// @param reclaim The function used to reclaim `object`
+        auto retire(void* object, void (*reclaim)(void*) noexcept) -> void {
+            // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+            auto* node = new detail::reclamation::retired{.object = object, .reclaim = reclaim};
+            detail::reclamation::push(m_retired, node, node);
+            const auto count = m_retired_count.fetch_add(1_usize, std::memory_order_relaxed) + 1;
+            if(count >= threshold()) {
+                reclaim_retired();
+            }
+        }
+
+        /// @brief Immediately performs a reclamation scan, reclaiming every retired object
+        /// not currently protected by a `hazard_pointer`
+        /// @return The number of objects reclaimed
+        auto reclaim_retired() -> usize {
+            auto* list = m_retired.exchange(nullptr, std::memory_order_acquire);
+            if(list == nullptr) {
+                return 0_usize;
+            }
+
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            std::vector<const void*> hazards;
+            hazards.reserve(m_record_count.load(std::memory_order_relaxed));
+            for(auto* record = m_records.load(std::memory_order_acquire); record != nullptr;
+                record = record->next)
+            {
+                if(const auto* pointer = record->pointer.load(std::memory_order_acquire);
+                   pointer != nullptr)
+                {
+                    hazards.push_back(pointer);
+                }
+            }
+            std::ranges::sort(hazards);
+
+            detail::reclamation::retired* kept_first = nullptr;
+            detail::reclamation::retired* kept_last = nullptr;
+            auto reclaimed = 0_usize;
+            while(list != nullptr) {
+                auto* next = list->next;
+                if(std::ranges::binary_search(hazards, static_cast<const void*>(list->object))) {
+                    list->next = kept_first;
+                    kept_first = list;
+                    if(kept_last == nullptr) {
+                        kept_last = list;
+                    }
+                }
+                else {
+                    list->reclaim(list->object);
+                    delete list; // NOLINT(cppcoreguidelines-owning-memory)
+                    ++reclaimed;
+                }
+                list = next;
+            }
+
+            if(kept_first != nullptr) {
+                detail::reclamation::push(m_retired, kept_first, kept_last);
+            }
+            m_retired_count.fetch_sub(reclaimed, std::memory_order_relaxed);
+            return reclaimed;
+        }
+
+        /// @brief Returns the (approximate) number of retired objects awaiting reclamation
+        /// @return The number of retired objects
+        [[nodiscard]] auto retired_count() const noexcept -> usize {
+            return m_retired_count.load(std::memory_order_relaxed);
+        }
+
+      private:
+        [[nodiscard]] auto threshold() const noexcept -> usize {
+            return std::max(m_threshold, 2_usize * m_record_count.load(std::memory_order_relaxed));
+        }
+
+        std::atomic<detail::reclamation::hazard_record*> m_records = nullptr;
+        std::atomic<usize> m_record_count = 0_usize;
+        alignas(HYPERION_PLATFORM_CACHE_LINE_SIZE)
+            std::atomic<detail::reclamation::retired*> m_retired = nullptr;
+        std::atomic<usize> m_retired_count = 0_usize;
+        usize m_threshold;
+    };
+
+    HYPERION_IGNORE_PADDING_WARNING_STOP;
+
+    class epoch_domain;
+    class epoch_handle;
+
+    /// @brief RAII guard pinning the owning thread to the current epoch of an `epoch_domain`.
+    ///
+    /// While any `epoch_guard` is alive, objects reachable from shared structures protected by
+    /// the domain at the time the guard was created will not be reclaimed.
+    /// @ingroup reclamation
+    /// @headerfile hyperion/platform/reclamation.h
+    class epoch_guard {
+      public:
+        epoch_guard(const epoch_guard&) = delete;
+        constexpr epoch_guard(epoch_guard&& other) noexcept
+            : m_handle(std::exchange(other.m_handle, nullptr)) {
+        }
+        inline ~epoch_guard() noexcept;
+        auto operator=(const epoch_guard&) -> epoch_guard& = delete;
+        auto operator=(epoch_guard&&) -> epoch_guard& = delete;
+
+        /// @brief Retires `object` to the domain this guard is pinned to
+        ///
+        /// @tparam TType The type of the retired object
+        /// @tparam TDeleter The (stateless) deleter to reclaim `object` with
+        /// @param object The object to retire. It must already be unreachable for new readers
+        template<typename TType, typename TDeleter = std::default_delete<TType>>
+            requires StatelessDeleter<TDeleter, TType>
+        auto retire(TType* object, TDeleter deleter = TDeleter{}) -> void;
+
+      private:
+        friend class epoch_handle;
+
+        explicit constexpr epoch_guard(epoch_handle* handle) noexcept : m_handle(handle) {
+        }
+
+        epoch_handle* m_handle;
+    };
+
+    /// @brief A thread's registration with an `epoch_domain`.
+    ///
+    /// Each thread participating in an `epoch_domain` needs its own `epoch_handle`. The handle
+    /// buffers the objects retired through it and reclaims them in batches once the domain's
+    /// epoch has advanced far enough that no pinned thread can still observe them. Objects
+    /// still pending when the handle is destroyed are handed back to the domain.
+    ///
+    /// An `epoch_handle` must not be shared between threads, nor outlive its domain.
+    /// @ingroup reclamation
+    /// @headerfile hyperion/platform/reclamation.h
+    class epoch_handle {
+      public:
+        /// @brief Constructs an empty `epoch_handle` that is not registered with any domain
+        constexpr epoch_handle() noexcept = default;
+        epoch_handle(const epoch_handle&) = delete;
+        constexpr epoch_handle(epoch_handle&& other) noexcept
+            : m_domain(std::exchange(other.m_domain, nullptr)),
+              m_record(std::exchange(other.m_record, nullptr)),
+              m_retired(std::exchange(other.m_retired, nullptr)),
+              m_retired_count(std::exchange(other.m_retired_count, 0_usize)),
+              m_reclaim_at(std::exchange(other.m_reclaim_at, 0_usize)),
+              m_pin_depth(std::exchange(other.m_pin_depth, 0_u32)) {
+        }
+        ~epoch_handle() noexcept {
+            release();
+        }
+        auto operator=(const epoch_handle&) -> epoch_handle& = delete;
+        auto operator=(epoch_handle&& other) noexcept -> epoch_handle& {
+            if(this != &other) {
+                release();
+                m_domain = std::exchange(other.m_domain, nullptr);
+                m_record = std::exchange(other.m_record, nullptr);
+                m_retired = std::exchange(other.m_retired, nullptr);
+                m_retired_count = std::exchange(other.m_retired_count, 0_usize);
+                m_reclaim_at = std::exchange(other.m_reclaim_at, 0_usize);
+                m_pin_depth = std::exchange(other.m_pin_depth, 0_u32);
+            }
+            return *this;
+        }
+
+        /// @brief Returns whether this handle is registered with an `epoch_domain`
+        /// @return whether this is empty
+        [[nodiscard]] constexpr auto empty() const noexcept -> bool {
+            return m_record == nullptr;
+        }
+
+        /// @brief Pins this thread to the domain's current epoch.
+        /// Pins nest; the thread remains pinned until every returned guard has been destroyed.
+        /// @return The `epoch_guard` keeping the thread pinned
+        /// @pre `!empty()`
+        [[nodiscard]] inline auto pin() noexcept -> epoch_guard;
+
+        /// @brief Returns whether this thread is currently pinned through this handle
+        /// @return whether this is pinned
+        [[nodiscard]] constexpr auto is_pinned() const noexcept -> bool {
+            return m_pin_depth != 0_u32;
+        }
+
+        /// @brief Retires `object`, reclaiming it with a default-constructed `TDeleter` once
+        /// every thread pinned at the time of retirement has unpinned.
+        ///
+        /// @tparam TType The type of the retired object
+        /// @tparam TDeleter The (stateless) deleter to reclaim `object` with
+        /// @param object The object to retire. It must already be unreachable for new readers
+        /// @pre `!empty()`
+        template<typename TType, typename TDeleter = std::default_delete<TType>>
+            requires StatelessDeleter<TDeleter, TType>
+        auto retire(TType* object, [[maybe_unused]] TDeleter deleter = TDeleter{}) -> void {
+            retire(static_cast<void*>(const_cast<std::remove_cv_t<TType>*>(object)),
+                   &detail::reclamation::reclaim_with<std::remove_cv_t<TType>, TDeleter>);
+        }
+
+        /// @brief Retires `object`, reclaiming it with `reclaim` once every thread pinned at
+        /// the time of retirement has unpinned.
+        ///
+        /// @param object The object to retire. It must already be unreachable for new readers
+        /// @param reclaim The function used to reclaim `object`
+        /// @pre `!empty()`
+        inline auto retire(void* object, void (*reclaim)(void*) noexcept) -> void;
+
+        /// @brief Attempts to advance the domain's epoch and reclaims every object retired
+        /// through this handle that is no longer reachable by any pinned thread
+        /// @return The number of objects reclaimed
+        /// @pre `!empty()`
+        inline auto reclaim_retired() noexcept -> usize;
+
+        /// @brief Returns the number of objects retired through this handle that are awaiting
+        /// reclamation
+        /// @return The number of retired objects
+        [[nodiscard]] constexpr auto retired_count() const noexcept -> usize {
+            return m_retired_count;
+        }
+
+      private:
+        friend class epoch_domain;
+        friend class epoch_guard;
+
+        constexpr epoch_handle(epoch_domain* domain,
+                               detail::reclamation::epoch_record* record) noexcept
+            : m_domain(domain), m_record(record) {
+        }
+
+        inline auto unpin() noexcept -> void;
+        inline auto release() noexcept -> void;
+
+        epoch_domain* m_domain = nullptr;
+        detail::reclamation::epoch_record* m_record = nullptr;
+        // newest first, so the reclaimable suffix is always contiguous
+        detail::reclamation::retired* m_retired = nullptr;
+        usize m_retired_count = 0_usize;
+        // twice the objects left unreclaimed by the last pass, so that a reader pinned for a
+        // long time doesn't make every `retire` past the threshold rescan the whole list
+        usize m_reclaim_at = 0_usize;
+        u32 m_pin_depth = 0_u32;
+    };
+
+    HYPERION_IGNORE_PADDING_WARNING_START;
+
+    /// @brief An epoch-based reclamation domain.
+    ///
+    /// Readers pin themselves to the domain's global epoch for the duration of a read-side
+    /// critical section, which costs a single store to a thread-private, cache-line-padded
+    /// record. Objects are tagged with the global epoch when they are retired, and are reclaimed
+    /// once the epoch has advanced twice past that tag, at which point no pinned thread can still
+    /// hold a reference to them. The epoch only advances when every pinned thread has observed
+    /// the current epoch, so a thread that stays pinned indefinitely blocks reclamation.
+    ///
+    /// # Example
+    /// @code {.cpp}
+    /// auto handle = domain.register_participant();
+    /// {
+    ///     auto guard = handle.pin();
+    ///     const auto* config = g_config.load(std::memory_order_acquire);
+    ///     use(config);
+    /// }
+    /// auto* previous = g_config.exchange(next);
+    /// handle.retire(previous);
+    /// @endcode
+    /// @ingroup reclamation
+    /// @headerfile hyperion/platform/reclamation.h
+    class epoch_domain {
+      public:
+        /// @brief The default number of retired objects a handle accumulates before it attempts
+        /// to reclaim them
+        static constexpr auto default_reclaim_threshold = 64_usize;
+
+        /// @brief Constructs an `epoch_domain`
+        /// @param reclaim_threshold The number of objects retired through a handle that triggers
+        /// a reclamation attempt
+        explicit epoch_domain(usize reclaim_threshold = default_reclaim_threshold) noexcept
+            : m_threshold(reclaim_threshold) {
+        }
+        epoch_domain(const epoch_domain&) = delete;
+        epoch_domain(epoch_domain&&) = delete;
+        ~epoch_domain() noexcept {
+            detail::reclamation::reclaim_all(
+                m_orphans.exchange(nullptr, std::memory_order_acquire));
+            detail::reclamation::free_records(m_records.load(std::memory_order_acquire));
+        }
+        auto operator=(const epoch_domain&) -> epoch_domain& = delete;
+        auto operator=(epoch_domain&&) -> epoch_domain& = delete;
+
+        /// @brief Returns the process-wide default `epoch_domain`
+        /// @return The global domain
+        [[nodiscard]] static auto global() noexcept -> epoch_domain& {
+            HYPERION_NO_DESTROY static epoch_domain domain;
+            return domain;
+        }
+
+        /// @brief Registers the calling thread with this domain
+        /// @return The `epoch_handle` for the calling thread
+        [[nodiscard]] auto register_participant() -> epoch_handle {
+            return epoch_handle{this,
+                                detail::reclamation::acquire_record(m_records, m_record_count)};
+        }
+
+        /// @brief Returns the current global epoch of this domain
+        /// @return The current epoch
+        [[nodiscard]] auto current_epoch() const noexcept -> u64 {
+            return m_epoch.load(std::memory_order_acquire);
+        }
+
+        /// @brief Advances the global epoch if every pinned participant has observed the
+        /// current one
+        /// @return whether the epoch was advanced (by this or another thread)
+        auto try_advance() noexcept -> bool {
+            const auto observed = m_epoch.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            for(auto* record = m_records.load(std::memory_order_acquire); record != nullptr;
+                record = record->next)
+            {
+                const auto state = record->state.load(std::memory_order_relaxed);
+                if((state & 1_u64) != 0_u64 && (state >> 1_u64) != observed) {
+                    return observed != m_epoch.load(std::memory_order_relaxed);
+                }
+            }
+            // a failed exchange overwrites its expected value, so compare against a copy
+            auto expected = observed;
+            const auto advanced = m_epoch.compare_exchange_strong(expected,
+                                                                  observed + 1_u64,
+                                                                  std::memory_order_release,
+                                                                  std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            return advanced || observed != m_epoch.load(std::memory_order_relaxed);
+        }
+
+      private:
+        friend class epoch_handle;
+
+        [[nodiscard]] auto retire_epoch() const noexcept -> u64 {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            return m_epoch.load(std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] static constexpr auto
+        is_reclaimable(u64 retired_epoch, u64 current_epoch) noexcept -> bool {
+            return retired_epoch + 2_u64 <= current_epoch;
+        }
+
+        auto reclaim_orphans() noexcept -> usize {
+            auto* list = m_orphans.exchange(nullptr, std::memory_order_acquire);
+            if(list == nullptr) {
+                return 0_usize;
+            }
+
+            const auto epoch = current_epoch();
+            detail::reclamation::retired* kept_first = nullptr;
+            detail::reclamation::retired* kept_last = nullptr;
+            auto reclaimed = 0_usize;
+            while(list != nullptr) {
+                auto* next = list->next;
+                if(is_reclaimable(list->epoch, epoch)) {
+                    list->reclaim(list->object);
+                    delete list; // NOLINT(cppcoreguidelines-owning-memory)
+                    ++reclaimed;
+                }
+                else {
+                    list->next = kept_first;
+                    kept_first = list;
+                    if(kept_last == nullptr) {
+                        kept_last = list;
+                    }
+                }
+                list = next;
+            }
+
+            if(kept_first != nullptr) {
+                detail::reclamation::push(m_orphans, kept_first, kept_last);
+            }
+            return reclaimed;
+        }
+
+        alignas(HYPERION_PLATFORM_CACHE_LINE_SIZE) std::atomic<u64> m_epoch = 0_u64;
+        alignas(HYPERION_PLATFORM_CACHE_LINE_SIZE)
+            std::atomic<detail::reclamation::epoch_record*> m_records = nullptr;
+        std::atomic<usize> m_record_count = 0_usize;
+        std::atomic<detail::reclamation::retired*> m_orphans = nullptr;
+        usize m_threshold;
+    };
+
+    HYPERION_IGNORE_PADDING_WARNING_STOP;
+
+    inline auto epoch_handle::pin() noexcept -> epoch_guard {
+        if(m_pin_depth++ == 0_u32) {
+            const auto epoch = m_domain->m_epoch.load(std::memory_order_relaxed);
+            m_record->state.store((epoch << 1_u64) | 1_u64, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+        }
+        return epoch_guard{this};
+    }
+
+    inline auto epoch_handle::unpin() noexcept -> void {
+        if(--m_pin_depth == 0_u32) {
+            m_record->state.store(0_u64, std::memory_order_release);
+        }
+    }
+
+    inline auto epoch_handle::retire(void* object, void (*reclaim)(void*) noexcept) -> void {
+        // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+        auto* node = new detail::reclamation::retired{.object = object,
+                                                      .reclaim = reclaim,
+                                                      .next = m_retired,
+                                                      .epoch = m_domain->retire_epoch()};
+        m_retired = node;
+        if(++m_retired_count >= std::max(m_domain->m_threshold, m_reclaim_at)) {
+            reclaim_retired();
+        }
+    }
+
+    inline auto epoch_handle::reclaim_retired() noexcept -> usize {
+        m_domain->try_advance();
+        const auto epoch = m_domain->current_epoch();
+
+        // the list is ordered newest to oldest, so once we find the first reclaimable node,
+        // every node after it is reclaimable as well
+        detail::reclamation::retired* previous = nullptr;
+        auto* current = m_retired;
+        while(current != nullptr && !epoch_domain::is_reclaimable(current->epoch, epoch)) {
+            previous = current;
+            current = current->next;
+        }
+
+        if(previous == nullptr) {
+            m_retired = nullptr;
+        }
+        else {
+            previous->next = nullptr;
+        }
+
+        const auto reclaimed = detail::reclamation::reclaim_all(current);
+        m_retired_count -= reclaimed;
+        m_reclaim_at = 2_usize * m_retired_count;
+        return reclaimed + m_domain->reclaim_orphans();
+    }
+
+    inline auto epoch_handle::release() noexcept -> void {
+        if(m_record == nullptr) {
+            return;
+        }
+
+        if(m_retired != nullptr) {
+            auto* last = m_retired;
+            while(last->next != nullptr) {
+                last = last->next;
+            }
+            detail::reclamation::push(m_domain->m_orphans, m_retired, last);
+        }
+
+        m_record->state.store(0_u64, std::memory_order_release);
+        m_record->in_use.store(false, std::memory_order_release);
+        m_domain = nullptr;
+        m_record = nullptr;
+        m_retired = nullptr;
+        m_retired_count = 0_usize;
+        m_reclaim_at = 0_usize;
+        m_pin_depth = 0_u32;
+    }
+
+    inline epoch_guard::~epoch_guard() noexcept {
+        if(m_handle != nullptr) {
+            m_handle->unpin();
+        }
+    }
+
+    template<typename TType, typename TDeleter>
+        requires StatelessDeleter<TDeleter, TType>
+    auto epoch_guard::retire(TType* object, TDeleter deleter) -> void {
+        m_handle->retire(object, deleter);
+    }
+
+    /// @brief Pins the calling thread to the global `epoch_domain`, registering it with the
+    /// domain on first use
+    /// @return The `epoch_guard` keeping the thread pinned
+    /// @ingroup reclamation
+    /// @headerfile hyperion/platform/reclamation.h
+    [[nodiscard]] inline auto epoch_pin() -> epoch_guard {
+        thread_local auto handle = epoch_domain::global().register_participant();
+        return handle.pin();
+    }
+
+} // namespace hyperion
+
+#if defined(HYPERION_ENABLE_TESTING) && HYPERION_ENABLE_TESTING
+
+    #include <boost/ut.hpp>
+
+    #include <thread>
+
+namespace hyperion::_test::platform::reclamation {
+
+    // NOLINTNEXTLINE(google-build-using-namespace)
+    using namespace boost::ut;
+
+    struct tracked {
+        static inline std::atomic<i64> live = 0_i64; // NOLINT
+        static constexpr auto magic = 0xC0FF'EE00'D15E'A5E5_u64;
+
+        explicit tracked(u64 val) noexcept : value(val) {
+            live.fetch_add(1_i64, std::memory_order_relaxed);
+        }
+        tracked(const tracked&) = delete;
+        tracked(tracked&&) = delete;
+        ~tracked() noexcept {
+            check = 0_u64;
+            live.fetch_sub(1_i64, std::memory_order_relaxed);
+        }
+        auto operator=(const tracked&) -> tracked& = delete;
+        auto operator=(tracked&&) -> tracked& = delete;
+
+        u64 value;
+        u64 check = magic;
+    };
+
+    // NOLINTNEXTLINE(cert-err58-cpp)
+    static const suite<"hyperion::platform::reclamation"> reclamation_tests = [] {
+        "hazard_pointer"_test = [] {
+            "unprotected_objects_are_reclaimed"_test = [] {
+                const auto live = tracked::live.load();
+                hazard_pointer_domain domain{};
+                domain.retire(new tracked{1_u64}); // NOLINT(cppcoreguidelines-owning-memory)
+                domain.retire(new tracked{2_u64}); // NOLINT(cppcoreguidelines-owning-memory)
+                expect(that % domain.retired_count() == 2_usize);
+                expect(that % domain.reclaim_retired() == 2_usize);
+                expect(that % tracked::live.load() == live);
+            };
+
+            "protected_objects_are_not_reclaimed"_test = [] {
+                const auto live = tracked::live.load();
+                hazard_pointer_domain domain{};
+                std::atomic<tracked*> source = new tracked{3_u64};
+                {
+                    auto hazard = domain.make_hazard_pointer();
+                    const auto* protected_ptr = hazard.protect(source);
+                    expect(that % protected_ptr->value == 3_u64);
+
+                    domain.retire(source.exchange(nullptr));
+                    expect(that % domain.reclaim_retired() == 0_usize);
+                    expect(that % protected_ptr->check == tracked::magic);
+                }
+                expect(that % domain.reclaim_retired() == 1_usize);
+                expect(that % tracked::live.load() == live);
+            };
+
+            "slots_are_reused"_test = [] {
+                hazard_pointer_domain domain{};
+                std::atomic<tracked*> source = nullptr;
+                {
+                    auto first = domain.make_hazard_pointer();
+                    expect(that % not first.empty());
+                    expect(that % first.protect(source) == nullptr);
+                }
+                auto second = domain.make_hazard_pointer();
+                auto third = domain.make_hazard_pointer();
+                expect(that % not second.empty());
+                expect(that % not third.empty());
+            };
+
+            "retirement_is_batched"_test = [] {
+                const auto live = tracked::live.load();
+                hazard_pointer_domain domain{4_usize};
+                for(auto i = 0_u64; i < 3_u64; ++i) {
+                    domain.retire(new tracked{i}); // NOLINT(cppcoreguidelines-owning-memory)
+                }
+                expect(that % domain.retired_count() == 3_usize);
+                domain.retire(new tracked{3_u64}); // NOLINT(cppcoreguidelines-owning-memory)
+                expect(that % domain.retired_count() == 0_usize);
+                expect(that % tracked::live.load() == live);
+            };
+
+            "concurrent_readers_never_observe_reclaimed_objects"_test = [] {
+                const auto live = tracked::live.load();
+                {
+                    hazard_pointer_domain domain{8_usize};
+                    std::atomic<tracked*> source = new tracked{0_u64};
+                    std::atomic<bool> done = false;
+                    std::atomic<usize> failures = 0_usize;
+
+                    std::vector<std::thread> readers;
+                    for(auto i = 0; i < 4; ++i) {
+                        readers.emplace_back([&] {
+                            auto hazard = domain.make_hazard_pointer();
+                            while(!done.load(std::memory_order_relaxed)) {
+                                const auto* current = hazard.protect(source);
+                                if(current->check != tracked::magic) {
+                                    failures.fetch_add(1_usize);
+                                }
+                                hazard.reset_protection();
+                            }
+                        });
+                    }
+
+                    for(auto i = 1_u64; i < 10'000_u64; ++i) {
+                        // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+                        domain.retire(source.exchange(new tracked{i}));
+                    }
+                    done.store(true);
+                    for(auto& reader : readers) {
+                        reader.join();
+                    }
+
+                    expect(that % failures.load() == 0_usize);
+                    domain.retire(source.exchange(nullptr));
+                }
+                expect(that % tracked::live.load() == live);
+            };
+        };
+
+        "epoch"_test = [] {
+            "pinned_threads_block_reclamation"_test = [] {
+                const auto live = tracked::live.load();
+                epoch_domain domain{};
+                auto reader = domain.register_participant();
+                auto writer = domain.register_participant();
+                {
+                    auto guard = reader.pin();
+                    expect(that % reader.is_pinned());
+                    writer.retire(new tracked{1_u64}); // NOLINT(cppcoreguidelines-owning-memory)
+                    for(auto i = 0; i < 4; ++i) {
+                        writer.reclaim_retired();
+                    }
+                    expect(that % writer.retired_count() == 1_usize);
+                }
+                expect(that % not reader.is_pinned());
+                writer.reclaim_retired();
+                writer.reclaim_retired();
+                expect(that % writer.retired_count() == 0_usize);
+                expect(that % tracked::live.load() == live);
+            };
+
+            "try_advance_reports_concurrent_advances"_test = [] {
+                epoch_domain domain{};
+                std::atomic<usize> failures = 0_usize;
+                std::atomic<usize> ready = 0_usize;
+                std::vector<std::thread> threads;
+                for(auto i = 0; i < 2; ++i) {
+                    threads.emplace_back([&] {
+                        // no participant is pinned, so every call either advances the epoch
+                        // or loses the race to a thread that did
+                        const auto handle = domain.register_participant();
+                        ready.fetch_add(1_usize);
+                        while(ready.load() < 2_usize) {
+                        }
+                        for(auto j = 0; j < 100'000; ++j) {
+                            if(!domain.try_advance()) {
+                                failures.fetch_add(1_usize);
+                            }
+                        }
+                    });
+                }
+                for(auto& thread : threads) {
+                    thread.join();
+                }
+                expect(that % failures.load() == 0_usize);
+                expect(that % domain.current_epoch() <= 200'000_u64);
+            };
+
+            "retirement_is_batched_while_pinned"_test = [] {
+                const auto live = tracked::live.load();
+                {
+                    epoch_domain domain{4_usize};
+                    auto reader = domain.register_participant();
+                    auto writer = domain.register_participant();
+                    {
+                        auto guard = reader.pin();
+                        for(auto i = 0_u64; i < 4_u64; ++i) {
+                            // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+                            writer.retire(new tracked{i});
+                        }
+                        expect(that % writer.retired_count() == 4_usize);
+                    }
+
+                    // the pass at the threshold reclaimed nothing, so the next one waits for
+                    // twice as many retired objects
+                    for(auto i = 4_u64; i < 7_u64; ++i) {
+                        writer.retire(new tracked{i}); // NOLINT(cppcoreguidelines-owning-memory)
+                    }
+                    expect(that % writer.retired_count() == 7_usize);
+                    writer.retire(new tracked{7_u64}); // NOLINT(cppcoreguidelines-owning-memory)
+                    expect(that % writer.retired_count() == 4_usize);
+                }
+                expect(that % tracked::live.load() == live);
+            };
+
+            "nested_pins_unpin_once"_test = [] {
+                epoch_domain domain{};
+                auto handle = domain.register_participant();
+                {
+                    auto outer = handle.pin();
+                    {
+                        auto inner = handle.pin();
+                        expect(that % handle.is_pinned());
+                    }
+                    expect(that % handle.is_pinned());
+                }
+                expect(that % not handle.is_pinned());
+            };
+
+            "orphaned_objects_are_reclaimed"_test = [] {
+                const auto live = tracked::live.load();
+                {
+                    epoch_domain domain{};
+                    auto survivor = domain.register_participant();
+                    {
+                        auto handle = domain.register_participant();
+                        // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+                        handle.retire(new tracked{1_u64});
+                    }
+                    expect(that % tracked::live.load() == live + 1_i64);
+                    survivor.reclaim_retired();
+                    survivor.reclaim_retired();
+                    expect(that % tracked::live.load() == live);
+                }
+                expect(that % tracked::live.load() == live);
+            };
+
+            "concurrent_readers_never_observe_reclaimed_objects"_test = [] {
+                const auto live = tracked::live.load();
+                {
+                    epoch_domain domain{8_usize};
+                    std::atomic<tracked*> source = new tracked{0_u64};
+                    std::atomic<bool> done = false;
+                    std::atomic<usize> failures = 0_usize;
+
+                    std::vector<std::thread> readers;
+                    for(auto i = 0; i < 4; ++i) {
+                        readers.emplace_back([&] {
+                            auto handle = domain.register_participant();
+                            while(!done.load(std::memory_order_relaxed)) {
+                                auto guard = handle.pin();
+                                const auto* current = source.load(std::memory_order_acquire);
+                                if(current->check != tracked::magic) {
+                                    failures.fetch_add(1_usize);
+                                }
+                            }
+                        });
+                    }
+
+                    auto writer = domain.register_participant();
+                    for(auto i = 1_u64; i < 10'000_u64; ++i) {
+                        // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+                        writer.retire(source.exchange(new tracked{i}));
+                    }
+                    done.store(true);
+                    for(auto& reader : readers) {
+                        reader.join();
+                    }
+
+                    expect(that % failures.load() == 0_usize);
+                    writer.retire(source.exchange(nullptr));
+                }
+                expect(that % tracked::live.load() == live);
+            };
+
+            "global_domain_pins"_test = [] {
+                const auto live = tracked::live.load();
+                {
+                    auto guard = epoch_pin();
+                    guard.retire(new tracked{1_u64}); // NOLINT(cppcoreguidelines-owning-memory)
+                }
+                expect(that % tracked::live.load() == live + 1_i64);
+            };
+        };
+    };
+
+} // namespace hyperion::_test::platform::reclamation
+
+#endif // HYPERION_ENABLE_TESTING
+
+#endif // HYPERION_PLATFORM_RECLAMATION_H
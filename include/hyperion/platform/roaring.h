@@ -0,0 +1,1901 @@
+/// @file roaring.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Roaring-style compressed bitmaps over `u32` keys
+/// @version 0.4.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2024 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef HYPERION_PLATFORM_ROARING_H
+#define HYPERION_PLATFORM_ROARING_H
+
+#include <hyperion/platform.h>
+#include <hyperion/platform/assert.h>
+#include <hyperion/platform/def.h>
+#include <hyperion/platform/expected.h>
+#include <hyperion/platform/ignore.h>
+#include <hyperion/platform/types.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__AVX2__) || defined(__SSE4_2__)
+    #include <immintrin.h>
+#endif // defined(__AVX2__) || defined(__SSE4_2__)
+
+#if HYPERION_PLATFORM_IS_UNIX
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif // HYPERION_PLATFORM_IS_UNIX
+
+/// @ingroup platform
+/// @{
+///	@defgroup roaring Roaring Bitmaps
+/// `hyperion::roaring_bitmap` is a compressed set of `u32`s in the style of Roaring bitmaps.
+/// Keys are partitioned by their high 16 bits into chunks of 65536, and each non-empty chunk is
+/// stored in whichever of three containers suits its contents:
+///
+/// - An array container, a sorted array of the low 16 bits, for sparse chunks (up to 4096
+/// elements, at most 8KiB)
+/// - A bitmap container, a fixed 8KiB bitset, for dense chunks
+/// - A run container, a sorted array of `[start, start + length]` runs, for clustered chunks.
+/// Run containers are produced by `add_range` and `run_optimize`.
+///
+/// Set operations (`&`, `|`, `^`, and `-` for and-not) are performed container by container
+/// with specialized kernels. When the target supports them, array intersections use SSE4.2
+/// string-comparison instructions to intersect eight elements against eight at a time, and
+/// bitmap cardinalities use an AVX2 nibble-lookup popcount. Both fall back to portable scalar
+/// kernels (galloping search for very unevenly sized arrays, and `std::popcount`) otherwise.
+/// `intersection_cardinality` counts the size of an intersection without materializing it.
+///
+/// Bitmaps serialize to a compact, little-endian format with `serialize` and can be restored
+/// with `deserialize`, which fully validates its input. `hyperion::roaring_view` instead
+/// queries a serialized bitmap in place, without copying or decoding it, and
+/// `hyperion::mapped_roaring_view` does so directly over a read-only memory mapping of a file.
+/// Views participate in set operations exactly like owning bitmaps.
+///
+/// # Example
+/// @code {.cpp}
+/// auto matches_term = hyperion::roaring_bitmap{3, 17, 1'000'000};
+/// auto in_range = hyperion::roaring_bitmap{};
+/// in_range.add_range(0, 500'000);
+///
+/// const auto results = matches_term & in_range; // {3, 17}
+///
+/// const auto bytes = results.serialize();
+/// const auto view = hyperion::roaring_view::from_bytes(bytes);
+/// if(view && view->contains(17)) {
+///     // ...
+/// }
+/// @endcode
+/// @headerfile hyperion/platform/roaring.h
+/// @}
+
+namespace hyperion {
+
+    /// @brief Errors that can occur when reading a serialized `roaring_bitmap`
+    /// @ingroup roaring
+    /// @headerfile hyperion/platform/roaring.h
+    enum class RoaringError : u8 {
+        /// @brief The input does not start with a valid header
+        InvalidHeader,
+        /// @brief The input is shorter than its header says it should be
+        Truncated,
+        /// @brief The input's container descriptors or contents are inconsistent
+        Corrupt,
+        /// @brief A zero-copy view was requested over insufficiently aligned memory
+        Misaligned,
+        /// @brief A zero-copy view was requested on a big-endian platform
+        UnsupportedEndianness,
+        /// @brief The file backing a mapped view could not be opened or mapped
+        FileError,
+    };
+
+    class roaring_bitmap;
+    class roaring_view;
+
+    namespace detail::roaring {
+        static constexpr auto k_chunk_bits = 16_usize;
+        static constexpr auto k_array_max = 4096_usize;
+        static constexpr auto k_bitmap_words = 1024_usize;
+        static constexpr auto k_bitmap_bytes = k_bitmap_words * sizeof(u64);
+        static constexpr auto k_low_mask = 0xFFFF_u32;
+
+        enum class ContainerKind : u8 {
+            Array = 1,
+            Bitmap = 2,
+            Run = 3,
+        };
+
+        enum class SetOperation : u8 {
+            And,
+            Or,
+            Xor,
+            AndNot,
+        };
+
+        [[nodiscard]] constexpr auto high(u32 value) noexcept -> u16 {
+            return static_cast<u16>(value >> k_chunk_bits);
+        }
+
+        [[nodiscard]] constexpr auto low(u32 value) noexcept -> u16 {
+            return static_cast<u16>(value & k_low_mask);
+        }
+
+        [[nodiscard]] constexpr auto combine(u16 high_bits, u32 low_bits) noexcept -> u32 {
+            return (static_cast<u32>(high_bits) << k_chunk_bits) | low_bits;
+        }
+
+        HYPERION_IGNORE_PADDING_WARNING_START;
+
+        // a non-owning view of a container's contents, shared by owning bitmaps and
+        // serialized views so that every kernel serves both
+        struct container_ref {
+            // array values, or interleaved (start, length - 1) run pairs
+            const u16* values = nullptr;
+            const u64* words = nullptr;
+            u32 cardinality = 0;
+            // the number of array values, runs, or bitmap words
+            u32 count = 0;
+            ContainerKind kind = ContainerKind::Array;
+        };
+
+        struct container {
+            // array values, or interleaved (start, length - 1) run pairs
+            std::vector<u16> values;
+            std::vector<u64> words;
+            u32 cardinality = 0;
+            ContainerKind kind = ContainerKind::Array;
+
+            [[nodiscard]] auto ref() const noexcept -> container_ref {
+                const auto count = kind == ContainerKind::Bitmap ?
+                                       static_cast<u32>(k_bitmap_words) :
+                                       (kind == ContainerKind::Run ?
+                                            static_cast<u32>(values.size() / 2_usize) :
+                                            static_cast<u32>(values.size()));
+                return {values.data(), words.data(), cardinality, count, kind};
+            }
+        };
+
+        HYPERION_IGNORE_PADDING_WARNING_STOP;
+
+#if defined(__AVX2__)
+        // per-byte popcount via a nibble lookup table, accumulated into 64-bit lanes
+        [[nodiscard]] inline auto popcount_lanes(__m256i words) noexcept -> __m256i {
+            const auto lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                                 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+            const auto low_nibbles = _mm256_set1_epi8(0x0F);
+            const auto lows = _mm256_and_si256(words, low_nibbles);
+            const auto highs = _mm256_and_si256(_mm256_srli_epi16(words, 4), low_nibbles);
+            const auto counts = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, lows),
+                                                _mm256_shuffle_epi8(lookup, highs));
+            return _mm256_sad_epu8(counts, _mm256_setzero_si256());
+        }
+
+        [[nodiscard]] inline auto horizontal_sum(__m256i lanes) noexcept -> u64 {
+            return static_cast<u64>(_mm256_extract_epi64(lanes, 0))
+                   + static_cast<u64>(_mm256_extract_epi64(lanes, 1))
+                   + static_cast<u64>(_mm256_extract_epi64(lanes, 2))
+                   + static_cast<u64>(_mm256_extract_epi64(lanes, 3));
+        }
+#endif // defined(__AVX2__)
+
+        /// @brief Returns the number of set bits in `words[0, count)`
+        [[nodiscard]] inline auto popcount(const u64* words, usize count) noexcept -> u64 {
+            auto total = 0_u64;
+            auto index = 0_usize;
+#if defined(__AVX2__)
+            const auto vector_end = count - count % 4_usize;
+            auto lanes = _mm256_setzero_si256();
+            for(; index < vector_end; index += 4_usize) {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+                const auto* const block = reinterpret_cast<const __m256i*>(words + index);
+                const auto loaded = _mm256_loadu_si256(block);
+                lanes = _mm256_add_epi64(lanes, popcount_lanes(loaded));
+            }
+            total = horizontal_sum(lanes);
+#endif // defined(__AVX2__)
+            for(; index < count; ++index) {
+                total += static_cast<u64>(std::popcount(words[index]));
+            }
+            return total;
+        }
+
+        /// @brief Returns the number of set bits in `lhs[0, count) & rhs[0, count)`
+        [[nodiscard]] inline auto
+        popcount_and(const u64* lhs, const u64* rhs, usize count) noexcept -> u64 {
+            auto total = 0_u64;
+            auto index = 0_usize;
+#if defined(__AVX2__)
+            const auto vector_end = count - count % 4_usize;
+            auto lanes = _mm256_setzero_si256();
+            for(; index < vector_end; index += 4_usize) {
+                // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+                const auto left = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lhs + index));
+                const auto right
+                    = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rhs + index));
+                // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+                lanes = _mm256_add_epi64(lanes, popcount_lanes(_mm256_and_si256(left, right)));
+            }
+            total = horizontal_sum(lanes);
+#endif // defined(__AVX2__)
+            for(; index < count; ++index) {
+                total += static_cast<u64>(std::popcount(lhs[index] & rhs[index]));
+            }
+            return total;
+        }
+
+#if defined(__SSE4_2__)
+        // for each 8-bit match mask, the byte shuffle that packs the matched 16-bit lanes to
+        // the front of a vector
+        inline constexpr auto k_shuffle_masks = [] {
+            auto masks = std::array<std::array<u8, 16>, 256>{};
+            for(auto mask = 0_usize; mask < masks.size(); ++mask) {
+                auto out = 0_usize;
+                for(auto lane = 0_usize; lane < 8_usize; ++lane) {
+                    if(((mask >> lane) & 1_usize) != 0_usize) {
+                        masks[mask][out++] = static_cast<u8>(2_usize * lane);
+                        masks[mask][out++] = static_cast<u8>(2_usize * lane + 1_usize);
+                    }
+                }
+                for(; out < masks[mask].size(); ++out) {
+                    masks[mask][out] = static_cast<u8>(0xFF);
+                }
+            }
+            return masks;
+        }();
+#endif // defined(__SSE4_2__)
+
+        /// @brief The number of trailing elements the output of `intersect_arrays` may be
+        /// written past the size of the intersection
+        static constexpr auto k_intersect_slack = 8_usize;
+
+        /// @brief Intersects the sorted, duplicate-free arrays `lhs` and `rhs` into `out`,
+        /// returning the size of the intersection
+        ///
+        /// `out` must have room for `min(lhs_size, rhs_size) + k_intersect_slack` elements.
+        inline auto intersect_arrays(const u16* lhs,
+                                     usize lhs_size,
+                                     const u16* rhs,
+                                     usize rhs_size,
+                                     u16* out) noexcept -> usize {
+            static constexpr auto k_gallop_ratio = 64_usize;
+            if(lhs_size > rhs_size) {
+                std::swap(lhs, rhs);
+                std::swap(lhs_size, rhs_size);
+            }
+
+            auto count = 0_usize;
+            if(lhs_size * k_gallop_ratio < rhs_size) {
+                // very uneven sizes: binary search each element of the small array in the
+                // remainder of the large one
+                const auto* position = rhs;
+                const auto* const rhs_end = rhs + rhs_size;
+                for(auto index = 0_usize; index < lhs_size && position != rhs_end; ++index) {
+                    position = std::lower_bound(position, rhs_end, lhs[index]);
+                    if(position != rhs_end && *position == lhs[index]) {
+                        out[count++] = lhs[index];
+                    }
+                }
+                return count;
+            }
+
+            auto lhs_index = 0_usize;
+            auto rhs_index = 0_usize;
+#if defined(__SSE4_2__)
+            static constexpr auto k_lanes = 8_usize;
+            const auto lhs_blocks_end = lhs_size - lhs_size % k_lanes;
+            const auto rhs_blocks_end = rhs_size - rhs_size % k_lanes;
+            if(lhs_blocks_end != 0_usize && rhs_blocks_end != 0_usize) {
+                // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+                auto lhs_block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs));
+                auto rhs_block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs));
+                while(true) {
+                    // bit i is set iff lane i of lhs_block equals any lane of rhs_block
+                    const auto matches = _mm_cmpestrm(rhs_block,
+                                                      static_cast<int>(k_lanes),
+                                                      lhs_block,
+                                                      static_cast<int>(k_lanes),
+                                                      _SIDD_UWORD_OPS | _SIDD_CMP_EQUAL_ANY
+                                                          | _SIDD_BIT_MASK);
+                    const auto mask = static_cast<u32>(_mm_extract_epi32(matches, 0));
+                    const auto shuffle = _mm_loadu_si128(
+                        reinterpret_cast<const __m128i*>(k_shuffle_masks[mask].data()));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + count),
+                                     _mm_shuffle_epi8(lhs_block, shuffle));
+                    count += static_cast<usize>(std::popcount(mask));
+
+                    const auto lhs_max = lhs[lhs_index + k_lanes - 1_usize];
+                    const auto rhs_max = rhs[rhs_index + k_lanes - 1_usize];
+                    if(lhs_max <= rhs_max) {
+                        lhs_index += k_lanes;
+                        if(lhs_index == lhs_blocks_end) {
+                            break;
+                        }
+                        lhs_block
+                            = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs + lhs_index));
+                    }
+                    if(rhs_max <= lhs_max) {
+                        rhs_index += k_lanes;
+                        if(rhs_index == rhs_blocks_end) {
+                            break;
+                        }
+                        rhs_block
+                            = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + rhs_index));
+                    }
+                }
+                // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+            }
+#endif // defined(__SSE4_2__)
+
+            while(lhs_index < lhs_size && rhs_index < rhs_size) {
+                const auto left = lhs[lhs_index];
+                const auto right = rhs[rhs_index];
+                if(left == right) {
+                    out[count++] = left;
+                }
+                lhs_index += static_cast<usize>(left <= right);
+                rhs_index += static_cast<usize>(right <= left);
+            }
+            return count;
+        }
+
+        [[nodiscard]] inline auto test_bit(const u64* words, u32 bit) noexcept -> bool {
+            return ((words[bit >> 6U] >> (bit & 63U)) & 1_u64) != 0_u64;
+        }
+
+        inline auto set_bit(u64* words, u32 bit) noexcept -> void {
+            words[bit >> 6U] |= 1_u64 << (bit & 63U);
+        }
+
+        inline auto clear_bit(u64* words, u32 bit) noexcept -> void {
+            words[bit >> 6U] &= ~(1_u64 << (bit & 63U));
+        }
+
+        inline auto flip_bit(u64* words, u32 bit) noexcept -> void {
+            words[bit >> 6U] ^= 1_u64 << (bit & 63U);
+        }
+
+        // sets the bits [first, last]
+        inline auto set_bit_range(u64* words, u32 first, u32 last) noexcept -> void {
+            const auto first_word = first >> 6U;
+            const auto last_word = last >> 6U;
+            const auto first_mask = ~0_u64 << (first & 63U);
+            const auto last_mask = ~0_u64 >> (63U - (last & 63U));
+            if(first_word == last_word) {
+                words[first_word] |= first_mask & last_mask;
+                return;
+            }
+            words[first_word] |= first_mask;
+            for(auto word = first_word + 1U; word < last_word; ++word) {
+                words[word] = ~0_u64;
+            }
+            words[last_word] |= last_mask;
+        }
+
+        [[nodiscard]] inline auto run_start(container_ref ref, usize run) noexcept -> u32 {
+            return ref.values[2_usize * run];
+        }
+
+        // the last value in the run, clamped so corrupt views cannot index out of bounds
+        [[nodiscard]] inline auto run_last(container_ref ref, usize run) noexcept -> u32 {
+            return std::min(run_start(ref, run) + ref.values[2_usize * run + 1_usize],
+                            k_low_mask);
+        }
+
+        [[nodiscard]] inline auto contains(container_ref ref, u16 value) noexcept -> bool {
+            switch(ref.kind) {
+                case ContainerKind::Array:
+                    return std::binary_search(ref.values, ref.values + ref.count, value);
+                case ContainerKind::Bitmap: return test_bit(ref.words, value);
+                case ContainerKind::Run:
+                    {
+                        // find the last run starting at or before `value`
+                        auto first = 0_usize;
+                        auto length = static_cast<usize>(ref.count);
+                        while(length > 0_usize) {
+                            const auto half = length / 2_usize;
+                            if(run_start(ref, first + half) <= value) {
+                                first += half + 1_usize;
+                                length -= half + 1_usize;
+                            }
+                            else {
+                                length = half;
+                            }
+                        }
+                        return first != 0_usize && value <= run_last(ref, first - 1_usize);
+                    }
+            }
+            HYPERION_UNREACHABLE();
+        }
+
+        template<typename TCallback>
+        inline auto for_each(container_ref ref, TCallback&& callback) -> void {
+            switch(ref.kind) {
+                case ContainerKind::Array:
+                    for(auto index = 0_usize; index < ref.count; ++index) {
+                        callback(static_cast<u32>(ref.values[index]));
+                    }
+                    return;
+                case ContainerKind::Bitmap:
+                    for(auto word = 0_usize; word < k_bitmap_words; ++word) {
+                        auto bits = ref.words[word];
+                        while(bits != 0_u64) {
+                            const auto bit = static_cast<u32>(std::countr_zero(bits));
+                            callback(static_cast<u32>(word * 64_usize) + bit);
+                            bits &= bits - 1_u64;
+                        }
+                    }
+                    return;
+                case ContainerKind::Run:
+                    for(auto run = 0_usize; run < ref.count; ++run) {
+                        const auto last = run_last(ref, run);
+                        for(auto value = run_start(ref, run); value <= last; ++value) {
+                            callback(value);
+                        }
+                    }
+                    return;
+            }
+        }
+
+        [[nodiscard]] inline auto to_words(container_ref ref) -> std::vector<u64> {
+            if(ref.kind == ContainerKind::Bitmap) {
+                return {ref.words, ref.words + k_bitmap_words};
+            }
+
+            auto words = std::vector<u64>(k_bitmap_words, 0_u64);
+            if(ref.kind == ContainerKind::Run) {
+                for(auto run = 0_usize; run < ref.count; ++run) {
+                    set_bit_range(words.data(), run_start(ref, run), run_last(ref, run));
+                }
+            }
+            else {
+                for(auto index = 0_usize; index < ref.count; ++index) {
+                    set_bit(words.data(), ref.values[index]);
+                }
+            }
+            return words;
+        }
+
+        [[nodiscard]] inline auto to_values(container_ref ref) -> std::vector<u16> {
+            auto values = std::vector<u16>{};
+            values.reserve(ref.cardinality);
+            for_each(ref, [&values](u32 value) { values.push_back(static_cast<u16>(value)); });
+            return values;
+        }
+
+        // converts between array and bitmap representations according to the cardinality
+        inline auto normalize(container& target) -> void {
+            if(target.kind == ContainerKind::Bitmap) {
+                target.cardinality
+                    = static_cast<u32>(popcount(target.words.data(), target.words.size()));
+                if(target.cardinality <= k_array_max) {
+                    target.values = to_values(target.ref());
+                    target.words = {};
+                    target.kind = ContainerKind::Array;
+                }
+            }
+            else if(target.kind == ContainerKind::Array) {
+                target.cardinality = static_cast<u32>(target.values.size());
+                if(target.cardinality > k_array_max) {
+                    target.words = to_words(target.ref());
+                    target.values = {};
+                    target.kind = ContainerKind::Bitmap;
+                }
+            }
+        }
+
+        // copies `ref` into an owning container, preserving its representation
+        [[nodiscard]] inline auto copy(container_ref ref) -> container {
+            auto result = container{};
+            result.kind = ref.kind;
+            result.cardinality = ref.cardinality;
+            if(ref.kind == ContainerKind::Bitmap) {
+                result.words.assign(ref.words, ref.words + k_bitmap_words);
+            }
+            else {
+                const auto size = ref.kind == ContainerKind::Run ?
+                                      2_usize * static_cast<usize>(ref.count) :
+                                      static_cast<usize>(ref.count);
+                result.values.assign(ref.values, ref.values + size);
+            }
+            return result;
+        }
+
+        // converts a run container into an array or bitmap container
+        [[nodiscard]] inline auto expand(container_ref ref) -> container {
+            auto result = container{};
+            if(ref.cardinality > k_array_max) {
+                result.kind = ContainerKind::Bitmap;
+                result.words = to_words(ref);
+            }
+            else {
+                result.kind = ContainerKind::Array;
+                result.values = to_values(ref);
+            }
+            normalize(result);
+            return result;
+        }
+
+        [[nodiscard]] inline auto count_runs(container_ref ref) noexcept -> usize {
+            switch(ref.kind) {
+                case ContainerKind::Array:
+                    {
+                        auto runs = ref.count == 0U ? 0_usize : 1_usize;
+                        for(auto index = 1_usize; index < ref.count; ++index) {
+                            runs += static_cast<usize>(ref.values[index]
+                                                       != ref.values[index - 1_usize] + 1U);
+                        }
+                        return runs;
+                    }
+                case ContainerKind::Bitmap:
+                    {
+                        // count the bits that start a run: set, with the previous bit clear
+                        auto runs = 0_usize;
+                        auto carry = 0_u64;
+                        for(auto word = 0_usize; word < k_bitmap_words; ++word) {
+                            const auto bits = ref.words[word];
+                            const auto previous = (bits << 1U) | carry;
+                            runs += static_cast<usize>(std::popcount(bits & ~previous));
+                            carry = bits >> 63U;
+                        }
+                        return runs;
+                    }
+                case ContainerKind::Run: return ref.count;
+            }
+            HYPERION_UNREACHABLE();
+        }
+
+        // converts `target` to whichever representation is smallest
+        inline auto optimize(container& target) -> void {
+            const auto ref = target.ref();
+            const auto runs = count_runs(ref);
+            const auto run_bytes = runs * 2_usize * sizeof(u16);
+            const auto flat_bytes = std::min(static_cast<usize>(ref.cardinality) * sizeof(u16),
+                                             k_bitmap_bytes);
+            if(run_bytes < flat_bytes) {
+                if(target.kind == ContainerKind::Run) {
+                    return;
+                }
+                auto values = std::vector<u16>{};
+                values.reserve(2_usize * runs);
+                auto start = 0_u32;
+                auto previous = 0_u32;
+                auto first = true;
+                for_each(ref, [&](u32 value) {
+                    if(first || value != previous + 1U) {
+                        if(!first) {
+                            values.push_back(static_cast<u16>(start));
+                            values.push_back(static_cast<u16>(previous - start));
+                        }
+                        start = value;
+                        first = false;
+                    }
+                    previous = value;
+                });
+                values.push_back(static_cast<u16>(start));
+                values.push_back(static_cast<u16>(previous - start));
+
+                target.values = std::move(values);
+                target.words = {};
+                target.kind = ContainerKind::Run;
+            }
+            else if(target.kind == ContainerKind::Run) {
+                target = expand(ref);
+            }
+        }
+
+        [[nodiscard]] inline auto
+        apply(container_ref lhs, container_ref rhs, SetOperation operation) -> container {
+            if(lhs.kind == ContainerKind::Run) {
+                const auto expanded = expand(lhs);
+                return apply(expanded.ref(), rhs, operation);
+            }
+            if(rhs.kind == ContainerKind::Run) {
+                const auto expanded = expand(rhs);
+                return apply(lhs, expanded.ref(), operation);
+            }
+
+            auto result = container{};
+            if(lhs.kind == ContainerKind::Array && rhs.kind == ContainerKind::Array) {
+                const auto* const lhs_end = lhs.values + lhs.count;
+                const auto* const rhs_end = rhs.values + rhs.count;
+                auto out = std::back_inserter(result.values);
+                switch(operation) {
+                    case SetOperation::And:
+                        result.values.resize(std::min(lhs.count, rhs.count)
+                                             + k_intersect_slack);
+                        result.values.resize(intersect_arrays(lhs.values,
+                                                              lhs.count,
+                                                              rhs.values,
+                                                              rhs.count,
+                                                              result.values.data()));
+                        break;
+                    case SetOperation::Or:
+                        std::set_union(lhs.values, lhs_end, rhs.values, rhs_end, out);
+                        break;
+                    case SetOperation::Xor:
+                        std::set_symmetric_difference(lhs.values,
+                                                      lhs_end,
+                                                      rhs.values,
+                                                      rhs_end,
+                                                      out);
+                        break;
+                    case SetOperation::AndNot:
+                        std::set_difference(lhs.values, lhs_end, rhs.values, rhs_end, out);
+                        break;
+                }
+                result.kind = ContainerKind::Array;
+            }
+            else if(lhs.kind == ContainerKind::Bitmap && rhs.kind == ContainerKind::Bitmap) {
+                result.words.resize(k_bitmap_words);
+                const auto combine_words = [&](auto combine_word) {
+                    for(auto word = 0_usize; word < k_bitmap_words; ++word) {
+                        result.words[word] = combine_word(lhs.words[word], rhs.words[word]);
+                    }
+                };
+                switch(operation) {
+                    case SetOperation::And: combine_words(std::bit_and<>{}); break;
+                    case SetOperation::Or: combine_words(std::bit_or<>{}); break;
+                    case SetOperation::Xor: combine_words(std::bit_xor<>{}); break;
+                    case SetOperation::AndNot:
+                        combine_words([](u64 left, u64 right) { return left & ~right; });
+                        break;
+                }
+                result.kind = ContainerKind::Bitmap;
+            }
+            else if(operation == SetOperation::And
+                    || (operation == SetOperation::AndNot && lhs.kind == ContainerKind::Array))
+            {
+                // filter the array by membership in the bitmap
+                const auto array = lhs.kind == ContainerKind::Array ? lhs : rhs;
+                const auto* const words = lhs.kind == ContainerKind::Array ? rhs.words : lhs.words;
+                const auto keep = operation == SetOperation::And;
+                result.values.reserve(array.count);
+                for(auto index = 0_usize; index < array.count; ++index) {
+                    if(test_bit(words, array.values[index]) == keep) {
+                        result.values.push_back(array.values[index]);
+                    }
+                }
+                result.kind = ContainerKind::Array;
+            }
+            else {
+                // update a copy of the bitmap with the array's elements
+                const auto array = lhs.kind == ContainerKind::Array ? lhs : rhs;
+                const auto bitmap = lhs.kind == ContainerKind::Array ? rhs : lhs;
+                result.words.assign(bitmap.words, bitmap.words + k_bitmap_words);
+                for(auto index = 0_usize; index < array.count; ++index) {
+                    const auto bit = static_cast<u32>(array.values[index]);
+                    switch(operation) {
+                        case SetOperation::Or: set_bit(result.words.data(), bit); break;
+                        case SetOperation::Xor: flip_bit(result.words.data(), bit); break;
+                        case SetOperation::AndNot: clear_bit(result.words.data(), bit); break;
+                        case SetOperation::And: HYPERION_UNREACHABLE();
+                    }
+                }
+                result.kind = ContainerKind::Bitmap;
+            }
+
+            normalize(result);
+            return result;
+        }
+
+        [[nodiscard]] inline auto
+        intersection_cardinality(container_ref lhs, container_ref rhs) -> u64 {
+            if(lhs.kind == ContainerKind::Run) {
+                const auto expanded = expand(lhs);
+                return intersection_cardinality(expanded.ref(), rhs);
+            }
+            if(rhs.kind == ContainerKind::Run) {
+                const auto expanded = expand(rhs);
+                return intersection_cardinality(lhs, expanded.ref());
+            }
+
+            if(lhs.kind == ContainerKind::Bitmap && rhs.kind == ContainerKind::Bitmap) {
+                return popcount_and(lhs.words, rhs.words, k_bitmap_words);
+            }
+            if(lhs.kind == ContainerKind::Array && rhs.kind == ContainerKind::Array) {
+                auto scratch = std::array<u16, k_array_max + k_intersect_slack>{};
+                return intersect_arrays(lhs.values,
+                                        lhs.count,
+                                        rhs.values,
+                                        rhs.count,
+                                        scratch.data());
+            }
+
+            const auto array = lhs.kind == ContainerKind::Array ? lhs : rhs;
+            const auto* const words = lhs.kind == ContainerKind::Array ? rhs.words : lhs.words;
+            auto count = 0_u64;
+            for(auto index = 0_usize; index < array.count; ++index) {
+                count += static_cast<u64>(test_bit(words, array.values[index]));
+            }
+            return count;
+        }
+
+        // serialized layout, all integers little-endian:
+        //
+        // header:      u32 magic, u32 container count
+        // descriptors: u16 key, u8 kind, u8 reserved, u32 cardinality, u32 count, u32 offset
+        // payloads:    u16 array values, u16 run pairs, or u64 bitmap words, each starting at
+        //              an 8-byte aligned offset from the start of the buffer
+        static constexpr auto k_magic = 0x31425248_u32; // "HRB1"
+        static constexpr auto k_header_size = 8_usize;
+        static constexpr auto k_descriptor_size = 16_usize;
+        static constexpr auto k_payload_alignment = 8_usize;
+
+        template<std::unsigned_integral TInt>
+        [[nodiscard]] inline auto load_le(const std::byte* bytes) noexcept -> TInt {
+            auto value = TInt{0};
+            for(auto index = 0_usize; index < sizeof(TInt); ++index) {
+                const auto byte = std::to_integer<TInt>(bytes[index]);
+                value |= static_cast<TInt>(byte << (8_usize * index));
+            }
+            return value;
+        }
+
+        template<std::unsigned_integral TInt>
+        inline auto store_le(std::byte* bytes, TInt value) noexcept -> void {
+            for(auto index = 0_usize; index < sizeof(TInt); ++index) {
+                bytes[index] = static_cast<std::byte>(value >> (8_usize * index));
+            }
+        }
+
+        [[nodiscard]] constexpr auto align_payload(usize offset) noexcept -> usize {
+            return (offset + k_payload_alignment - 1_usize) & ~(k_payload_alignment - 1_usize);
+        }
+
+        [[nodiscard]] constexpr auto payload_size(ContainerKind kind, u32 count) noexcept
+            -> usize {
+            switch(kind) {
+                case ContainerKind::Array: return static_cast<usize>(count) * sizeof(u16);
+                case ContainerKind::Bitmap: return k_bitmap_bytes;
+                case ContainerKind::Run: return static_cast<usize>(count) * 2_usize * sizeof(u16);
+            }
+            return 0_usize;
+        }
+
+        HYPERION_IGNORE_PADDING_WARNING_START;
+
+        struct descriptor {
+            u32 cardinality;
+            u32 count;
+            u32 offset;
+            u16 key;
+            ContainerKind kind;
+        };
+
+        HYPERION_IGNORE_PADDING_WARNING_STOP;
+
+        [[nodiscard]] inline auto
+        read_descriptor(std::span<const std::byte> bytes, usize index) noexcept -> descriptor {
+            const auto* const entry = bytes.data() + k_header_size + index * k_descriptor_size;
+            return {load_le<u32>(entry + 4), // NOLINT(*-magic-numbers)
+                    load_le<u32>(entry + 8), // NOLINT(*-magic-numbers)
+                    load_le<u32>(entry + 12), // NOLINT(*-magic-numbers)
+                    load_le<u16>(entry),
+                    static_cast<ContainerKind>(std::to_integer<u8>(entry[2]))};
+        }
+
+        // validates the header and every descriptor, returning the container count
+        [[nodiscard]] inline auto validate_layout(std::span<const std::byte> bytes) noexcept
+            -> hyperion::expected<usize, RoaringError> {
+            if(bytes.size() < k_header_size || load_le<u32>(bytes.data()) != k_magic) {
+                return unexpected{RoaringError::InvalidHeader};
+            }
+
+            const auto count = static_cast<usize>(load_le<u32>(bytes.data() + 4));
+            if(count > (1_usize << k_chunk_bits)) {
+                return unexpected{RoaringError::Corrupt};
+            }
+            if(bytes.size() < k_header_size + count * k_descriptor_size) {
+                return unexpected{RoaringError::Truncated};
+            }
+
+            for(auto index = 0_usize; index < count; ++index) {
+                const auto entry = read_descriptor(bytes, index);
+                if(index != 0_usize && read_descriptor(bytes, index - 1_usize).key >= entry.key) {
+                    return unexpected{RoaringError::Corrupt};
+                }
+
+                auto valid = entry.cardinality != 0U && entry.cardinality <= k_low_mask + 1U
+                             && entry.offset % k_payload_alignment == 0U;
+                switch(entry.kind) {
+                    case ContainerKind::Array:
+                        valid = valid && entry.count == entry.cardinality
+                                && entry.count <= k_array_max;
+                        break;
+                    case ContainerKind::Bitmap:
+                        valid = valid && entry.count == k_bitmap_words;
+                        break;
+                    case ContainerKind::Run:
+                        valid = valid && entry.count != 0U && entry.count <= entry.cardinality;
+                        break;
+                    default: valid = false; break;
+                }
+                if(!valid) {
+                    return unexpected{RoaringError::Corrupt};
+                }
+                if(static_cast<usize>(entry.offset) + payload_size(entry.kind, entry.count)
+                   > bytes.size())
+                {
+                    return unexpected{RoaringError::Truncated};
+                }
+            }
+            return count;
+        }
+
+        struct access;
+    } // namespace detail::roaring
+
+    /// @brief A compressed set of `u32`s, stored as Roaring-style array, bitmap and run
+    /// containers
+    ///
+    /// @ingroup roaring
+    /// @headerfile hyperion/platform/roaring.h
+    class roaring_bitmap {
+      public:
+        /// @brief Constructs an empty bitmap
+        roaring_bitmap() noexcept = default;
+
+        /// @brief Constructs a bitmap containing `values`
+        /// @param values The values to add
+        roaring_bitmap(std::initializer_list<u32> values) {
+            for(const auto value : values) {
+                hyperion::ignore(add(value));
+            }
+        }
+
+        /// @brief Adds `value` to the set
+        /// @param value The value to add
+        /// @return Whether `value` was newly added
+        auto add(u32 value) -> bool {
+            using namespace detail::roaring; // NOLINT(google-build-using-namespace)
+            auto& target = find_or_insert(high(value));
+            const auto bits = low(value);
+
+            if(target.kind == ContainerKind::Run) {
+                if(detail::roaring::contains(target.ref(), bits)) {
+                    return false;
+                }
+                target = expand(target.ref());
+            }
+
+            if(target.kind == ContainerKind::Bitmap) {
+                if(test_bit(target.words.data(), bits)) {
+                    return false;
+                }
+                set_bit(target.words.data(), bits);
+                ++target.cardinality;
+                return true;
+            }
+
+            const auto position
+                = std::lower_bound(target.values.begin(), target.values.end(), bits);
+            if(position != target.values.end() && *position == bits) {
+                return false;
+            }
+            target.values.insert(position, bits);
+            normalize(target);
+            return true;
+        }
+
+        /// @brief Adds every value in `[first, last]` to the set
+        /// @param first The first value to add
+        /// @param last The last value to add
+        /// @pre `first <= last`
+        auto add_range(u32 first, u32 last) -> void {
+            using namespace detail::roaring; // NOLINT(google-build-using-namespace)
+            HYPERION_DEBUG_ASSERT(first <= last, "add_range requires first <= last");
+
+            for(auto key = static_cast<u32>(high(first)); key <= high(last); ++key) {
+                const auto chunk = static_cast<u16>(key);
+                const auto range_first
+                    = chunk == high(first) ? static_cast<u32>(low(first)) : 0U;
+                const auto range_last
+                    = chunk == high(last) ? static_cast<u32>(low(last)) : k_low_mask;
+
+                const auto position = std::lower_bound(m_keys.begin(), m_keys.end(), chunk);
+                if(position == m_keys.end() || *position != chunk) {
+                    auto run = container{};
+                    run.kind = ContainerKind::Run;
+                    run.values = {static_cast<u16>(range_first),
+                                  static_cast<u16>(range_last - range_first)};
+                    run.cardinality = range_last - range_first + 1U;
+                    const auto index = position - m_keys.begin();
+                    m_keys.insert(position, chunk);
+                    m_containers.insert(m_containers.begin() + index, std::move(run));
+                    continue;
+                }
+
+                auto& target = m_containers[static_cast<usize>(position - m_keys.begin())];
+                auto words = to_words(target.ref());
+                set_bit_range(words.data(), range_first, range_last);
+                target.words = std::move(words);
+                target.values = {};
+                target.kind = ContainerKind::Bitmap;
+                normalize(target);
+            }
+        }
+
+        /// @brief Removes `value` from the set
+        /// @param value The value to remove
+        /// @return Whether `value` was present
+        auto remove(u32 value) -> bool {
+            using namespace detail::roaring; // NOLINT(google-build-using-namespace)
+            const auto index = find(high(value));
+            if(index == m_keys.size()) {
+                return false;
+            }
+
+            auto& target = m_containers[index];
+            const auto bits = low(value);
+            if(!detail::roaring::contains(target.ref(), bits)) {
+                return false;
+            }
+
+            if(target.kind == ContainerKind::Run) {
+                target = expand(target.ref());
+            }
+            if(target.kind == ContainerKind::Bitmap) {
+                clear_bit(target.words.data(), bits);
+            }
+            else {
+                target.values.erase(
+                    std::lower_bound(target.values.begin(), target.values.end(), bits));
+            }
+            normalize(target);
+
+            if(target.cardinality == 0U) {
+                const auto offset = static_cast<std::ptrdiff_t>(index);
+                m_keys.erase(m_keys.begin() + offset);
+                m_containers.erase(m_containers.begin() + offset);
+            }
+            return true;
+        }
+
+        /// @brief Returns whether `value` is in the set
+        /// @param value The value to check for
+        /// @return Whether the set contains `value`
+        [[nodiscard]] auto contains(u32 value) const noexcept -> bool {
+            const auto index = find(detail::roaring::high(value));
+            return index != m_keys.size()
+                   && detail::roaring::contains(m_containers[index].ref(),
+                                                detail::roaring::low(value));
+        }
+
+        /// @brief Returns the number of values in the set
+        /// @return The cardinality of the set
+        [[nodiscard]] auto cardinality() const noexcept -> u64 {
+            auto total = 0_u64;
+            for(const auto& container : m_containers) {
+                total += container.cardinality;
+            }
+            return total;
+        }
+
+        /// @brief Returns whether the set is empty
+        /// @return Whether the set is empty
+        [[nodiscard]] auto empty() const noexcept -> bool {
+            return m_containers.empty();
+        }
+
+        /// @brief Removes every value from the set
+        auto clear() noexcept -> void {
+            m_keys.clear();
+            m_containers.clear();
+        }
+
+        /// @brief Invokes `callback` with each value in the set, in ascending order
+        /// @param callback The callback to invoke
+        template<typename TCallback>
+            requires std::invocable<TCallback&, u32>
+        auto for_each(TCallback&& callback) const -> void {
+            for(auto index = 0_usize; index < m_keys.size(); ++index) {
+                const auto key = m_keys[index];
+                detail::roaring::for_each(m_containers[index].ref(), [&](u32 value) {
+                    callback(detail::roaring::combine(key, value));
+                });
+            }
+        }
+
+        /// @brief Returns the values in the set, in ascending order
+        /// @return The values in the set
+        [[nodiscard]] auto to_vector() const -> std::vector<u32> {
+            auto values = std::vector<u32>{};
+            values.reserve(static_cast<usize>(cardinality()));
+            for_each([&values](u32 value) { values.push_back(value); });
+            return values;
+        }
+
+        /// @brief Converts every container to its smallest representation, run-length encoding
+        /// those whose values are clustered
+        auto run_optimize() -> void {
+            for(auto& container : m_containers) {
+                detail::roaring::optimize(container);
+            }
+        }
+
+        /// @brief Returns the number of bytes `serialize` produces
+        /// @return The serialized size
+        [[nodiscard]] auto serialized_size() const noexcept -> usize {
+            using namespace detail::roaring; // NOLINT(google-build-using-namespace)
+            auto size = k_header_size + m_containers.size() * k_descriptor_size;
+            for(const auto& container : m_containers) {
+                const auto ref = container.ref();
+                size = align_payload(size) + payload_size(ref.kind, ref.count);
+            }
+            return size;
+        }
+
+        /// @brief Serializes the set into `bytes`
+        /// @param bytes The buffer to serialize into
+        /// @return The number of bytes written
+        /// @pre `bytes.size() >= serialized_size()`
+        auto serialize_into(std::span<std::byte> bytes) const noexcept -> usize {
+            using namespace detail::roaring; // NOLINT(google-build-using-namespace)
+            HYPERION_ASSERT(bytes.size() >= serialized_size(),
+                            "roaring_bitmap::serialize_into buffer is too small");
+
+            std::memset(bytes.data(), 0, serialized_size());
+            store_le(bytes.data(), k_magic);
+            store_le(bytes.data() + 4, static_cast<u32>(m_containers.size()));
+
+            auto offset = k_header_size + m_containers.size() * k_descriptor_size;
+            for(auto index = 0_usize; index < m_containers.size(); ++index) {
+                const auto ref = m_containers[index].ref();
+                offset = align_payload(offset);
+
+                auto* const entry = bytes.data() + k_header_size + index * k_descriptor_size;
+                store_le(entry, m_keys[index]);
+                entry[2] = static_cast<std::byte>(ref.kind);
+                store_le(entry + 4, ref.cardinality); // NOLINT(*-magic-numbers)
+                store_le(entry + 8, ref.count); // NOLINT(*-magic-numbers)
+                store_le(entry + 12, static_cast<u32>(offset)); // NOLINT(*-magic-numbers)
+
+                auto* const payload = bytes.data() + offset;
+                if(ref.kind == ContainerKind::Bitmap) {
+                    for(auto word = 0_usize; word < k_bitmap_words; ++word) {
+                        store_le(payload + word * sizeof(u64), ref.words[word]);
+                    }
+                }
+                else {
+                    const auto values = payload_size(ref.kind, ref.count) / sizeof(u16);
+                    for(auto value = 0_usize; value < values; ++value) {
+                        store_le(payload + value * sizeof(u16), ref.values[value]);
+                    }
+                }
+                offset += payload_size(ref.kind, ref.count);
+            }
+            return offset;
+        }
+
+        /// @brief Serializes the set into a new buffer
+        /// @return The serialized set
+        [[nodiscard]] auto serialize() const -> std::vector<std::byte> {
+            auto bytes = std::vector<std::byte>(serialized_size());
+            hyperion::ignore(serialize_into(bytes));
+            return bytes;
+        }
+
+        /// @brief Deserializes a set previously serialized with `serialize`, validating it
+        /// completely
+        ///
+        /// Unlike `roaring_view`, this places no alignment or endianness requirements on
+        /// `bytes`.
+        ///
+        /// @param bytes The serialized set
+        /// @return The deserialized set, or the reason `bytes` is invalid
+        [[nodiscard]] static auto
+        deserialize(std::span<const std::byte> bytes) -> expected<roaring_bitmap, RoaringError> {
+            using namespace detail::roaring; // NOLINT(google-build-using-namespace)
+            const auto count = validate_layout(bytes);
+            if(!count) {
+                return unexpected{count.error()};
+            }
+
+            auto result = roaring_bitmap{};
+            result.m_keys.reserve(*count);
+            result.m_containers.reserve(*count);
+            for(auto index = 0_usize; index < *count; ++index) {
+                const auto entry = read_descriptor(bytes, index);
+                const auto* const payload = bytes.data() + entry.offset;
+
+                auto decoded = container{};
+                decoded.kind = entry.kind;
+                decoded.cardinality = entry.cardinality;
+                if(entry.kind == ContainerKind::Bitmap) {
+                    decoded.words.resize(k_bitmap_words);
+                    for(auto word = 0_usize; word < k_bitmap_words; ++word) {
+                        decoded.words[word] = load_le<u64>(payload + word * sizeof(u64));
+                    }
+                }
+                else {
+                    decoded.values.resize(payload_size(entry.kind, entry.count) / sizeof(u16));
+                    for(auto value = 0_usize; value < decoded.values.size(); ++value) {
+                        decoded.values[value] = load_le<u16>(payload + value * sizeof(u16));
+                    }
+                }
+
+                if(!is_consistent(decoded)) {
+                    return unexpected{RoaringError::Corrupt};
+                }
+                result.m_keys.push_back(entry.key);
+                result.m_containers.push_back(std::move(decoded));
+            }
+            return result;
+        }
+
+        friend auto operator==(const roaring_bitmap& lhs, const roaring_bitmap& rhs) noexcept
+            -> bool {
+            if(lhs.m_keys != rhs.m_keys) {
+                return false;
+            }
+            for(auto index = 0_usize; index < lhs.m_containers.size(); ++index) {
+                const auto left = lhs.m_containers[index].ref();
+                const auto right = rhs.m_containers[index].ref();
+                if(left.cardinality != right.cardinality
+                   || detail::roaring::intersection_cardinality(left, right) != left.cardinality)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+      private:
+        friend struct detail::roaring::access;
+
+        std::vector<u16> m_keys;
+        std::vector<detail::roaring::container> m_containers;
+
+        [[nodiscard]] auto find(u16 key) const noexcept -> usize {
+            const auto position = std::lower_bound(m_keys.begin(), m_keys.end(), key);
+            return position != m_keys.end() && *position == key ?
+                       static_cast<usize>(position - m_keys.begin()) :
+                       m_keys.size();
+        }
+
+        auto find_or_insert(u16 key) -> detail::roaring::container& {
+            const auto position = std::lower_bound(m_keys.begin(), m_keys.end(), key);
+            const auto index = position - m_keys.begin();
+            if(position == m_keys.end() || *position != key) {
+                m_keys.insert(position, key);
+                m_containers.insert(m_containers.begin() + index, detail::roaring::container{});
+            }
+            return m_containers[static_cast<usize>(index)];
+        }
+
+        // checks that a deserialized container's contents agree with its descriptor
+        [[nodiscard]] static auto
+        is_consistent(const detail::roaring::container& target) noexcept -> bool {
+            using namespace detail::roaring; // NOLINT(google-build-using-namespace)
+            switch(target.kind) {
+                case ContainerKind::Array:
+                    return std::adjacent_find(target.values.begin(),
+                                              target.values.end(),
+                                              std::greater_equal<>{})
+                           == target.values.end();
+                case ContainerKind::Bitmap:
+                    return popcount(target.words.data(), k_bitmap_words) == target.cardinality;
+                case ContainerKind::Run:
+                    {
+                        auto total = 0_u32;
+                        auto next = 0_u32;
+                        for(auto index = 0_usize; index < target.values.size(); index += 2_usize) {
+                            const auto start = static_cast<u32>(target.values[index]);
+                            const auto length = static_cast<u32>(target.values[index + 1_usize]);
+                            if(start < next || start + length > k_low_mask) {
+                                return false;
+                            }
+                            total += length + 1U;
+                            next = start + length + 2U;
+                        }
+                        return total == target.cardinality;
+                    }
+            }
+            return false;
+        }
+
+        auto append(u16 key, detail::roaring::container&& container) -> void {
+            m_keys.push_back(key);
+            m_containers.push_back(std::move(container));
+        }
+    };
+
+    /// @brief A read-only, zero-copy view of a `roaring_bitmap` serialized with
+    /// `roaring_bitmap::serialize`
+    ///
+    /// Construction validates the layout of the serialized data (its header, and the bounds of
+    /// every container), but not the contents of the containers, so that views over large
+    /// memory-mapped files are cheap to open. Views require the serialized data to be 8-byte
+    /// aligned and the platform to be little-endian; use `roaring_bitmap::deserialize`
+    /// otherwise.
+    ///
+    /// The view refers to the serialized data; it must outlive the view.
+    ///
+    /// @ingroup roaring
+    /// @headerfile hyperion/platform/roaring.h
+    class roaring_view {
+      public:
+        /// @brief Constructs a view of the empty set
+        roaring_view() noexcept = default;
+
+        /// @brief Creates a view of the serialized set in `bytes`
+        /// @param bytes The serialized set
+        /// @return The view, or the reason `bytes` cannot be viewed
+        [[nodiscard]] static auto from_bytes(std::span<const std::byte> bytes) noexcept
+            -> expected<roaring_view, RoaringError> {
+            if constexpr(std::endian::native != std::endian::little) {
+                return unexpected{RoaringError::UnsupportedEndianness};
+            }
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+            if(reinterpret_cast<std::uintptr_t>(bytes.data())
+                   % detail::roaring::k_payload_alignment
+               != 0U)
+            {
+                return unexpected{RoaringError::Misaligned};
+            }
+
+            const auto count = detail::roaring::validate_layout(bytes);
+            if(!count) {
+                return unexpected{count.error()};
+            }
+            auto view = roaring_view{};
+            view.m_bytes = bytes;
+            view.m_count = *count;
+            return view;
+        }
+
+        /// @brief Returns whether `value` is in the set
+        /// @param value The value to check for
+        /// @return Whether the set contains `value`
+        [[nodiscard]] auto contains(u32 value) const noexcept -> bool {
+            const auto key = detail::roaring::high(value);
+            auto first = 0_usize;
+            auto length = m_count;
+            while(length > 0_usize) {
+                const auto half = length / 2_usize;
+                if(key_at(first + half) < key) {
+                    first += half + 1_usize;
+                    length -= half + 1_usize;
+                }
+                else {
+                    length = half;
+                }
+            }
+            return first != m_count && key_at(first) == key
+                   && detail::roaring::contains(ref_at(first), detail::roaring::low(value));
+        }
+
+        /// @brief Returns the number of values in the set
+        /// @return The cardinality of the set
+        [[nodiscard]] auto cardinality() const noexcept -> u64 {
+            auto total = 0_u64;
+            for(auto index = 0_usize; index < m_count; ++index) {
+                total += detail::roaring::read_descriptor(m_bytes, index).cardinality;
+            }
+            return total;
+        }
+
+        /// @brief Returns whether the set is empty
+        /// @return Whether the set is empty
+        [[nodiscard]] auto empty() const noexcept -> bool {
+            return m_count == 0_usize;
+        }
+
+        /// @brief Invokes `callback` with each value in the set, in ascending order
+        /// @param callback The callback to invoke
+        template<typename TCallback>
+            requires std::invocable<TCallback&, u32>
+        auto for_each(TCallback&& callback) const -> void {
+            for(auto index = 0_usize; index < m_count; ++index) {
+                const auto key = key_at(index);
+                detail::roaring::for_each(ref_at(index), [&](u32 value) {
+                    callback(detail::roaring::combine(key, value));
+                });
+            }
+        }
+
+        /// @brief Copies the viewed set into an owning `roaring_bitmap`
+        /// @return The copied set
+        [[nodiscard]] auto to_bitmap() const -> roaring_bitmap;
+
+      private:
+        friend struct detail::roaring::access;
+
+        std::span<const std::byte> m_bytes;
+        usize m_count = 0;
+
+        [[nodiscard]] auto key_at(usize index) const noexcept -> u16 {
+            return detail::roaring::load_le<u16>(m_bytes.data() + detail::roaring::k_header_size
+                                                 + index * detail::roaring::k_descriptor_size);
+        }
+
+        [[nodiscard]] auto ref_at(usize index) const noexcept -> detail::roaring::container_ref {
+            const auto entry = detail::roaring::read_descriptor(m_bytes, index);
+            const auto* const payload = m_bytes.data() + entry.offset;
+            // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+            return {reinterpret_cast<const u16*>(payload),
+                    reinterpret_cast<const u64*>(payload),
+                    entry.cardinality,
+                    entry.count,
+                    entry.kind};
+            // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+        }
+    };
+
+    /// @brief Types that can participate in roaring set operations: `roaring_bitmap` and
+    /// `roaring_view`
+    /// @ingroup roaring
+    /// @headerfile hyperion/platform/roaring.h
+    template<typename TType>
+    concept RoaringSet = std::same_as<std::remove_cvref_t<TType>, roaring_bitmap>
+                         || std::same_as<std::remove_cvref_t<TType>, roaring_view>;
+
+    namespace detail::roaring {
+        struct access {
+            [[nodiscard]] static auto count(const roaring_bitmap& set) noexcept -> usize {
+                return set.m_keys.size();
+            }
+
+            [[nodiscard]] static auto count(const roaring_view& set) noexcept -> usize {
+                return set.m_count;
+            }
+
+            [[nodiscard]] static auto key(const roaring_bitmap& set, usize index) noexcept
+                -> u16 {
+                return set.m_keys[index];
+            }
+
+            [[nodiscard]] static auto key(const roaring_view& set, usize index) noexcept -> u16 {
+                return set.key_at(index);
+            }
+
+            [[nodiscard]] static auto ref(const roaring_bitmap& set, usize index) noexcept
+                -> container_ref {
+                return set.m_containers[index].ref();
+            }
+
+            [[nodiscard]] static auto ref(const roaring_view& set, usize index) noexcept
+                -> container_ref {
+                return set.ref_at(index);
+            }
+
+            static auto append(roaring_bitmap& set, u16 key, container&& target) -> void {
+                set.append(key, std::move(target));
+            }
+        };
+
+        template<RoaringSet TLhs, RoaringSet TRhs>
+        [[nodiscard]] auto
+        combine_sets(const TLhs& lhs, const TRhs& rhs, SetOperation operation) -> roaring_bitmap {
+            const auto keep_lhs = operation != SetOperation::And;
+            const auto keep_rhs = operation == SetOperation::Or || operation == SetOperation::Xor;
+
+            auto result = roaring_bitmap{};
+            auto lhs_index = 0_usize;
+            auto rhs_index = 0_usize;
+            const auto lhs_count = access::count(lhs);
+            const auto rhs_count = access::count(rhs);
+            while(lhs_index < lhs_count || rhs_index < rhs_count) {
+                const auto lhs_key = lhs_index < lhs_count ?
+                                         static_cast<u32>(access::key(lhs, lhs_index)) :
+                                         k_low_mask + 1U;
+                const auto rhs_key = rhs_index < rhs_count ?
+                                         static_cast<u32>(access::key(rhs, rhs_index)) :
+                                         k_low_mask + 1U;
+                if(lhs_key == rhs_key) {
+                    auto merged = apply(access::ref(lhs, lhs_index++),
+                                        access::ref(rhs, rhs_index++),
+                                        operation);
+                    if(merged.cardinality != 0U) {
+                        access::append(result, static_cast<u16>(lhs_key), std::move(merged));
+                    }
+                }
+                else if(lhs_key < rhs_key) {
+                    if(keep_lhs) {
+                        access::append(result,
+                                       static_cast<u16>(lhs_key),
+                                       copy(access::ref(lhs, lhs_index)));
+                    }
+                    ++lhs_index;
+                }
+                else {
+                    if(keep_rhs) {
+                        access::append(result,
+                                       static_cast<u16>(rhs_key),
+                                       copy(access::ref(rhs, rhs_index)));
+                    }
+                    ++rhs_index;
+                }
+            }
+            return result;
+        }
+    } // namespace detail::roaring
+
+    inline auto roaring_view::to_bitmap() const -> roaring_bitmap {
+        auto result = roaring_bitmap{};
+        for(auto index = 0_usize; index < m_count; ++index) {
+            detail::roaring::access::append(result,
+                                            key_at(index),
+                                            detail::roaring::copy(ref_at(index)));
+        }
+        return result;
+    }
+
+    /// @brief Returns the intersection of `lhs` and `rhs`
+    /// @ingroup roaring
+    template<RoaringSet TLhs, RoaringSet TRhs>
+    [[nodiscard]] auto operator&(const TLhs& lhs, const TRhs& rhs) -> roaring_bitmap {
+        return detail::roaring::combine_sets(lhs, rhs, detail::roaring::SetOperation::And);
+    }
+
+    /// @brief Returns the union of `lhs` and `rhs`
+    /// @ingroup roaring
+    template<RoaringSet TLhs, RoaringSet TRhs>
+    [[nodiscard]] auto operator|(const TLhs& lhs, const TRhs& rhs) -> roaring_bitmap {
+        return detail::roaring::combine_sets(lhs, rhs, detail::roaring::SetOperation::Or);
+    }
+
+    /// @brief Returns the symmetric difference of `lhs` and `rhs`
+    /// @ingroup roaring
+    template<RoaringSet TLhs, RoaringSet TRhs>
+    [[nodiscard]] auto operator^(const TLhs& lhs, const TRhs& rhs) -> roaring_bitmap {
+        return detail::roaring::combine_sets(lhs, rhs, detail::roaring::SetOperation::Xor);
+    }
+
+    /// @brief Returns the values of `lhs` that are not in `rhs`
+    /// @ingroup roaring
+    template<RoaringSet TLhs, RoaringSet TRhs>
+    [[nodiscard]] auto operator-(const TLhs& lhs, const TRhs& rhs) -> roaring_bitmap {
+        return detail::roaring::combine_sets(lhs, rhs, detail::roaring::SetOperation::AndNot);
+    }
+
+    /// @brief Intersects `lhs` with `rhs` in place
+    /// @ingroup roaring
+    template<RoaringSet TRhs>
+    auto operator&=(roaring_bitmap& lhs, const TRhs& rhs) -> roaring_bitmap& {
+        return lhs = lhs & rhs;
+    }
+
+    /// @brief Unions `lhs` with `rhs` in place
+    /// @ingroup roaring
+    template<RoaringSet TRhs>
+    auto operator|=(roaring_bitmap& lhs, const TRhs& rhs) -> roaring_bitmap& {
+        return lhs = lhs | rhs;
+    }
+
+    /// @brief Replaces `lhs` with its symmetric difference with `rhs`
+    /// @ingroup roaring
+    template<RoaringSet TRhs>
+    auto operator^=(roaring_bitmap& lhs, const TRhs& rhs) -> roaring_bitmap& {
+        return lhs = lhs ^ rhs;
+    }
+
+    /// @brief Removes the values of `rhs` from `lhs`
+    /// @ingroup roaring
+    template<RoaringSet TRhs>
+    auto operator-=(roaring_bitmap& lhs, const TRhs& rhs) -> roaring_bitmap& {
+        return lhs = lhs - rhs;
+    }
+
+    /// @brief Returns the cardinality of the intersection of `lhs` and `rhs`, without
+    /// materializing it
+    /// @param lhs The first set
+    /// @param rhs The second set
+    /// @return The number of values in both sets
+    /// @ingroup roaring
+    /// @headerfile hyperion/platform/roaring.h
+    template<RoaringSet TLhs, RoaringSet TRhs>
+    [[nodiscard]] auto intersection_cardinality(const TLhs& lhs, const TRhs& rhs) -> u64 {
+        using detail::roaring::access;
+        auto total = 0_u64;
+        auto lhs_index = 0_usize;
+        auto rhs_index = 0_usize;
+        while(lhs_index < access::count(lhs) && rhs_index < access::count(rhs)) {
+            const auto lhs_key = access::key(lhs, lhs_index);
+            const auto rhs_key = access::key(rhs, rhs_index);
+            if(lhs_key == rhs_key) {
+                total += detail::roaring::intersection_cardinality(access::ref(lhs, lhs_index++),
+                                                                   access::ref(rhs, rhs_index++));
+            }
+            else {
+                lhs_index += static_cast<usize>(lhs_key < rhs_key);
+                rhs_index += static_cast<usize>(rhs_key < lhs_key);
+            }
+        }
+        return total;
+    }
+
+#if HYPERION_PLATFORM_IS_UNIX
+
+    /// @brief A `roaring_view` over a read-only memory mapping of a file containing a
+    /// serialized `roaring_bitmap`
+    ///
+    /// Pages of the file are only read as the containers on them are accessed, so large
+    /// on-disk indexes can be queried without loading them.
+    ///
+    /// @ingroup roaring
+    /// @headerfile hyperion/platform/roaring.h
+    class mapped_roaring_view {
+      public:
+        mapped_roaring_view(const mapped_roaring_view&) = delete;
+        mapped_roaring_view(mapped_roaring_view&& other) noexcept
+            : m_address{std::exchange(other.m_address, nullptr)},
+              m_size{std::exchange(other.m_size, 0_usize)},
+              m_view{std::exchange(other.m_view, roaring_view{})} {
+        }
+
+        ~mapped_roaring_view() noexcept {
+            unmap();
+        }
+
+        auto operator=(const mapped_roaring_view&) -> mapped_roaring_view& = delete;
+        auto operator=(mapped_roaring_view&& other) noexcept -> mapped_roaring_view& {
+            if(this != &other) {
+                unmap();
+                m_address = std::exchange(other.m_address, nullptr);
+                m_size = std::exchange(other.m_size, 0_usize);
+                m_view = std::exchange(other.m_view, roaring_view{});
+            }
+            return *this;
+        }
+
+        /// @brief Maps the file at `path` and creates a view of the serialized set it contains
+        /// @param path The path of the file
+        /// @return The mapped view, or the reason it could not be created
+        [[nodiscard]] static auto
+        open(const char* path) noexcept -> expected<mapped_roaring_view, RoaringError> {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg, hicpp-vararg)
+            const auto descriptor = ::open(path, O_RDONLY | O_CLOEXEC);
+            if(descriptor < 0) {
+                return unexpected{RoaringError::FileError};
+            }
+
+            struct stat status { };
+            if(::fstat(descriptor, &status) != 0) {
+                ::close(descriptor);
+                return unexpected{RoaringError::FileError};
+            }
+            const auto size = static_cast<usize>(status.st_size);
+            if(size == 0_usize) {
+                ::close(descriptor);
+                return unexpected{RoaringError::InvalidHeader};
+            }
+
+            auto* const address = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+            ::close(descriptor);
+            if(address == MAP_FAILED) { // NOLINT(cppcoreguidelines-pro-type-cstyle-cast)
+                return unexpected{RoaringError::FileError};
+            }
+
+            auto mapped = mapped_roaring_view{address, size};
+            auto view = roaring_view::from_bytes(
+                std::span<const std::byte>{static_cast<const std::byte*>(address), size});
+            if(!view) {
+                return unexpected{view.error()};
+            }
+            mapped.m_view = *view;
+            return mapped;
+        }
+
+        /// @brief Returns the view of the mapped set
+        /// @return The view
+        [[nodiscard]] auto view() const noexcept -> const roaring_view& {
+            return m_view;
+        }
+
+      private:
+        void* m_address = nullptr;
+        usize m_size = 0;
+        roaring_view m_view;
+
+        mapped_roaring_view(void* address, usize size) noexcept
+            : m_address{address}, m_size{size} {
+        }
+
+        auto unmap() noexcept -> void {
+            if(m_address != nullptr) {
+                ::munmap(m_address, m_size);
+                m_address = nullptr;
+            }
+        }
+    };
+
+#endif // HYPERION_PLATFORM_IS_UNIX
+
+} // namespace hyperion
+
+#if defined(HYPERION_ENABLE_TESTING) && HYPERION_ENABLE_TESTING
+
+    #include <boost/ut.hpp>
+
+    #include <cstdio>
+    #include <cstdlib>
+    #include <random>
+    #include <set>
+
+namespace hyperion::_test::platform::roaring {
+
+    // NOLINTNEXTLINE(google-build-using-namespace)
+    using namespace boost::ut;
+
+    inline auto to_set(const roaring_bitmap& bitmap) -> std::set<u32> {
+        auto values = std::set<u32>{};
+        bitmap.for_each([&values](u32 value) { values.insert(value); });
+        return values;
+    }
+
+    // a mixture of sparse, dense and clustered chunks
+    inline auto random_bitmap(std::mt19937& engine, std::set<u32>& reference) -> roaring_bitmap {
+        const auto random = [&engine] { return static_cast<u32>(engine()); };
+        auto bitmap = roaring_bitmap{};
+        for(auto chunk = 0U; chunk < 6U; ++chunk) {
+            const auto base = (random() % 8U) << 16U;
+            switch(random() % 3U) {
+                case 0:
+                    for(auto count = 0U; count < 200U; ++count) {
+                        const auto value = base + (random() & 0xFFFFU);
+                        hyperion::ignore(bitmap.add(value));
+                        reference.insert(value);
+                    }
+                    break;
+                case 1:
+                    for(auto count = 0U; count < 9000U; ++count) {
+                        const auto value = base + (random() & 0xFFFFU);
+                        hyperion::ignore(bitmap.add(value));
+                        reference.insert(value);
+                    }
+                    break;
+                default:
+                    {
+                        const auto first = base + (random() & 0x7FFFU);
+                        const auto last = first + (random() & 0x3FFFU);
+                        bitmap.add_range(first, last);
+                        for(auto value = first; value <= last; ++value) {
+                            reference.insert(value);
+                        }
+                    }
+                    break;
+            }
+        }
+        if(random() % 2U == 0U) {
+            bitmap.run_optimize();
+        }
+        return bitmap;
+    }
+
+    // NOLINTNEXTLINE(cert-err58-cpp)
+    static const suite<"hyperion::platform::roaring"> roaring_tests = [] {
+        "add_remove_contains"_test = [] {
+            auto bitmap = roaring_bitmap{1U, 70'000U, 0xFFFF'FFFFU};
+            expect(that % bitmap.cardinality() == 3_u64);
+            expect(that % bitmap.contains(70'000U));
+            expect(that % !bitmap.contains(2U));
+            expect(that % !bitmap.add(1U));
+            expect(that % bitmap.remove(1U));
+            expect(that % !bitmap.remove(1U));
+            expect(that % bitmap.contains(0xFFFF'FFFFU));
+
+            // growing past the array limit converts to a bitmap container and back
+            for(auto value = 0U; value < 10'000U; ++value) {
+                hyperion::ignore(bitmap.add(value * 2U));
+            }
+            expect(that % bitmap.cardinality() == 10'002_u64);
+            for(auto value = 0U; value < 9'000U; ++value) {
+                hyperion::ignore(bitmap.remove(value * 2U));
+            }
+            expect(that % bitmap.cardinality() == 1'002_u64);
+            expect(that % bitmap.contains(19'998U));
+            expect(that % !bitmap.contains(17'998U));
+        };
+
+        "ranges_and_runs"_test = [] {
+            auto bitmap = roaring_bitmap{};
+            bitmap.add_range(65'000U, 200'000U);
+            expect(that % bitmap.cardinality() == 135'001_u64);
+            expect(that % bitmap.contains(65'000U));
+            expect(that % bitmap.contains(200'000U));
+            expect(that % !bitmap.contains(200'001U));
+
+            hyperion::ignore(bitmap.add(10U));
+            expect(that % bitmap.remove(100'000U));
+            expect(that % !bitmap.contains(100'000U));
+            expect(that % bitmap.cardinality() == 135'001_u64);
+
+            bitmap.run_optimize();
+            expect(that % bitmap.cardinality() == 135'001_u64);
+            expect(that % bitmap.contains(99'999U));
+            expect(that % !bitmap.contains(100'000U));
+            expect(that % bitmap.serialized_size() <= 128_usize);
+        };
+
+        "intersect_arrays_kernel"_test = [] {
+            auto random = std::mt19937{7U}; // NOLINT(cert-msc32-c, cert-msc51-cpp)
+            auto matches = true;
+            for(auto round = 0U; round < 200U; ++round) {
+                auto make = [&random](usize size, u32 range) {
+                    auto values = std::set<u16>{};
+                    while(values.size() < size) {
+                        values.insert(static_cast<u16>(random() % range));
+                    }
+                    return std::vector<u16>{values.begin(), values.end()};
+                };
+                const auto lhs = make(random() % 300U, 1'000U);
+                const auto rhs = make(round % 10U == 0U ? 4000U : random() % 300U, 60'000U);
+
+                auto expected_values = std::vector<u16>{};
+                std::set_intersection(lhs.begin(),
+                                      lhs.end(),
+                                      rhs.begin(),
+                                      rhs.end(),
+                                      std::back_inserter(expected_values));
+                auto out = std::vector<u16>(std::min(lhs.size(), rhs.size())
+                                            + detail::roaring::k_intersect_slack);
+                out.resize(detail::roaring::intersect_arrays(lhs.data(),
+                                                             lhs.size(),
+                                                             rhs.data(),
+                                                             rhs.size(),
+                                                             out.data()));
+                matches = matches && out == expected_values;
+            }
+            expect(that % matches);
+        };
+
+        "set_operations_match_reference"_test = [] {
+            auto random = std::mt19937{42U}; // NOLINT(cert-msc32-c, cert-msc51-cpp)
+            auto matches = true;
+            for(auto round = 0U; round < 12U; ++round) {
+                auto lhs_reference = std::set<u32>{};
+                auto rhs_reference = std::set<u32>{};
+                const auto lhs = random_bitmap(random, lhs_reference);
+                const auto rhs = random_bitmap(random, rhs_reference);
+
+                auto expected_and = std::set<u32>{};
+                auto expected_or = std::set<u32>{};
+                auto expected_xor = std::set<u32>{};
+                auto expected_andnot = std::set<u32>{};
+                // clang-format off
+                std::set_intersection(lhs_reference.begin(), lhs_reference.end(),
+                                      rhs_reference.begin(), rhs_reference.end(),
+                                      std::inserter(expected_and, expected_and.end()));
+                std::set_union(lhs_reference.begin(), lhs_reference.end(),
+                               rhs_reference.begin(), rhs_reference.end(),
+                               std::inserter(expected_or, expected_or.end()));
+                std::set_symmetric_difference(lhs_reference.begin(), lhs_reference.end(),
+                                              rhs_reference.begin(), rhs_reference.end(),
+                                              std::inserter(expected_xor, expected_xor.end()));
+                std::set_difference(lhs_reference.begin(), lhs_reference.end(),
+                                    rhs_reference.begin(), rhs_reference.end(),
+                                    std::inserter(expected_andnot, expected_andnot.end()));
+                // clang-format on
+
+                matches = matches && to_set(lhs) == lhs_reference
+                          && lhs.cardinality() == lhs_reference.size()
+                          && to_set(lhs & rhs) == expected_and
+                          && to_set(lhs | rhs) == expected_or
+                          && to_set(lhs ^ rhs) == expected_xor
+                          && to_set(lhs - rhs) == expected_andnot
+                          && (lhs & rhs).cardinality() == expected_and.size()
+                          && intersection_cardinality(lhs, rhs) == expected_and.size();
+
+                auto in_place = lhs;
+                in_place |= rhs;
+                in_place -= rhs;
+                matches = matches && to_set(in_place) == expected_andnot;
+            }
+            expect(that % matches);
+        };
+
+        "serialization_round_trip"_test = [] {
+            auto random = std::mt19937{1234U}; // NOLINT(cert-msc32-c, cert-msc51-cpp)
+            auto reference = std::set<u32>{};
+            auto bitmap = random_bitmap(random, reference);
+            bitmap.run_optimize();
+
+            const auto bytes = bitmap.serialize();
+            expect(that % bytes.size() == bitmap.serialized_size());
+
+            const auto restored = roaring_bitmap::deserialize(bytes);
+            expect(that % restored.has_value());
+            expect(*restored == bitmap);
+
+            const auto view = roaring_view::from_bytes(bytes);
+            expect(that % view.has_value());
+            expect(that % view->cardinality() == bitmap.cardinality());
+            auto contained = true;
+            for(const auto value : reference) {
+                contained = contained && view->contains(value);
+            }
+            expect(that % contained);
+            expect(view->to_bitmap() == bitmap);
+            expect((*view & bitmap) == bitmap);
+            expect(that % (*view - bitmap).empty());
+            expect(that % intersection_cardinality(*view, bitmap) == bitmap.cardinality());
+        };
+
+        "deserialize_rejects_invalid_input"_test = [] {
+            const auto bitmap = roaring_bitmap{1U, 2U, 3U, 100'000U};
+            auto bytes = bitmap.serialize();
+
+            const auto truncated = std::span<const std::byte>{bytes}.first(bytes.size() - 2_usize);
+            expect(roaring_bitmap::deserialize(truncated).error() == RoaringError::Truncated);
+            expect(roaring_view::from_bytes(truncated).error() == RoaringError::Truncated);
+
+            auto unsorted = bytes;
+            // swap the first two array values of the first container
+            const auto first_payload = detail::roaring::align_payload(
+                detail::roaring::k_header_size + 2_usize * detail::roaring::k_descriptor_size);
+            std::swap(unsorted[first_payload], unsorted[first_payload + 2_usize]);
+            expect(roaring_bitmap::deserialize(unsorted).error() == RoaringError::Corrupt);
+
+            bytes[0] = std::byte{0};
+            expect(roaring_bitmap::deserialize(bytes).error() == RoaringError::InvalidHeader);
+        };
+
+    #if HYPERION_PLATFORM_IS_UNIX
+        "mapped_view"_test = [] {
+            auto bitmap = roaring_bitmap{5U, 6U, 7U};
+            bitmap.add_range(1'000'000U, 1'100'000U);
+            const auto bytes = bitmap.serialize();
+
+            auto path = std::array<char, 32>{"/tmp/hyperion_roaring_XXXXXX"};
+            const auto descriptor = ::mkstemp(path.data());
+            expect(that % descriptor >= 0);
+            const auto written = ::write(descriptor, bytes.data(), bytes.size());
+            expect(that % written == static_cast<ssize_t>(bytes.size()));
+            ::close(descriptor);
+
+            {
+                const auto mapped = mapped_roaring_view::open(path.data());
+                expect(that % mapped.has_value());
+                expect(that % mapped->view().contains(1'050'000U));
+                expect(that % mapped->view().cardinality() == bitmap.cardinality());
+                expect(mapped->view().to_bitmap() == bitmap);
+            }
+            ::unlink(path.data());
+
+            expect(mapped_roaring_view::open("/nonexistent/hyperion_roaring").error()
+                   == RoaringError::FileError);
+        };
+    #endif // HYPERION_PLATFORM_IS_UNIX
+    };
+
+} // namespace hyperion::_test::platform::roaring
+
+#endif // defined(HYPERION_ENABLE_TESTING) && HYPERION_ENABLE_TESTING
+
+#endif // HYPERION_PLATFORM_ROARING_H
@@ -0,0 +1,405 @@
+/// @file scratch.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief A per-thread, stack-like scratch allocator for short-lived temporary buffers
+/// @version 0.4.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2024 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+#ifndef HYPERION_PLATFORM_SCRATCH_H
+#define HYPERION_PLATFORM_SCRATCH_H
+
+#include <hyperion/platform.h>
+#include <hyperion/platform/assert.h>
+#include <hyperion/platform/def.h>
+#include <hyperion/platform/types.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+/// @ingroup platform
+/// @{
+///	@defgroup scratch Scratch Allocation
+/// `hyperion::scratch_scope` provides temporary storage from a per-thread stack of memory.
+/// Allocations made through a scope are a pointer increment in the common case, and are all
+/// released together, in constant time, when the scope exits. This makes it well suited to the
+/// short-lived buffers and containers created and destroyed within a single function call,
+/// that would otherwise each cost a trip through `malloc` and `free`.
+///
+/// Each thread's stack is a list of cache-line-aligned chunks that grows geometrically as
+/// needed and is retained for reuse for the lifetime of the thread, so a thread in its steady
+/// state performs no heap allocations at all. Scopes nest, and must be destroyed in reverse
+/// order of construction. Only the innermost scope of a thread may allocate.
+///
+/// `scratch_scope` is a `std::pmr::memory_resource`, so it can back any `std::pmr` container.
+/// Deallocation through the resource is a no-op; memory is reclaimed when the scope exits.
+///
+/// In builds with Tracy profiling enabled, each scope's usage is reported to the
+/// `"hyperion::scratch"` memory pool.
+///
+/// # Example
+/// @code {.cpp}
+/// auto handle_request(const request& req) -> response {
+///     auto scratch = hyperion::scratch_scope{};
+///     auto ids = std::pmr::vector<u64>{&scratch};
+///     auto buffer = scratch.allocate_array<std::byte>(req.size());
+///     // ...
+/// } // everything allocated from `scratch` is released here
+/// @endcode
+/// @headerfile hyperion/platform/scratch.h
+/// @}
+
+namespace hyperion {
+
+    class scratch_scope;
+
+    namespace detail::scratch {
+        static constexpr auto k_alignment = static_cast<usize>(HYPERION_PLATFORM_CACHE_LINE_SIZE);
+        static constexpr auto k_initial_chunk_size = 64_usize * 1024_usize;
+
+        HYPERION_IGNORE_PADDING_WARNING_START;
+
+        struct chunk {
+            std::byte* data;
+            usize capacity;
+        };
+
+        /// @brief A position in the stack, to which it is rolled back when a scope exits
+        struct marker {
+            usize chunk;
+            usize offset;
+        };
+
+        /// @brief The per-thread stack of chunks scratch scopes allocate from
+        class stack {
+          public:
+            stack() noexcept = default;
+            stack(const stack&) = delete;
+            stack(stack&&) = delete;
+            ~stack() noexcept {
+                for(const auto& chunk : m_chunks) {
+                    ::operator delete(chunk.data, std::align_val_t{k_alignment});
+                }
+            }
+            auto operator=(const stack&) -> stack& = delete;
+            auto operator=(stack&&) -> stack& = delete;
+
+            [[nodiscard]] auto allocate(usize size, usize alignment) -> void* {
+                if(m_current < m_chunks.size()) {
+                    // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                    const auto& current = m_chunks[m_current];
+                    const auto offset = aligned_offset(current, m_offset, alignment);
+                    if(offset <= current.capacity && size <= current.capacity - offset) {
+                        m_offset = offset + size;
+                        // NOLINTNEXTLINE(*-pro-bounds-pointer-arithmetic)
+                        return current.data + offset;
+                    }
+                }
+                return allocate_in_next_chunk(size, alignment);
+            }
+
+            [[nodiscard]] auto position() const noexcept -> marker {
+                return {m_current, m_offset};
+            }
+
+            auto rewind(marker position) noexcept -> void {
+                m_current = position.chunk;
+                m_offset = position.offset;
+            }
+
+            [[nodiscard]] auto reserved_bytes() const noexcept -> usize {
+                auto total = 0_usize;
+                for(const auto& chunk : m_chunks) {
+                    total += chunk.capacity;
+                }
+                return total;
+            }
+
+            const scratch_scope* m_innermost = nullptr;
+
+          private:
+            std::vector<chunk> m_chunks;
+            usize m_current = 0_usize;
+            usize m_offset = 0_usize;
+
+            [[nodiscard]] static auto
+            aligned_offset(const chunk& chunk, usize offset, usize alignment) noexcept -> usize {
+                // NOLINTNEXTLINE(*-pro-type-reinterpret-cast)
+                const auto address = reinterpret_cast<std::uintptr_t>(chunk.data) + offset;
+                return offset + ((alignment - (address & (alignment - 1_usize)))
+                                 & (alignment - 1_usize));
+            }
+
+            // moves to the next chunk large enough for the allocation, allocating it if
+            // necessary. Chunks past the current one are unused, so one that is too small is
+            // replaced
+            [[nodiscard]] auto allocate_in_next_chunk(usize size, usize alignment) -> void* {
+                const auto next = m_chunks.empty() ? 0_usize : m_current + 1_usize;
+                const auto padded = size + std::max(alignment, k_alignment) - k_alignment;
+                if(next == m_chunks.size() || m_chunks[next].capacity < padded) {
+                    const auto previous
+                        = next == 0_usize ? 0_usize : m_chunks[next - 1_usize].capacity * 2_usize;
+                    const auto capacity = std::max({k_initial_chunk_size, previous, padded});
+                    auto* const data = static_cast<std::byte*>(
+                        ::operator new(capacity, std::align_val_t{k_alignment}));
+                    if(next == m_chunks.size()) {
+                        m_chunks.push_back({data, capacity});
+                    }
+                    else {
+                        ::operator delete(m_chunks[next].data, std::align_val_t{k_alignment});
+                        m_chunks[next] = {data, capacity};
+                    }
+                }
+
+                m_current = next;
+                const auto& current = m_chunks[next];
+                const auto offset = aligned_offset(current, 0_usize, alignment);
+                m_offset = offset + size;
+                // NOLINTNEXTLINE(*-pro-bounds-pointer-arithmetic)
+                return current.data + offset;
+            }
+        };
+
+        HYPERION_IGNORE_PADDING_WARNING_STOP;
+
+        [[nodiscard]] inline auto thread_stack() noexcept -> stack& {
+            thread_local auto t_stack = stack{};
+            return t_stack;
+        }
+    } // namespace detail::scratch
+
+    HYPERION_IGNORE_PADDING_WARNING_START;
+
+    /// @brief A scope of LIFO temporary storage taken from the calling thread's scratch stack.
+    ///
+    /// Everything allocated through the scope is released when it is destroyed. Scopes must be
+    /// destroyed in the reverse order they were created, on the thread that created them, and
+    /// only a thread's innermost scope may allocate.
+    /// @ingroup scratch
+    /// @headerfile hyperion/platform/scratch.h
+    class scratch_scope final : public std::pmr::memory_resource {
+      public:
+        /// @brief Opens a new scope at the top of the calling thread's scratch stack
+        scratch_scope() noexcept
+            : m_stack{&detail::scratch::thread_stack()},
+              m_start{m_stack->position()},
+              m_parent{m_stack->m_innermost} {
+            m_stack->m_innermost = this;
+        }
+
+        scratch_scope(const scratch_scope&) = delete;
+        scratch_scope(scratch_scope&&) = delete;
+
+        /// @brief Releases everything allocated through the scope
+        ~scratch_scope() noexcept override {
+            HYPERION_DEBUG_ASSERT(m_stack->m_innermost == this,
+                                  "scratch_scopes must be destroyed in LIFO order");
+            if(m_bytes_used != 0_usize) {
+                HYPERION_PROFILE_FREE(this, "hyperion::scratch");
+            }
+            m_stack->rewind(m_start);
+            m_stack->m_innermost = m_parent;
+        }
+
+        auto operator=(const scratch_scope&) -> scratch_scope& = delete;
+        auto operator=(scratch_scope&&) -> scratch_scope& = delete;
+
+        /// @brief Allocates `size` bytes aligned to `alignment`
+        ///
+        /// # Requirements
+        /// - `alignment` is a power of two
+        /// - this is the calling thread's innermost scope
+        ///
+        /// # Exceptions
+        /// Throws `std::bad_alloc` if the stack needs to grow and the memory cannot be
+        /// allocated.
+        /// @param size The number of bytes to allocate
+        /// @param alignment The alignment of the allocation
+        /// @return A pointer to the uninitialized memory, valid until the scope exits
+        [[nodiscard]] auto
+        allocate(usize size, usize alignment = alignof(std::max_align_t)) -> void* {
+            HYPERION_DEBUG_ASSERT(alignment != 0_usize && (alignment & (alignment - 1_usize)) == 0,
+                                  "scratch alignment must be a power of two");
+            HYPERION_DEBUG_ASSERT(m_stack->m_innermost == this,
+                                  "only the innermost scratch_scope may allocate");
+            auto* const memory = m_stack->allocate(size, alignment);
+            if(m_bytes_used != 0_usize) {
+                HYPERION_PROFILE_FREE(this, "hyperion::scratch");
+            }
+            m_bytes_used += size;
+            HYPERION_PROFILE_ALLOC(this, m_bytes_used, "hyperion::scratch");
+            return memory;
+        }
+
+        /// @brief Allocates an array of `count` default-initialized `TType`s
+        ///
+        /// The elements are never destroyed, so `TType` must be trivially destructible.
+        /// @tparam TType The element type
+        /// @param count The number of elements
+        /// @return The array, valid until the scope exits
+        template<typename TType>
+            requires std::is_trivially_destructible_v<TType>
+                     && std::is_default_constructible_v<TType>
+        [[nodiscard]] auto allocate_array(usize count) -> std::span<TType> {
+            HYPERION_ASSERT(count <= static_cast<usize>(-1) / sizeof(TType),
+                            "scratch array size overflows");
+            auto* const memory
+                = static_cast<TType*>(allocate(count * sizeof(TType), alignof(TType)));
+            std::uninitialized_default_construct_n(memory, count);
+            return {memory, count};
+        }
+
+        /// @brief Returns the total number of bytes requested through this scope
+        /// @return The number of bytes used
+        [[nodiscard]] auto bytes_used() const noexcept -> usize {
+            return m_bytes_used;
+        }
+
+        /// @brief Returns the number of bytes the calling thread's scratch stack has reserved
+        /// from the heap
+        /// @return The number of reserved bytes
+        [[nodiscard]] static auto thread_reserved_bytes() noexcept -> usize {
+            return detail::scratch::thread_stack().reserved_bytes();
+        }
+
+      private:
+        detail::scratch::stack* m_stack;
+        detail::scratch::marker m_start;
+        const scratch_scope* m_parent;
+        usize m_bytes_used = 0_usize;
+
+        [[nodiscard]] auto do_allocate(usize bytes, usize alignment) -> void* override {
+            return allocate(bytes, alignment);
+        }
+
+        auto do_deallocate([[maybe_unused]] void* pointer,
+                           [[maybe_unused]] usize bytes,
+                           [[maybe_unused]] usize alignment) -> void override {
+        }
+
+        [[nodiscard]] auto
+        do_is_equal(const std::pmr::memory_resource& other) const noexcept -> bool override {
+            return this == &other;
+        }
+    };
+
+    HYPERION_IGNORE_PADDING_WARNING_STOP;
+
+} // namespace hyperion
+
+#if defined(HYPERION_ENABLE_TESTING) && HYPERION_ENABLE_TESTING
+
+    #include <boost/ut.hpp>
+
+    #include <numeric>
+
+namespace hyperion::_test::platform::scratch {
+
+    // NOLINTNEXTLINE(google-build-using-namespace)
+    using namespace boost::ut;
+
+    // NOLINTNEXTLINE(cert-err58-cpp)
+    static const suite<"hyperion::platform::scratch"> scratch_tests = [] {
+        "bump"_test = [] {
+            auto scope = scratch_scope{};
+            auto* const first = static_cast<std::byte*>(scope.allocate(24_usize, 8_usize));
+            auto* const second = static_cast<std::byte*>(scope.allocate(8_usize, 8_usize));
+            expect(that % (second - first) == 24);
+            expect(that % scope.bytes_used() == 32_usize);
+
+            auto* const aligned = scope.allocate(1_usize, 256_usize);
+            // NOLINTNEXTLINE(*-pro-type-reinterpret-cast)
+            expect(that % (reinterpret_cast<std::uintptr_t>(aligned) % 256U) == 0U);
+        };
+
+        "release_on_exit"_test = [] {
+            void* first = nullptr;
+            {
+                auto scope = scratch_scope{};
+                first = scope.allocate(100_usize, 64_usize);
+            }
+            auto scope = scratch_scope{};
+            expect(that % scope.allocate(100_usize, 64_usize) == first);
+        };
+
+        "nesting"_test = [] {
+            auto outer = scratch_scope{};
+            auto values = outer.allocate_array<u32>(16_usize);
+            std::iota(values.begin(), values.end(), 0_u32);
+            void* inner_memory = nullptr;
+            {
+                auto inner = scratch_scope{};
+                inner_memory = inner.allocate(64_usize, 8_usize);
+                auto more = inner.allocate_array<u32>(16_usize);
+                std::fill(more.begin(), more.end(), 99_u32);
+            }
+            expect(that % values[15] == 15_u32);
+            expect(that % outer.allocate(64_usize, 8_usize) == inner_memory);
+        };
+
+        "growth"_test = [] {
+            const auto reserved = scratch_scope::thread_reserved_bytes();
+            {
+                auto scope = scratch_scope{};
+                auto small = scope.allocate_array<std::byte>(1000_usize);
+                auto large = scope.allocate_array<u64>(100'000_usize);
+                std::fill(large.begin(), large.end(), 7_u64);
+                small.front() = std::byte{1};
+                expect(that % large.back() == 7_u64);
+                expect(that % small.front() == std::byte{1});
+                expect(that % scratch_scope::thread_reserved_bytes() >= 801'000_usize);
+            }
+            const auto grown = scratch_scope::thread_reserved_bytes();
+            expect(that % grown > reserved);
+            {
+                auto scope = scratch_scope{};
+                expect(that % scope.allocate_array<u64>(100'000_usize).size() == 100'000_usize);
+            }
+            // the stack's chunks are reused rather than reallocated
+            expect(that % scratch_scope::thread_reserved_bytes() == grown);
+        };
+
+        "memory_resource"_test = [] {
+            auto scope = scratch_scope{};
+            auto values = std::pmr::vector<u64>{&scope};
+            for(auto value = 0_u64; value < 10'000_u64; ++value) {
+                values.push_back(value);
+            }
+            expect(that % values.back() == 9'999_u64);
+            expect(that % scope.bytes_used() >= 10'000_usize * sizeof(u64));
+            expect(scope.is_equal(scope));
+        };
+    };
+
+} // namespace hyperion::_test::platform::scratch
+
+#endif // defined(HYPERION_ENABLE_TESTING) && HYPERION_ENABLE_TESTING
+
+#endif // HYPERION_PLATFORM_SCRATCH_H
@@ -0,0 +1,461 @@
+/// @file seqlock.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Sequence lock for small, frequently-read shared state
+/// @version 0.4.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2024 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef HYPERION_PLATFORM_SEQLOCK_H
+#define HYPERION_PLATFORM_SEQLOCK_H
+
+#include <hyperion/platform.h>
+#include <hyperion/platform/cpu.h>
+#include <hyperion/platform/def.h>
+#include <hyperion/platform/types.h>
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <cstring>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+/// @ingroup platform
+/// @{
+///	@defgroup seqlock Seqlock
+/// `hyperion::seqlock<T>` publishes a small, trivially copyable value (a market data snapshot,
+/// a clock, a set of statistics) that many threads read and few threads write.
+///
+/// Unlike a mutex or `std::shared_mutex`, reading a seqlock performs no stores at all: readers
+/// load a sequence number, copy the value, and re-check the sequence number, retrying if a write
+/// overlapped the copy. Readers therefore never contend with each other on a shared cache line,
+/// and writers are never blocked by readers.
+///
+/// `hyperion::seqlock<T>` supports a single writer; `hyperion::multi_writer_seqlock<T>` allows
+/// writes from multiple threads by having writers acquire the sequence number itself.
+///
+/// # Example
+/// @code {.cpp}
+/// struct quote {
+///     f64 bid;
+///     f64 ask;
+///     u64 timestamp;
+/// };
+///
+/// hyperion::seqlock<quote> g_quote;
+///
+/// // market data thread
+/// g_quote.store(quote{.bid = 100.25, .ask = 100.5, .timestamp = now()});
+///
+/// // any number of reader threads
+/// const auto current = g_quote.load();
+/// @endcode
+/// @headerfile hyperion/platform/seqlock.h
+/// @}
+
+namespace hyperion {
+
+    /// @brief Whether a `seqlock` supports writes from one or multiple threads
+    /// @ingroup seqlock
+    /// @headerfile hyperion/platform/seqlock.h
+    enum class SeqlockWriters : bool {
+        Single = false,
+        Multiple = true
+    };
+
+    namespace detail::seqlock {
+
+        /// @brief Orders a reader's loads of the protected data before its closing load of the
+        /// sequence number
+        inline auto read_fence() noexcept -> void {
+#if HYPERION_PLATFORM_IS_ARCHITECTURE(HYPERION_PLATFORM_X86_64) \
+    || HYPERION_PLATFORM_IS_ARCHITECTURE(HYPERION_PLATFORM_X86)
+            // x86-TSO never reorders loads with other loads, so only the compiler needs to be
+            // prevented from doing so
+            std::atomic_signal_fence(std::memory_order_acquire);
+#else
+            std::atomic_thread_fence(std::memory_order_acquire);
+#endif // HYPERION_PLATFORM_IS_ARCHITECTURE(HYPERION_PLATFORM_X86_64)
+       // || HYPERION_PLATFORM_IS_ARCHITECTURE(HYPERION_PLATFORM_X86)
+        }
+
+        /// @brief Orders a writer's store of the (odd) sequence number before its stores to the
+        /// protected data
+        inline auto write_fence() noexcept -> void {
+#if HYPERION_PLATFORM_IS_ARCHITECTURE(HYPERION_PLATFORM_X86_64) \
+    || HYPERION_PLATFORM_IS_ARCHITECTURE(HYPERION_PLATFORM_X86)
+            // x86-TSO never reorders stores with other stores, so only the compiler needs to be
+            // prevented from doing so
+            std::atomic_signal_fence(std::memory_order_release);
+#else
+            std::atomic_thread_fence(std::memory_order_release);
+#endif // HYPERION_PLATFORM_IS_ARCHITECTURE(HYPERION_PLATFORM_X86_64)
+       // || HYPERION_PLATFORM_IS_ARCHITECTURE(HYPERION_PLATFORM_X86)
+        }
+
+        template<typename TType>
+        static inline constexpr auto word_count = (sizeof(TType) + sizeof(usize) - 1_usize)
+                                                  / sizeof(usize);
+    } // namespace detail::seqlock
+
+    HYPERION_IGNORE_PADDING_WARNING_START;
+
+    /// @brief A sequence lock protecting a value of the trivially copyable type `TType`.
+    ///
+    /// Reads never store to shared memory: `load` copies the value and retries only if a write
+    /// overlapped the copy. Writes bump the sequence number to an odd value, store the new
+    /// value, and then bump it to the next even value, so writes are never delayed by readers.
+    /// Because readers may retry indefinitely under continuous writes, seqlocks are best suited
+    /// to small values that are read far more often than they are written.
+    ///
+    /// The value is stored as an array of word-sized atomics, so concurrent reads and writes are
+    /// free of data races, and the whole lock is aligned to (and padded to a multiple of) the
+    /// cache line size, so it never shares a cache line with unrelated data.
+    ///
+    /// @tparam TType The type of the protected value
+    /// @tparam TWriters Whether writes may be performed concurrently from multiple threads.
+    /// With `SeqlockWriters::Single`, at most one thread may write at a time.
+    /// @ingroup seqlock
+    /// @headerfile hyperion/platform/seqlock.h
+    template<typename TType, SeqlockWriters TWriters = SeqlockWriters::Single>
+        requires std::is_trivially_copyable_v<TType> && (!std::is_const_v<TType>)
+    class alignas(HYPERION_PLATFORM_CACHE_LINE_SIZE) seqlock {
+      public:
+        /// @brief The type of the protected value
+        using value_type = TType;
+
+        /// @brief Constructs a `seqlock` holding a value-initialized `TType`
+        constexpr seqlock() noexcept
+            requires std::is_nothrow_default_constructible_v<TType>
+            : seqlock(TType{}) {
+        }
+
+        /// @brief Constructs a `seqlock` holding `value`
+        /// @param value The initial value
+        explicit seqlock(const TType& value) noexcept {
+            store_words(value);
+        }
+
+        seqlock(const seqlock&) = delete;
+        seqlock(seqlock&&) = delete;
+        ~seqlock() noexcept = default;
+        auto operator=(const seqlock&) -> seqlock& = delete;
+        auto operator=(seqlock&&) -> seqlock& = delete;
+
+        /// @brief Returns a consistent copy of the current value, retrying while it is
+        /// concurrently being written
+        /// @return The current value
+        [[nodiscard]] auto load() const noexcept -> TType {
+            while(true) {
+                if(auto value = try_load(); value.has_value()) {
+                    return *value;
+                }
+                platform::cpu_relax();
+            }
+        }
+
+        /// @brief Makes a single attempt to copy the current value.
+        /// @return The current value, or `std::nullopt` if a write was in progress or overlapped
+        /// the copy
+        [[nodiscard]] auto try_load() const noexcept -> std::optional<TType> {
+            const auto before = m_sequence.load(std::memory_order_acquire);
+            if((before & 1_usize) != 0_usize) [[unlikely]] {
+                return std::nullopt;
+            }
+
+            auto value = load_words();
+            detail::seqlock::read_fence();
+            if(m_sequence.load(std::memory_order_relaxed) != before) [[unlikely]] {
+                return std::nullopt;
+            }
+
+            return value;
+        }
+
+        /// @brief Replaces the current value with `value`
+        /// @param value The new value
+        /// @pre If `TWriters` is `SeqlockWriters::Single`, no other thread is writing to this
+        /// `seqlock` concurrently
+        auto store(const TType& value) noexcept -> void {
+            const auto sequence = begin_write();
+            store_words(value);
+            end_write(sequence);
+        }
+
+        /// @brief Modifies the current value in place by invoking `func` with a reference to
+        /// (a copy of) it, then publishing the result. Concurrent readers never observe partial
+        /// modifications.
+        /// @tparam TFunc The type of the modifying function
+        /// @param func The function to modify the value with
+        /// @pre If `TWriters` is `SeqlockWriters::Single`, no other thread is writing to this
+        /// `seqlock` concurrently
+        template<typename TFunc>
+            requires std::invocable<TFunc, TType&>
+        auto update(TFunc&& func) noexcept(std::is_nothrow_invocable_v<TFunc, TType&>) -> void {
+            const auto sequence = begin_write();
+            // the sequence is odd until `end_write`, so we have exclusive write access
+            auto value = load_words();
+            try {
+                std::forward<TFunc>(func)(value);
+            }
+            catch(...) {
+                // the value is unchanged, so restoring the sequence number is a valid publish
+                end_write(sequence);
+                throw;
+            }
+            store_words(value);
+            end_write(sequence);
+        }
+
+        /// @brief Returns the current sequence number. The sequence number is odd while a write is
+        /// in progress and increases by two with each completed write.
+        /// @return The current sequence number
+        [[nodiscard]] auto sequence() const noexcept -> usize {
+            return m_sequence.load(std::memory_order_acquire);
+        }
+
+      private:
+        static constexpr auto k_words = detail::seqlock::word_count<TType>;
+
+        std::atomic<usize> m_sequence = 0_usize;
+        std::array<std::atomic<usize>, k_words> m_words = {};
+
+        [[nodiscard]] auto begin_write() noexcept -> usize {
+            if constexpr(TWriters == SeqlockWriters::Multiple) {
+                auto sequence = m_sequence.load(std::memory_order_relaxed);
+                while(true) {
+                    if((sequence & 1_usize) != 0_usize) {
+                        platform::cpu_relax();
+                        sequence = m_sequence.load(std::memory_order_relaxed);
+                        continue;
+                    }
+
+                    if(m_sequence.compare_exchange_weak(sequence,
+                                                        sequence + 1_usize,
+                                                        std::memory_order_acquire,
+                                                        std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+
+                detail::seqlock::write_fence();
+                return sequence;
+            }
+            else {
+                const auto sequence = m_sequence.load(std::memory_order_relaxed);
+                m_sequence.store(sequence + 1_usize, std::memory_order_relaxed);
+                detail::seqlock::write_fence();
+                return sequence;
+            }
+        }
+
+        auto end_write(usize sequence) noexcept -> void {
+            m_sequence.store(sequence + 2_usize, std::memory_order_release);
+        }
+
+        [[nodiscard]] auto load_words() const noexcept -> TType {
+            std::array<usize, k_words> words{};
+            for(auto index = 0_usize; index < k_words; ++index) {
+                // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                words[index] = m_words[index].load(std::memory_order_relaxed);
+            }
+
+            std::array<byte, sizeof(TType)> bytes{};
+            std::memcpy(bytes.data(), words.data(), sizeof(TType));
+            return std::bit_cast<TType>(bytes);
+        }
+
+        auto store_words(const TType& value) noexcept -> void {
+            const auto bytes = std::bit_cast<std::array<byte, sizeof(TType)>>(value);
+            std::array<usize, k_words> words{};
+            std::memcpy(words.data(), bytes.data(), sizeof(TType));
+
+            for(auto index = 0_usize; index < k_words; ++index) {
+                // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                m_words[index].store(words[index], std::memory_order_relaxed);
+            }
+        }
+    };
+
+    HYPERION_IGNORE_PADDING_WARNING_STOP;
+
+    /// @brief A `seqlock` that supports concurrent writes from multiple threads.
+    ///
+    /// Writers acquire exclusive access by atomically moving the sequence number from an even to
+    /// an odd value, spinning while another write is in progress. Reads are unaffected.
+    ///
+    /// @tparam TType The type of the protected value
+    /// @ingroup seqlock
+    /// @headerfile hyperion/platform/seqlock.h
+    template<typename TType>
+    using multi_writer_seqlock = seqlock<TType, SeqlockWriters::Multiple>;
+
+} // namespace hyperion
+
+#if defined(HYPERION_ENABLE_TESTING) && HYPERION_ENABLE_TESTING
+
+    #include <boost/ut.hpp>
+
+    #include <thread>
+    #include <vector>
+
+namespace hyperion::_test::platform::seqlock {
+
+    // NOLINTNEXTLINE(google-build-using-namespace)
+    using namespace boost::ut;
+
+    struct sample {
+        u64 first;
+        u64 second;
+        u64 third;
+        u32 fourth;
+    };
+
+    static_assert(alignof(hyperion::seqlock<sample>) == HYPERION_PLATFORM_CACHE_LINE_SIZE);
+    static_assert(sizeof(hyperion::seqlock<u8>) == HYPERION_PLATFORM_CACHE_LINE_SIZE);
+
+    // NOLINTNEXTLINE(cert-err58-cpp)
+    static const suite<"hyperion::platform::seqlock"> seqlock_tests = [] {
+        "load_store"_test = [] {
+            hyperion::seqlock<sample> lock{sample{1_u64, 2_u64, 3_u64, 4_u32}};
+
+            auto value = lock.load();
+            expect(that % value.first == 1_u64);
+            expect(that % value.second == 2_u64);
+            expect(that % value.third == 3_u64);
+            expect(that % value.fourth == 4_u32);
+            expect(that % lock.sequence() == 0_usize);
+
+            lock.store(sample{5_u64, 6_u64, 7_u64, 8_u32});
+            value = lock.load();
+            expect(that % value.first == 5_u64);
+            expect(that % value.fourth == 8_u32);
+            expect(that % lock.sequence() == 2_usize);
+
+            const auto attempt = lock.try_load();
+            expect(that % attempt.has_value());
+            expect(that % attempt->third == 7_u64);
+        };
+
+        "update"_test = [] {
+            hyperion::seqlock<u64> lock;
+            expect(that % lock.load() == 0_u64);
+
+            lock.update([](u64& value) { value += 3_u64; });
+            lock.update([](u64& value) { value *= 2_u64; });
+            expect(that % lock.load() == 6_u64);
+            expect(that % lock.sequence() == 4_usize);
+        };
+
+        "concurrent_readers_see_consistent_values"_test = [] {
+            constexpr auto writes = 20000_u64;
+            constexpr auto readers = 4_usize;
+
+            hyperion::seqlock<sample> lock{sample{0_u64, 0_u64, 0_u64, 0_u32}};
+            std::atomic<usize> torn = 0_usize;
+            std::atomic<bool> done = false;
+
+            std::vector<std::thread> threads;
+            threads.reserve(readers);
+            for(auto index = 0_usize; index < readers; ++index) {
+                threads.emplace_back([&]() {
+                    auto last = 0_u64;
+                    while(!done.load(std::memory_order_acquire)) {
+                        const auto value = lock.load();
+                        if(value.first != value.second || value.second != value.third
+                           || static_cast<u32>(value.first) != value.fourth
+                           || value.first < last)
+                        {
+                            torn.fetch_add(1_usize, std::memory_order_relaxed);
+                        }
+                        last = value.first;
+                    }
+                });
+            }
+
+            for(auto write = 1_u64; write <= writes; ++write) {
+                lock.store(sample{write, write, write, static_cast<u32>(write)});
+            }
+            done.store(true, std::memory_order_release);
+
+            for(auto& thread : threads) {
+                thread.join();
+            }
+
+            expect(that % torn.load() == 0_usize);
+            expect(that % lock.load().first == writes);
+        };
+
+        "multi_writer"_test = [] {
+            constexpr auto writers = 4_usize;
+            constexpr auto updates = 5000_u64;
+
+            hyperion::multi_writer_seqlock<sample> lock{sample{0_u64, 0_u64, 0_u64, 0_u32}};
+            std::atomic<usize> torn = 0_usize;
+            std::atomic<bool> done = false;
+
+            std::thread reader{[&]() {
+                while(!done.load(std::memory_order_acquire)) {
+                    const auto value = lock.load();
+                    if(value.first != value.second || value.second != value.third) {
+                        torn.fetch_add(1_usize, std::memory_order_relaxed);
+                    }
+                }
+            }};
+
+            std::vector<std::thread> threads;
+            threads.reserve(writers);
+            for(auto index = 0_usize; index < writers; ++index) {
+                threads.emplace_back([&]() {
+                    for(auto update = 0_u64; update < updates; ++update) {
+                        lock.update([](sample& value) {
+                            ++value.first;
+                            ++value.second;
+                            ++value.third;
+                        });
+                    }
+                });
+            }
+
+            for(auto& thread : threads) {
+                thread.join();
+            }
+            done.store(true, std::memory_order_release);
+            reader.join();
+
+            const auto value = lock.load();
+            expect(that % torn.load() == 0_usize);
+            expect(that % value.first == writers * updates);
+            expect(that % value.third == writers * updates);
+            expect(that % lock.sequence() == 2_usize * writers * updates);
+        };
+    };
+
+} // namespace hyperion::_test::platform::seqlock
+
+#endif // defined(HYPERION_ENABLE_TESTING) && HYPERION_ENABLE_TESTING
+
+#endif // HYPERION_PLATFORM_SEQLOCK_H
@@ -0,0 +1,635 @@
+/// @file serialization.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Zero-copy binary serialization with explicit, endian-stable layouts
+/// @version 0.4.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2024 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef HYPERION_PLATFORM_SERIALIZATION_H
+#define HYPERION_PLATFORM_SERIALIZATION_H
+
+#include <hyperion/platform.h>
+#include <hyperion/platform/assert.h>
+#include <hyperion/platform/expected.h>
+#include <hyperion/platform/types.h>
+
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <type_traits>
+
+#if HYPERION_PLATFORM_COMPILER_IS_MSVC
+    #include <cstdlib>
+#endif // HYPERION_PLATFORM_COMPILER_IS_MSVC
+
+#if defined(__AVX2__)
+    #include <immintrin.h>
+#endif // defined(__AVX2__)
+
+/// @ingroup platform
+/// @{
+///	@defgroup serialization Endian-Stable Serialization
+/// Hyperion supports binary serialization through fixed memory layouts rather than field-by-field
+/// encoding. A message is a plain struct whose fields are explicitly little- or big-endian
+/// values, such as `hyperion::le_u32` or `hyperion::be_f64`. These store their value in wire
+/// byte order and convert on access, so the struct's bytes are its serialized form on every
+/// platform: writing a message is copying it, and reading one is viewing the received buffer
+/// in place with `hyperion::view_as`, which only checks the buffer's size and alignment.
+///
+/// Endian-stable structs should satisfy `hyperion::WireLayout`, which requires that they be
+/// trivially copyable, standard layout, and free of padding, so that every byte of them is
+/// well defined. Padding must be made explicit with reserved fields. Fields have their natural
+/// alignment, so views over a buffer require it to be aligned to the struct's alignment.
+///
+/// Arrays of numbers are handled in bulk: `hyperion::encode` and `hyperion::decode` copy spans
+/// of the `types.h` aliases to and from a given byte order, and `hyperion::convert_byte_order`
+/// converts a span in place. When the byte order matches the host's (as determined by
+/// `HYPERION_PLATFORM_IS_LITTLE_ENDIAN`) these are a `memcpy` or a no-op; otherwise the bytes
+/// are swapped, 32 bytes at a time with AVX2 when available.
+///
+/// # Example
+/// @code {.cpp}
+/// struct request_header {
+///     hyperion::le_u32 magic;
+///     hyperion::le_u16 version;
+///     hyperion::le_u16 flags;
+///     hyperion::le_u64 request_id;
+///     hyperion::le_f64 deadline;
+/// };
+/// static_assert(hyperion::WireLayout<request_header>);
+///
+/// auto header = request_header{.magic = 0x51455248, .version = 1, .request_id = id};
+/// send(hyperion::object_bytes(header));
+///
+/// // on the receiving end
+/// const auto received = hyperion::view_as<request_header>(buffer);
+/// if(received && received.value()->version == 1) {
+///     handle(received.value()->request_id);
+/// }
+/// @endcode
+/// @headerfile hyperion/platform/serialization.h
+/// @}
+
+namespace hyperion {
+
+    /// @brief The order of the bytes of a multi-byte value
+    /// @ingroup serialization
+    /// @headerfile hyperion/platform/serialization.h
+    enum class ByteOrder : u8 {
+        /// @brief Least significant byte first
+        Little,
+        /// @brief Most significant byte first
+        Big,
+        /// @brief The byte order of the compiled-for platform
+        Native = HYPERION_PLATFORM_IS_LITTLE_ENDIAN ? Little : Big,
+    };
+
+    /// @brief Errors that can occur when creating a zero-copy view over a buffer
+    /// @ingroup serialization
+    /// @headerfile hyperion/platform/serialization.h
+    enum class SerializationError : u8 {
+        /// @brief The buffer is smaller than the viewed type
+        TooSmall,
+        /// @brief The buffer is not aligned to the viewed type's alignment
+        Misaligned,
+        /// @brief The buffer's size is not a multiple of the viewed element type's size
+        SizeMismatch,
+    };
+
+    /// @brief Reverses the order of the bytes of `value`
+    /// @tparam TType The integer type
+    /// @param value The value to byte-swap
+    /// @return `value` with its bytes reversed
+    /// @ingroup serialization
+    /// @headerfile hyperion/platform/serialization.h
+    template<std::integral TType>
+    [[nodiscard]] constexpr auto byteswap(TType value) noexcept -> TType {
+        if constexpr(sizeof(TType) == 1_usize) {
+            return value;
+        }
+        else {
+            using unsigned_type = std::make_unsigned_t<TType>;
+            auto bits = static_cast<unsigned_type>(value);
+#if HYPERION_PLATFORM_COMPILER_IS_MSVC
+            if(!std::is_constant_evaluated()) {
+                if constexpr(sizeof(TType) == sizeof(u16)) {
+                    return static_cast<TType>(_byteswap_ushort(bits));
+                }
+                else if constexpr(sizeof(TType) == sizeof(u32)) {
+                    return static_cast<TType>(_byteswap_ulong(bits));
+                }
+                else {
+                    return static_cast<TType>(_byteswap_uint64(bits));
+                }
+            }
+
+            auto result = unsigned_type{0};
+            for(auto index = 0_usize; index < sizeof(TType); ++index) {
+                result = static_cast<unsigned_type>((result << 8U) | (bits & 0xFFU));
+                bits = static_cast<unsigned_type>(bits >> 8U);
+            }
+            return static_cast<TType>(result);
+#else
+            if constexpr(sizeof(TType) == sizeof(u16)) {
+                return static_cast<TType>(__builtin_bswap16(bits));
+            }
+            else if constexpr(sizeof(TType) == sizeof(u32)) {
+                return static_cast<TType>(__builtin_bswap32(bits));
+            }
+            else {
+                return static_cast<TType>(__builtin_bswap64(bits));
+            }
+#endif // HYPERION_PLATFORM_COMPILER_IS_MSVC
+        }
+    }
+
+    /// @brief Requirements of a type that can be stored as a serialized number: an integer or
+    /// floating point type other than `bool`
+    /// @ingroup serialization
+    /// @headerfile hyperion/platform/serialization.h
+    template<typename TType>
+    concept WireNumber = (std::integral<TType> || std::floating_point<TType>)
+                         && !std::same_as<std::remove_cv_t<TType>, bool>;
+
+    /// @brief Requirements of a type whose object representation can be used directly as its
+    /// serialized form: trivially copyable, standard layout, and without padding bytes
+    /// @ingroup serialization
+    /// @headerfile hyperion/platform/serialization.h
+    template<typename TType>
+    concept WireLayout = std::is_trivially_copyable_v<TType> && std::is_standard_layout_v<TType>
+                         && std::has_unique_object_representations_v<TType>;
+
+    namespace detail::serialization {
+        template<usize TSize>
+        struct bits_of;
+
+        template<>
+        struct bits_of<1_usize> {
+            using type = u8;
+        };
+
+        template<>
+        struct bits_of<2_usize> {
+            using type = u16;
+        };
+
+        template<>
+        struct bits_of<4_usize> {
+            using type = u32;
+        };
+
+        template<>
+        struct bits_of<8_usize> {
+            using type = u64;
+        };
+
+        /// @brief The unsigned integer type with the same size as `TType`
+        template<typename TType>
+        using bits_t = typename bits_of<sizeof(TType)>::type;
+
+        /// @brief Reverses the bytes of each of the `count` `TWidth`-byte elements at `bytes`,
+        /// which need not be aligned
+        template<usize TWidth>
+        inline auto swap_elements(std::byte* bytes, usize count) noexcept -> void {
+            using bits = typename bits_of<TWidth>::type;
+            auto index = 0_usize;
+#if defined(__AVX2__)
+            if constexpr(TWidth > 1_usize) {
+                // reverses each element within a 128-bit lane, which elements never straddle
+                static constexpr auto k_shuffle = [] {
+                    auto shuffle = std::array<i8, sizeof(__m256i)>{};
+                    for(auto byte = 0_usize; byte < shuffle.size(); ++byte) {
+                        const auto lane_byte = byte % 16_usize;
+                        shuffle[byte] = static_cast<i8>((lane_byte / TWidth) * TWidth
+                                                        + (TWidth - 1_usize - lane_byte % TWidth));
+                    }
+                    return shuffle;
+                }();
+                constexpr auto per_vector = sizeof(__m256i) / TWidth;
+
+                // NOLINTBEGIN(*-pro-type-reinterpret-cast, *-pro-bounds-pointer-arithmetic)
+                const auto mask
+                    = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(k_shuffle.data()));
+                for(; index + per_vector <= count; index += per_vector) {
+                    auto* vector = reinterpret_cast<__m256i*>(bytes + index * TWidth);
+                    _mm256_storeu_si256(vector,
+                                        _mm256_shuffle_epi8(_mm256_loadu_si256(vector), mask));
+                }
+                // NOLINTEND(*-pro-type-reinterpret-cast, *-pro-bounds-pointer-arithmetic)
+            }
+#endif // defined(__AVX2__)
+
+            for(; index < count; ++index) {
+                auto value = bits{0};
+                // NOLINTBEGIN(*-pro-bounds-pointer-arithmetic)
+                std::memcpy(&value, bytes + index * TWidth, TWidth);
+                value = byteswap(value);
+                std::memcpy(bytes + index * TWidth, &value, TWidth);
+                // NOLINTEND(*-pro-bounds-pointer-arithmetic)
+            }
+        }
+
+        [[nodiscard]] inline auto is_aligned(const void* pointer, usize alignment) noexcept
+            -> bool {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+            return reinterpret_cast<std::uintptr_t>(pointer) % alignment == 0U;
+        }
+    } // namespace detail::serialization
+
+    /// @brief A number stored in a fixed byte order, for use as a field of a serialized struct.
+    ///
+    /// The value is held as the bytes of its representation in `TOrder`, with the natural
+    /// alignment of `TType`, and is converted to and from the host's byte order on access.
+    /// Floating point values are stored as their IEEE-754 bits.
+    ///
+    /// @tparam TType The type of the number
+    /// @tparam TOrder The byte order to store the number in
+    /// @ingroup serialization
+    /// @headerfile hyperion/platform/serialization.h
+    template<WireNumber TType, ByteOrder TOrder>
+    class endian_value {
+      public:
+        /// @brief The type of the number
+        using value_type = TType;
+        /// @brief The byte order the number is stored in
+        static constexpr auto byte_order = TOrder;
+
+        /// @brief Constructs a zero value
+        constexpr endian_value() noexcept = default;
+
+        /// @brief Constructs a stored `value`
+        /// @param value The value
+        // NOLINTNEXTLINE(google-explicit-constructor, hicpp-explicit-conversions)
+        constexpr endian_value(TType value) noexcept : m_bits{to_stored(value)} {
+        }
+
+        /// @brief Returns the value, in host byte order
+        /// @return The value
+        [[nodiscard]] constexpr auto get() const noexcept -> TType {
+            if constexpr(TOrder == ByteOrder::Native) {
+                return std::bit_cast<TType>(m_bits);
+            }
+            else {
+                return std::bit_cast<TType>(byteswap(m_bits));
+            }
+        }
+
+        /// @brief Stores `value`
+        /// @param value The value
+        constexpr auto set(TType value) noexcept -> void {
+            m_bits = to_stored(value);
+        }
+
+        // NOLINTNEXTLINE(google-explicit-constructor, hicpp-explicit-conversions)
+        [[nodiscard]] constexpr operator TType() const noexcept {
+            return get();
+        }
+
+        constexpr auto operator=(TType value) noexcept -> endian_value& {
+            set(value);
+            return *this;
+        }
+
+        /// @brief Compares the stored representations of two values
+        [[nodiscard]] friend constexpr auto
+        operator==(const endian_value& lhs, const endian_value& rhs) noexcept -> bool = default;
+
+      private:
+        detail::serialization::bits_t<TType> m_bits = 0;
+
+        [[nodiscard]] static constexpr auto to_stored(TType value) noexcept
+            -> detail::serialization::bits_t<TType> {
+            const auto bits = std::bit_cast<detail::serialization::bits_t<TType>>(value);
+            if constexpr(TOrder == ByteOrder::Native) {
+                return bits;
+            }
+            else {
+                return byteswap(bits);
+            }
+        }
+    };
+
+    /// @brief A little-endian number
+    /// @ingroup serialization
+    /// @headerfile hyperion/platform/serialization.h
+    template<WireNumber TType>
+    using little_endian = endian_value<TType, ByteOrder::Little>;
+
+    /// @brief A big-endian number
+    /// @ingroup serialization
+    /// @headerfile hyperion/platform/serialization.h
+    template<WireNumber TType>
+    using big_endian = endian_value<TType, ByteOrder::Big>;
+
+    using le_u16 = little_endian<u16>;
+    using le_u32 = little_endian<u32>;
+    using le_u64 = little_endian<u64>;
+    using le_i16 = little_endian<i16>;
+    using le_i32 = little_endian<i32>;
+    using le_i64 = little_endian<i64>;
+    using le_f32 = little_endian<f32>;
+    using le_f64 = little_endian<f64>;
+    using be_u16 = big_endian<u16>;
+    using be_u32 = big_endian<u32>;
+    using be_u64 = big_endian<u64>;
+    using be_i16 = big_endian<i16>;
+    using be_i32 = big_endian<i32>;
+    using be_i64 = big_endian<i64>;
+    using be_f32 = big_endian<f32>;
+    using be_f64 = big_endian<f64>;
+
+    /// @brief Returns the bytes of `value`, which are its serialized form
+    /// @tparam TType The type of the value
+    /// @param value The value
+    /// @return The bytes of `value`
+    /// @ingroup serialization
+    /// @headerfile hyperion/platform/serialization.h
+    template<WireLayout TType>
+    [[nodiscard]] inline auto
+    object_bytes(const TType& value) noexcept -> std::span<const std::byte, sizeof(TType)> {
+        return std::as_bytes(std::span<const TType, 1>{&value, 1_usize});
+    }
+
+    /// @brief Views the start of `bytes` as a `TType`, without copying it.
+    ///
+    /// The returned object aliases `bytes`, which must outlive it.
+    /// @tparam TType The type to view the bytes as
+    /// @param bytes The bytes to view
+    /// @return A pointer to the viewed object, or the reason `bytes` cannot be viewed
+    /// @ingroup serialization
+    /// @headerfile hyperion/platform/serialization.h
+    template<WireLayout TType>
+    [[nodiscard]] inline auto view_as(std::span<const std::byte> bytes) noexcept
+        -> expected<const TType*, SerializationError> {
+        if(bytes.size() < sizeof(TType)) {
+            return unexpected{SerializationError::TooSmall};
+        }
+        if(!detail::serialization::is_aligned(bytes.data(), alignof(TType))) {
+            return unexpected{SerializationError::Misaligned};
+        }
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        return reinterpret_cast<const TType*>(bytes.data());
+    }
+
+    /// @brief Views the start of `bytes` as a mutable `TType`, without copying it, so that a
+    /// message can be written directly into an output buffer.
+    ///
+    /// The returned object aliases `bytes`, which must outlive it.
+    /// @tparam TType The type to view the bytes as
+    /// @param bytes The bytes to view
+    /// @return A pointer to the viewed object, or the reason `bytes` cannot be viewed
+    /// @ingroup serialization
+    /// @headerfile hyperion/platform/serialization.h
+    template<WireLayout TType>
+    [[nodiscard]] inline auto view_as_mutable(std::span<std::byte> bytes) noexcept
+        -> expected<TType*, SerializationError> {
+        if(bytes.size() < sizeof(TType)) {
+            return unexpected{SerializationError::TooSmall};
+        }
+        if(!detail::serialization::is_aligned(bytes.data(), alignof(TType))) {
+            return unexpected{SerializationError::Misaligned};
+        }
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        return reinterpret_cast<TType*>(bytes.data());
+    }
+
+    /// @brief Views all of `bytes` as an array of `TType`, without copying it.
+    ///
+    /// The returned span aliases `bytes`, which must outlive it.
+    /// @tparam TType The element type to view the bytes as
+    /// @param bytes The bytes to view
+    /// @return The viewed elements, or the reason `bytes` cannot be viewed
+    /// @ingroup serialization
+    /// @headerfile hyperion/platform/serialization.h
+    template<WireLayout TType>
+    [[nodiscard]] inline auto view_array(std::span<const std::byte> bytes) noexcept
+        -> expected<std::span<const TType>, SerializationError> {
+        if(bytes.size() % sizeof(TType) != 0_usize) {
+            return unexpected{SerializationError::SizeMismatch};
+        }
+        if(!detail::serialization::is_aligned(bytes.data(), alignof(TType))) {
+            return unexpected{SerializationError::Misaligned};
+        }
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        return std::span<const TType>{reinterpret_cast<const TType*>(bytes.data()),
+                                      bytes.size() / sizeof(TType)};
+    }
+
+    /// @brief Converts `values` between host byte order and `TOrder` in place. This does
+    /// nothing when `TOrder` is the host's byte order
+    /// @tparam TOrder The byte order to convert to or from
+    /// @tparam TType The type of the values
+    /// @param values The values to convert
+    /// @ingroup serialization
+    /// @headerfile hyperion/platform/serialization.h
+    template<ByteOrder TOrder, WireNumber TType>
+    inline auto convert_byte_order(std::span<TType> values) noexcept -> void {
+        if constexpr(TOrder != ByteOrder::Native) {
+            detail::serialization::swap_elements<sizeof(TType)>(
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+                reinterpret_cast<std::byte*>(values.data()),
+                values.size());
+        }
+    }
+
+    /// @brief Writes `values` to `bytes` in `TOrder` byte order
+    ///
+    /// # Requirements
+    /// - `bytes.size()` must be at least `values.size_bytes()`
+    ///
+    /// @tparam TOrder The byte order to write
+    /// @tparam TType The type of the values
+    /// @param values The values to write
+    /// @param bytes The buffer to write to, which need not be aligned
+    /// @return The number of bytes written
+    /// @ingroup serialization
+    /// @headerfile hyperion/platform/serialization.h
+    template<ByteOrder TOrder, WireNumber TType>
+    inline auto encode(std::span<const TType> values, std::span<std::byte> bytes) noexcept
+        -> usize {
+        HYPERION_ASSERT(bytes.size() >= values.size_bytes(),
+                        "encode requires room for every value");
+
+        if(values.empty()) {
+            return 0_usize;
+        }
+        std::memcpy(bytes.data(), values.data(), values.size_bytes());
+        if constexpr(TOrder != ByteOrder::Native) {
+            detail::serialization::swap_elements<sizeof(TType)>(bytes.data(), values.size());
+        }
+        return values.size_bytes();
+    }
+
+    /// @brief Reads `values.size()` values in `TOrder` byte order from `bytes`
+    ///
+    /// # Requirements
+    /// - `bytes.size()` must be at least `values.size_bytes()`
+    ///
+    /// @tparam TOrder The byte order to read
+    /// @tparam TType The type of the values
+    /// @param bytes The buffer to read from, which need not be aligned
+    /// @param values The values to read into
+    /// @return The number of bytes read
+    /// @ingroup serialization
+    /// @headerfile hyperion/platform/serialization.h
+    template<ByteOrder TOrder, WireNumber TType>
+    inline auto decode(std::span<const std::byte> bytes, std::span<TType> values) noexcept
+        -> usize {
+        HYPERION_ASSERT(bytes.size() >= values.size_bytes(),
+                        "decode requires a value for every element");
+
+        if(values.empty()) {
+            return 0_usize;
+        }
+        std::memcpy(values.data(), bytes.data(), values.size_bytes());
+        convert_byte_order<TOrder>(values);
+        return values.size_bytes();
+    }
+
+} // namespace hyperion
+
+#if defined(HYPERION_ENABLE_TESTING) && HYPERION_ENABLE_TESTING
+
+    #include <boost/ut.hpp>
+
+    #include <vector>
+
+namespace hyperion::_test::platform::serialization {
+
+    struct header {
+        hyperion::le_u32 magic;
+        hyperion::be_u16 port;
+        hyperion::le_u16 flags;
+        hyperion::le_f64 value;
+        hyperion::be_i64 offset;
+    };
+
+    struct padded {
+        u8 small;
+        u32 large;
+    };
+
+    static_assert(hyperion::WireLayout<header>);
+    static_assert(!hyperion::WireLayout<padded>);
+    static_assert(!hyperion::WireLayout<f64>);
+    static_assert(sizeof(header) == 24_usize && alignof(header) == 8_usize);
+    static_assert(hyperion::byteswap(0x0102'0304_u32) == 0x0403'0201_u32);
+    static_assert(hyperion::byteswap(static_cast<i16>(0x0102)) == static_cast<i16>(0x0201));
+    static_assert(hyperion::be_u32{7_u32}.get() == 7_u32);
+    static_assert(hyperion::le_f32{1.5F}.get() == 1.5F);
+
+    // NOLINTNEXTLINE(google-build-using-namespace)
+    using namespace boost::ut;
+
+    // NOLINTNEXTLINE(cert-err58-cpp)
+    static const suite<"hyperion::platform::serialization"> serialization_tests = [] {
+        "wire_layout"_test = [] {
+            const auto message = header{.magic = 0x0102'0304_u32,
+                                        .port = static_cast<u16>(0x1234),
+                                        .flags = static_cast<u16>(1),
+                                        .value = -2.5,
+                                        .offset = -2_i64};
+            const auto bytes = hyperion::object_bytes(message);
+            expect(bytes[0] == std::byte{0x04} && bytes[3] == std::byte{0x01});
+            expect(bytes[4] == std::byte{0x12} && bytes[5] == std::byte{0x34});
+            expect(bytes[6] == std::byte{0x01} && bytes[7] == std::byte{0x00});
+            expect(bytes[16] == std::byte{0xFF} && bytes[23] == std::byte{0xFE});
+
+            // receive into a suitably aligned buffer
+            alignas(8) auto buffer = std::array<std::byte, 32>{};
+            std::memcpy(buffer.data(), bytes.data(), bytes.size());
+            const auto view = hyperion::view_as<header>(std::span<const std::byte>{buffer});
+            expect(view.has_value());
+            expect(that % view.value()->port.get() == static_cast<u16>(0x1234));
+            expect(that % view.value()->value.get() == -2.5);
+            expect(that % view.value()->offset.get() == -2_i64);
+            expect(std::memcmp(view.value(), &message, sizeof(header)) == 0);
+
+            auto output = hyperion::view_as_mutable<header>(std::span{buffer});
+            expect(output.has_value());
+            output.value()->flags = static_cast<u16>(0x0203);
+            expect(buffer[6] == std::byte{0x03} && buffer[7] == std::byte{0x02});
+        };
+
+        "view_errors"_test = [] {
+            alignas(8) auto buffer = std::array<std::byte, 32>{};
+            const auto all = std::span<const std::byte>{buffer};
+            expect(hyperion::view_as<header>(all.first(16)).error()
+                   == hyperion::SerializationError::TooSmall);
+            expect(hyperion::view_as<header>(all.subspan(4)).error()
+                   == hyperion::SerializationError::Misaligned);
+            expect(hyperion::view_array<hyperion::le_u32>(all.first(10)).error()
+                   == hyperion::SerializationError::SizeMismatch);
+            expect(hyperion::view_array<hyperion::le_u32>(all.subspan(2, 8)).error()
+                   == hyperion::SerializationError::Misaligned);
+
+            const auto words = hyperion::view_array<hyperion::le_u32>(all.subspan(4));
+            expect(words.has_value());
+            expect(that % words.value().size() == 7_usize);
+        };
+
+        "bulk_encode_decode"_test = [] {
+            auto values = std::vector<u32>{};
+            for(auto index = 0_u32; index < 37_u32; ++index) {
+                values.push_back(0x0102'0304_u32 + index);
+            }
+
+            auto bytes = std::vector<std::byte>(values.size() * sizeof(u32) + 1_usize);
+            const auto unaligned = std::span{bytes}.subspan(1);
+            const auto written
+                = hyperion::encode<hyperion::ByteOrder::Big>(std::span<const u32>{values},
+                                                             unaligned);
+            expect(that % written == values.size() * sizeof(u32));
+            expect(unaligned[0] == std::byte{0x01} && unaligned[3] == std::byte{0x04});
+            expect(unaligned[144] == std::byte{0x01} && unaligned[147] == std::byte{0x28});
+
+            auto decoded = std::vector<u32>(values.size());
+            const auto read
+                = hyperion::decode<hyperion::ByteOrder::Big>(std::span<const std::byte>{unaligned},
+                                                             std::span{decoded});
+            expect(that % read == written);
+            expect(decoded == values);
+
+            auto doubles = std::vector<f64>{1.0, -0.5, 3.25, 1e300, -1e-300, 7.0, 8.0};
+            auto converted = doubles;
+            hyperion::convert_byte_order<hyperion::ByteOrder::Big>(std::span{converted});
+            expect(that % hyperion::big_endian<f64>{1.0}
+                   == std::bit_cast<hyperion::big_endian<f64>>(converted[0]));
+            hyperion::convert_byte_order<hyperion::ByteOrder::Big>(std::span{converted});
+            expect(converted == doubles);
+
+            auto shorts = std::vector<i16>{1, -2, 300};
+            hyperion::convert_byte_order<hyperion::ByteOrder::Little>(std::span{shorts});
+            expect(shorts == std::vector<i16>{1, -2, 300});
+        };
+    };
+
+} // namespace hyperion::_test::platform::serialization
+
+#endif // defined(HYPERION_ENABLE_TESTING) && HYPERION_ENABLE_TESTING
+
+#endif // HYPERION_PLATFORM_SERIALIZATION_H
@@ -0,0 +1,813 @@
+/// @file sketch.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Mergeable probabilistic sketches for cardinality and frequency estimation
+/// @version 0.4.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2024 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef HYPERION_PLATFORM_SKETCH_H
+#define HYPERION_PLATFORM_SKETCH_H
+
+#include <hyperion/platform.h>
+#include <hyperion/platform/assert.h>
+#include <hyperion/platform/cpu.h>
+#include <hyperion/platform/hash.h>
+#include <hyperion/platform/types.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <numbers>
+#include <span>
+#include <vector>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+    #include <immintrin.h>
+#endif // defined(__AVX2__) || defined(__SSE2__)
+
+/// @ingroup platform
+/// @{
+///	@defgroup sketch Probabilistic Sketches
+/// Hyperion provides fixed-size sketches that summarize a stream of 64-bit keys in kilobytes,
+/// where exact answers would need memory proportional to the number of distinct keys. Sketches
+/// with the same parameters can be merged, so a stream can be summarized in pieces (per thread,
+/// per shard) and combined centrally; merging is equivalent to having sketched the
+/// concatenated streams.
+///
+/// - `hyperion::hyperloglog` estimates the number of distinct keys. With precision `p` it uses
+/// `2^p` one-byte registers and has a relative standard error of about `1.04 / sqrt(2^p)`
+/// (0.8% at the default precision of 14). Small sketches start in a sparse representation
+/// and switch to dense registers once that becomes smaller.
+/// - `hyperion::count_min_sketch` estimates how many times each key occurred. Estimates never
+/// undercount, and overcount by at most `epsilon * total` with probability `1 - delta`.
+/// - `hyperion::count_sketch` also estimates frequencies, with signed counters whose errors
+/// cancel out on average, trading the one-sided guarantee for unbiased estimates.
+///
+/// Merges run over the register or counter arrays with AVX2 or SSE2 when available. Bulk
+/// updates over spans of keys are provided; for the frequency sketches these hash a batch of
+/// keys and prefetch the counters they will touch before updating them.
+///
+/// Keys are mixed with `hyperion::hash_mix`, so small integers can be used directly. Other data
+/// should first be hashed, e.g. with `hyperion::hash_string`.
+///
+/// # Example
+/// @code {.cpp}
+/// auto distinct_users = hyperion::hyperloglog{};
+/// auto requests_per_user = hyperion::count_min_sketch::from_error_bounds(0.001, 0.01);
+/// for(const auto user : shard_user_ids) {
+///     distinct_users.insert(user);
+///     requests_per_user.increment(user);
+/// }
+///
+/// central_users.merge(distinct_users);
+/// central_requests.merge(requests_per_user);
+/// const auto users = central_users.estimate();
+/// @endcode
+/// @headerfile hyperion/platform/sketch.h
+/// @}
+
+namespace hyperion {
+
+    namespace detail::sketch {
+
+        /// @brief The number of keys hashed and prefetched together by the bulk operations
+        static constexpr auto k_batch_size = 16_usize;
+
+        /// @brief Sets each element of `into` to the maximum of itself and the corresponding
+        /// element of `from`
+        inline auto max_bytes(std::span<u8> into, std::span<const u8> from) noexcept -> void {
+            HYPERION_DEBUG_ASSERT(into.size() == from.size(), "spans must be the same size");
+
+            auto index = 0_usize;
+            // NOLINTBEGIN(*-pro-type-reinterpret-cast, *-pro-bounds-pointer-arithmetic)
+#if defined(__AVX2__)
+            for(; index + sizeof(__m256i) <= into.size(); index += sizeof(__m256i)) {
+                auto* target = reinterpret_cast<__m256i*>(into.data() + index);
+                const auto* source = reinterpret_cast<const __m256i*>(from.data() + index);
+                _mm256_storeu_si256(target,
+                                    _mm256_max_epu8(_mm256_loadu_si256(target),
+                                                    _mm256_loadu_si256(source)));
+            }
+#elif defined(__SSE2__)
+            for(; index + sizeof(__m128i) <= into.size(); index += sizeof(__m128i)) {
+                auto* target = reinterpret_cast<__m128i*>(into.data() + index);
+                const auto* source = reinterpret_cast<const __m128i*>(from.data() + index);
+                _mm_storeu_si128(target,
+                                 _mm_max_epu8(_mm_loadu_si128(target), _mm_loadu_si128(source)));
+            }
+#endif // defined(__AVX2__)
+            // NOLINTEND(*-pro-type-reinterpret-cast, *-pro-bounds-pointer-arithmetic)
+
+            for(; index < into.size(); ++index) {
+                into[index] = std::max(into[index], from[index]);
+            }
+        }
+
+        /// @brief Adds each element of `from` to the corresponding element of `into`, wrapping
+        /// on overflow
+        template<typename TCounter>
+            requires std::same_as<TCounter, u64> || std::same_as<TCounter, i64>
+        inline auto
+        add_counters(std::span<TCounter> into, std::span<const TCounter> from) noexcept -> void {
+            HYPERION_DEBUG_ASSERT(into.size() == from.size(), "spans must be the same size");
+
+            auto index = 0_usize;
+            // NOLINTBEGIN(*-pro-type-reinterpret-cast, *-pro-bounds-pointer-arithmetic)
+#if defined(__AVX2__)
+            constexpr auto lanes = sizeof(__m256i) / sizeof(TCounter);
+            for(; index + lanes <= into.size(); index += lanes) {
+                auto* target = reinterpret_cast<__m256i*>(into.data() + index);
+                const auto* source = reinterpret_cast<const __m256i*>(from.data() + index);
+                _mm256_storeu_si256(target,
+                                    _mm256_add_epi64(_mm256_loadu_si256(target),
+                                                     _mm256_loadu_si256(source)));
+            }
+#elif defined(__SSE2__)
+            constexpr auto lanes = sizeof(__m128i) / sizeof(TCounter);
+            for(; index + lanes <= into.size(); index += lanes) {
+                auto* target = reinterpret_cast<__m128i*>(into.data() + index);
+                const auto* source = reinterpret_cast<const __m128i*>(from.data() + index);
+                _mm_storeu_si128(target,
+                                 _mm_add_epi64(_mm_loadu_si128(target), _mm_loadu_si128(source)));
+            }
+#endif // defined(__AVX2__)
+            // NOLINTEND(*-pro-type-reinterpret-cast, *-pro-bounds-pointer-arithmetic)
+
+            for(; index < into.size(); ++index) {
+                into[index] = static_cast<TCounter>(static_cast<u64>(into[index])
+                                                    + static_cast<u64>(from[index]));
+            }
+        }
+
+        static constexpr auto k_min_precision = 4_u32;
+        static constexpr auto k_max_precision = 18_u32;
+
+        /// @brief `2^-rank` for every possible register value
+        static constexpr auto k_inverse_powers = [] {
+            auto powers = std::array<f64, 65>{};
+            auto power = 1.0;
+            for(auto& value : powers) {
+                value = power;
+                power /= 2.0;
+            }
+            return powers;
+        }();
+
+        /// @brief Sparse HyperLogLog entries hold the register index in the upper 24 bits and
+        /// the rank in the lower 8, so sorting them orders by index
+        [[nodiscard]] constexpr auto sparse_entry(u32 index, u8 rank) noexcept -> u32 {
+            return (index << 8U) | static_cast<u32>(rank);
+        }
+
+        [[nodiscard]] constexpr auto sparse_index(u32 entry) noexcept -> u32 {
+            return entry >> 8U;
+        }
+
+        [[nodiscard]] constexpr auto sparse_rank(u32 entry) noexcept -> u8 {
+            return static_cast<u8>(entry & 0xFFU);
+        }
+
+        static constexpr auto k_max_depth = 16_usize;
+
+        /// @brief Returns the column of `row` that a key with the given hash maps to, deriving
+        /// an independent hash per row from two halves of `hash`
+        [[nodiscard]] constexpr auto
+        column(u64 hash, usize row, usize width_mask) noexcept -> usize {
+            const auto first = hash;
+            const auto second = std::rotl(hash, 32) | 1_u64;
+            return static_cast<usize>(first + static_cast<u64>(row) * second) & width_mask;
+        }
+    } // namespace detail::sketch
+
+    /// @brief Estimates the number of distinct keys in a stream.
+    ///
+    /// Each key's hash selects one of `2^precision` registers, which records the longest run of
+    /// leading zeros seen among the remaining hash bits. The harmonic mean of the registers
+    /// then estimates the cardinality, with linear counting used for small cardinalities.
+    ///
+    /// While few registers are set, the sketch stores only the set registers, as a sorted list
+    /// of four-byte entries. Once that list would exceed a quarter of the dense size the
+    /// sketch converts to a dense array of one-byte registers.
+    ///
+    /// @ingroup sketch
+    /// @headerfile hyperion/platform/sketch.h
+    class hyperloglog {
+      public:
+        /// @brief Constructs an empty sketch
+        ///
+        /// # Requirements
+        /// - `precision` must be in `[4, 18]`
+        ///
+        /// @param precision The base-2 logarithm of the number of registers
+        explicit hyperloglog(u32 precision = 14_u32) noexcept : m_precision(precision) {
+            HYPERION_ASSERT(precision >= detail::sketch::k_min_precision
+                                && precision <= detail::sketch::k_max_precision,
+                            "hyperloglog precision must be in [4, 18]");
+        }
+
+        /// @brief Adds `key` to the sketch
+        /// @param key The key to add
+        auto insert(u64 key) -> void {
+            const auto hash = hash_mix(key);
+            const auto index = static_cast<u32>(hash >> (64_u32 - m_precision));
+            // a sentinel bit bounds the rank by the number of hash bits that remain
+            const auto remaining = (hash << m_precision) | (1_u64 << (m_precision - 1_u32));
+            const auto rank = static_cast<u8>(std::countl_zero(remaining) + 1);
+            update(index, rank);
+        }
+
+        /// @brief Adds every key in `keys` to the sketch
+        /// @param keys The keys to add
+        auto insert(std::span<const u64> keys) -> void {
+            for(const auto key : keys) {
+                insert(key);
+            }
+        }
+
+        /// @brief Merges `other` into this sketch, so that it estimates the cardinality of the
+        /// union of both streams.
+        ///
+        /// # Requirements
+        /// - `other` must have the same precision as this sketch
+        ///
+        /// @param other The sketch to merge
+        auto merge(const hyperloglog& other) -> void {
+            HYPERION_ASSERT(other.m_precision == m_precision,
+                            "only hyperloglog sketches with the same precision can be merged");
+
+            if(other.is_sparse()) {
+                for(const auto entry : other.m_sparse) {
+                    update(detail::sketch::sparse_index(entry),
+                           detail::sketch::sparse_rank(entry));
+                }
+                return;
+            }
+
+            if(is_sparse()) {
+                densify();
+            }
+            detail::sketch::max_bytes(m_registers, other.m_registers);
+        }
+
+        /// @brief Returns the estimated number of distinct keys added to the sketch
+        /// @return The estimated cardinality
+        [[nodiscard]] auto estimate() const noexcept -> f64 {
+            const auto count = register_count();
+            auto sum = 0.0;
+            auto zeros = 0_usize;
+            if(is_sparse()) {
+                zeros = count - m_sparse.size();
+                sum = static_cast<f64>(zeros);
+                for(const auto entry : m_sparse) {
+                    sum += detail::sketch::k_inverse_powers[detail::sketch::sparse_rank(entry)];
+                }
+            }
+            else {
+                for(const auto rank : m_registers) {
+                    sum += detail::sketch::k_inverse_powers[rank];
+                    zeros += static_cast<usize>(rank == 0U);
+                }
+            }
+
+            const auto registers = static_cast<f64>(count);
+            const auto alpha = [count, registers] {
+                switch(count) {
+                    case 16: return 0.673;
+                    case 32: return 0.697;
+                    case 64: return 0.709;
+                    default: return 0.7213 / (1.0 + 1.079 / registers);
+                }
+            }();
+
+            const auto raw = alpha * registers * registers / sum;
+            if(raw <= 2.5 * registers && zeros != 0_usize) {
+                return registers * std::log(registers / static_cast<f64>(zeros));
+            }
+            return raw;
+        }
+
+        /// @brief Removes every key from the sketch, returning it to the sparse representation
+        auto clear() noexcept -> void {
+            m_sparse.clear();
+            m_registers.clear();
+            m_registers.shrink_to_fit();
+        }
+
+        /// @brief Returns the precision of the sketch
+        /// @return The base-2 logarithm of the number of registers
+        [[nodiscard]] auto precision() const noexcept -> u32 {
+            return m_precision;
+        }
+
+        /// @brief Returns whether the sketch is using the sparse representation
+        /// @return Whether the sketch is sparse
+        [[nodiscard]] auto is_sparse() const noexcept -> bool {
+            return m_registers.empty();
+        }
+
+        /// @brief Returns the number of bytes used by the sketch's registers
+        /// @return The size of the sketch
+        [[nodiscard]] auto size_in_bytes() const noexcept -> usize {
+            return is_sparse() ? m_sparse.size() * sizeof(u32) : m_registers.size();
+        }
+
+      private:
+        std::vector<u32> m_sparse;
+        std::vector<u8> m_registers;
+        u32 m_precision;
+
+        [[nodiscard]] auto register_count() const noexcept -> usize {
+            return 1_usize << m_precision;
+        }
+
+        auto update(u32 index, u8 rank) -> void {
+            if(!is_sparse()) {
+                auto& current = m_registers[index];
+                current = std::max(current, rank);
+                return;
+            }
+
+            const auto entry = detail::sketch::sparse_entry(index, rank);
+            const auto position = std::lower_bound(m_sparse.begin(),
+                                                   m_sparse.end(),
+                                                   detail::sketch::sparse_entry(index, 0));
+            if(position != m_sparse.end() && detail::sketch::sparse_index(*position) == index) {
+                *position = std::max(*position, entry);
+                return;
+            }
+
+            m_sparse.insert(position, entry);
+            if(m_sparse.size() * sizeof(u32) > register_count() / 4_usize) {
+                densify();
+            }
+        }
+
+        auto densify() -> void {
+            m_registers.assign(register_count(), 0U);
+            for(const auto entry : m_sparse) {
+                m_registers[detail::sketch::sparse_index(entry)]
+                    = detail::sketch::sparse_rank(entry);
+            }
+            m_sparse.clear();
+            m_sparse.shrink_to_fit();
+        }
+    };
+
+    /// @brief Estimates the frequency of keys in a stream, never undercounting.
+    ///
+    /// The sketch is a `depth` by `width` matrix of counters. Incrementing a key adds to one
+    /// counter in every row, chosen by an independent hash per row, and the estimate for a key
+    /// is the minimum of its counters. Collisions can only inflate a counter, so the estimate is
+    /// at least the true count.
+    ///
+    /// @ingroup sketch
+    /// @headerfile hyperion/platform/sketch.h
+    class count_min_sketch {
+      public:
+        /// @brief Constructs an empty sketch with the given dimensions
+        ///
+        /// # Requirements
+        /// - `width` must be non-zero
+        /// - `depth` must be in `[1, 16]`
+        ///
+        /// @param width The number of counters per row, rounded up to a power of two
+        /// @param depth The number of rows
+        count_min_sketch(usize width, usize depth)
+            : m_width(std::bit_ceil(width)),
+              m_depth(depth),
+              m_counters(m_width * m_depth) {
+            HYPERION_ASSERT(width != 0_usize, "count_min_sketch width must be non-zero");
+            HYPERION_ASSERT(depth != 0_usize && depth <= detail::sketch::k_max_depth,
+                            "count_min_sketch depth must be in [1, 16]");
+        }
+
+        /// @brief Constructs an empty sketch whose estimates exceed the true count by at most
+        /// `epsilon` times the total of all increments, with probability at least `1 - delta`.
+        ///
+        /// # Requirements
+        /// - `epsilon` must be in `(0, 1)`
+        /// - `delta` must be in `(e^-16, 1)`
+        ///
+        /// @param epsilon The error bound, relative to the total count
+        /// @param delta The probability that an estimate exceeds the error bound
+        /// @return The sketch
+        [[nodiscard]] static auto
+        from_error_bounds(f64 epsilon, f64 delta) -> count_min_sketch {
+            HYPERION_ASSERT(epsilon > 0.0 && epsilon < 1.0, "epsilon must be in (0, 1)");
+            HYPERION_ASSERT(delta > 0.0 && delta < 1.0, "delta must be in (0, 1)");
+
+            const auto width = static_cast<usize>(std::ceil(std::numbers::e / epsilon));
+            const auto depth = static_cast<usize>(std::ceil(std::log(1.0 / delta)));
+            return {width, std::max(depth, 1_usize)};
+        }
+
+        /// @brief Adds `count` occurrences of `key`
+        /// @param key The key to count
+        /// @param count The number of occurrences to add
+        auto increment(u64 key, u64 count = 1_u64) noexcept -> void {
+            const auto hash = hash_mix(key);
+            for(auto row = 0_usize; row < m_depth; ++row) {
+                m_counters[cell(hash, row)] += count;
+            }
+            m_total += count;
+        }
+
+        /// @brief Adds one occurrence of every key in `keys`.
+        ///
+        /// Keys are processed in batches, prefetching the counters of each batch before
+        /// updating them.
+        /// @param keys The keys to count
+        auto increment(std::span<const u64> keys) noexcept -> void {
+            auto hashes = std::array<u64, detail::sketch::k_batch_size>{};
+            for(auto base = 0_usize; base < keys.size(); base += detail::sketch::k_batch_size) {
+                const auto count = std::min(detail::sketch::k_batch_size, keys.size() - base);
+                for(auto index = 0_usize; index < count; ++index) {
+                    const auto hash = hash_mix(keys[base + index]);
+                    // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                    hashes[index] = hash;
+                    for(auto row = 0_usize; row < m_depth; ++row) {
+                        platform::prefetch_write(&m_counters[cell(hash, row)]);
+                    }
+                }
+                for(auto index = 0_usize; index < count; ++index) {
+                    for(auto row = 0_usize; row < m_depth; ++row) {
+                        // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                        ++m_counters[cell(hashes[index], row)];
+                    }
+                }
+            }
+            m_total += static_cast<u64>(keys.size());
+        }
+
+        /// @brief Returns the estimated number of occurrences of `key`
+        /// @param key The key to estimate
+        /// @return The estimated count, which is never less than the true count
+        [[nodiscard]] auto estimate(u64 key) const noexcept -> u64 {
+            const auto hash = hash_mix(key);
+            auto minimum = std::numeric_limits<u64>::max();
+            for(auto row = 0_usize; row < m_depth; ++row) {
+                minimum = std::min(minimum, m_counters[cell(hash, row)]);
+            }
+            return minimum;
+        }
+
+        /// @brief Merges `other` into this sketch, so that it summarizes both streams.
+        ///
+        /// # Requirements
+        /// - `other` must have the same width and depth as this sketch
+        ///
+        /// @param other The sketch to merge
+        auto merge(const count_min_sketch& other) noexcept -> void {
+            HYPERION_ASSERT(other.m_width == m_width && other.m_depth == m_depth,
+                            "only count_min_sketches with the same dimensions can be merged");
+
+            detail::sketch::add_counters(std::span{m_counters},
+                                         std::span<const u64>{other.m_counters});
+            m_total += other.m_total;
+        }
+
+        /// @brief Resets every counter to zero
+        auto clear() noexcept -> void {
+            std::fill(m_counters.begin(), m_counters.end(), 0_u64);
+            m_total = 0_u64;
+        }
+
+        /// @brief Returns the total of all increments
+        /// @return The total count
+        [[nodiscard]] auto total() const noexcept -> u64 {
+            return m_total;
+        }
+
+        /// @brief Returns the number of counters per row
+        /// @return The width of the sketch
+        [[nodiscard]] auto width() const noexcept -> usize {
+            return m_width;
+        }
+
+        /// @brief Returns the number of rows
+        /// @return The depth of the sketch
+        [[nodiscard]] auto depth() const noexcept -> usize {
+            return m_depth;
+        }
+
+      private:
+        usize m_width;
+        usize m_depth;
+        u64 m_total = 0_u64;
+        std::vector<u64> m_counters;
+
+        [[nodiscard]] auto cell(u64 hash, usize row) const noexcept -> usize {
+            return row * m_width + detail::sketch::column(hash, row, m_width - 1_usize);
+        }
+    };
+
+    /// @brief Estimates the frequency of keys in a stream with unbiased, signed counters.
+    ///
+    /// Like `count_min_sketch`, every row has one counter per column chosen by a per-row hash,
+    /// but each key also has a per-row sign, and increments add the count times that sign.
+    /// Colliding keys then cancel out on average, and the estimate for a key is the median of
+    /// its signed counters. An odd depth gives a well-defined median.
+    ///
+    /// @ingroup sketch
+    /// @headerfile hyperion/platform/sketch.h
+    class count_sketch {
+      public:
+        /// @brief Constructs an empty sketch with the given dimensions
+        ///
+        /// # Requirements
+        /// - `width` must be non-zero
+        /// - `depth` must be in `[1, 16]`
+        ///
+        /// @param width The number of counters per row, rounded up to a power of two
+        /// @param depth The number of rows
+        count_sketch(usize width, usize depth)
+            : m_width(std::bit_ceil(width)),
+              m_depth(depth),
+              m_counters(m_width * m_depth) {
+            HYPERION_ASSERT(width != 0_usize, "count_sketch width must be non-zero");
+            HYPERION_ASSERT(depth != 0_usize && depth <= detail::sketch::k_max_depth,
+                            "count_sketch depth must be in [1, 16]");
+        }
+
+        /// @brief Adds `count` occurrences of `key`
+        /// @param key The key to count
+        /// @param count The number of occurrences to add, which may be negative
+        auto increment(u64 key, i64 count = 1_i64) noexcept -> void {
+            const auto hash = hash_mix(key);
+            const auto signs = sign_bits(hash);
+            for(auto row = 0_usize; row < m_depth; ++row) {
+                m_counters[cell(hash, row)] += signed_count(signs, row, count);
+            }
+        }
+
+        /// @brief Adds one occurrence of every key in `keys`.
+        ///
+        /// Keys are processed in batches, prefetching the counters of each batch before
+        /// updating them.
+        /// @param keys The keys to count
+        auto increment(std::span<const u64> keys) noexcept -> void {
+            auto hashes = std::array<u64, detail::sketch::k_batch_size>{};
+            for(auto base = 0_usize; base < keys.size(); base += detail::sketch::k_batch_size) {
+                const auto count = std::min(detail::sketch::k_batch_size, keys.size() - base);
+                for(auto index = 0_usize; index < count; ++index) {
+                    const auto hash = hash_mix(keys[base + index]);
+                    // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                    hashes[index] = hash;
+                    for(auto row = 0_usize; row < m_depth; ++row) {
+                        platform::prefetch_write(&m_counters[cell(hash, row)]);
+                    }
+                }
+                for(auto index = 0_usize; index < count; ++index) {
+                    // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                    const auto hash = hashes[index];
+                    const auto signs = sign_bits(hash);
+                    for(auto row = 0_usize; row < m_depth; ++row) {
+                        m_counters[cell(hash, row)] += signed_count(signs, row, 1_i64);
+                    }
+                }
+            }
+        }
+
+        /// @brief Returns the estimated number of occurrences of `key`
+        /// @param key The key to estimate
+        /// @return The estimated count
+        [[nodiscard]] auto estimate(u64 key) const noexcept -> i64 {
+            const auto hash = hash_mix(key);
+            const auto signs = sign_bits(hash);
+            auto estimates = std::array<i64, detail::sketch::k_max_depth>{};
+            for(auto row = 0_usize; row < m_depth; ++row) {
+                // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                estimates[row] = signed_count(signs, row, m_counters[cell(hash, row)]);
+            }
+
+            const auto rows = std::span{estimates}.first(m_depth);
+            const auto middle = rows.begin() + static_cast<std::ptrdiff_t>(m_depth / 2_usize);
+            std::nth_element(rows.begin(), middle, rows.end());
+            if(m_depth % 2_usize != 0_usize) {
+                return *middle;
+            }
+
+            const auto lower = *std::max_element(rows.begin(), middle);
+            return lower + (*middle - lower) / 2_i64;
+        }
+
+        /// @brief Merges `other` into this sketch, so that it summarizes both streams.
+        ///
+        /// # Requirements
+        /// - `other` must have the same width and depth as this sketch
+        ///
+        /// @param other The sketch to merge
+        auto merge(const count_sketch& other) noexcept -> void {
+            HYPERION_ASSERT(other.m_width == m_width && other.m_depth == m_depth,
+                            "only count_sketches with the same dimensions can be merged");
+
+            detail::sketch::add_counters(std::span{m_counters},
+                                         std::span<const i64>{other.m_counters});
+        }
+
+        /// @brief Resets every counter to zero
+        auto clear() noexcept -> void {
+            std::fill(m_counters.begin(), m_counters.end(), 0_i64);
+        }
+
+        /// @brief Returns the number of counters per row
+        /// @return The width of the sketch
+        [[nodiscard]] auto width() const noexcept -> usize {
+            return m_width;
+        }
+
+        /// @brief Returns the number of rows
+        /// @return The depth of the sketch
+        [[nodiscard]] auto depth() const noexcept -> usize {
+            return m_depth;
+        }
+
+      private:
+        usize m_width;
+        usize m_depth;
+        std::vector<i64> m_counters;
+
+        [[nodiscard]] auto cell(u64 hash, usize row) const noexcept -> usize {
+            return row * m_width + detail::sketch::column(hash, row, m_width - 1_usize);
+        }
+
+        /// @brief Derives one sign bit per row, independent of the columns
+        [[nodiscard]] static auto sign_bits(u64 hash) noexcept -> u64 {
+            return hash_mix(hash ^ 0x9E3779B97F4A7C15_u64);
+        }
+
+        [[nodiscard]] static auto signed_count(u64 signs, usize row, i64 count) noexcept -> i64 {
+            return ((signs >> row) & 1_u64) != 0_u64 ? -count : count;
+        }
+    };
+
+} // namespace hyperion
+
+#if defined(HYPERION_ENABLE_TESTING) && HYPERION_ENABLE_TESTING
+
+    #include <boost/ut.hpp>
+
+    #include <random>
+
+namespace hyperion::_test::platform::sketch {
+
+    // NOLINTNEXTLINE(google-build-using-namespace)
+    using namespace boost::ut;
+
+    inline auto relative_error(f64 estimate, f64 actual) -> f64 {
+        return std::abs(estimate - actual) / actual;
+    }
+
+    // NOLINTNEXTLINE(cert-err58-cpp)
+    static const suite<"hyperion::platform::sketch"> sketch_tests = [] {
+        "hyperloglog_sparse_then_dense"_test = [] {
+            auto sketch = hyperion::hyperloglog{};
+            expect(that % sketch.estimate() == 0.0);
+
+            for(auto key = 0_u64; key < 100_u64; ++key) {
+                sketch.insert(key);
+                sketch.insert(key);
+            }
+            expect(sketch.is_sparse());
+            expect(that % relative_error(sketch.estimate(), 100.0) < 0.05);
+
+            for(auto key = 100_u64; key < 200'000_u64; ++key) {
+                sketch.insert(key);
+            }
+            expect(!sketch.is_sparse());
+            expect(that % sketch.size_in_bytes() == 16'384_usize);
+            expect(that % relative_error(sketch.estimate(), 200'000.0) < 0.03);
+
+            sketch.clear();
+            expect(sketch.is_sparse());
+            expect(that % sketch.estimate() == 0.0);
+        };
+
+        "hyperloglog_merge"_test = [] {
+            auto engine = std::mt19937_64{1U};
+            auto keys = std::vector<u64>(300'000);
+            for(auto& key : keys) {
+                key = static_cast<u64>(engine());
+            }
+
+            auto whole = hyperion::hyperloglog{12_u32};
+            auto first = hyperion::hyperloglog{12_u32};
+            auto second = hyperion::hyperloglog{12_u32};
+            auto small = hyperion::hyperloglog{12_u32};
+            whole.insert(std::span{keys});
+            first.insert(std::span{keys}.first(200'000));
+            second.insert(std::span{keys}.subspan(100'000));
+            small.insert(std::span{keys}.first(10));
+            expect(small.is_sparse());
+
+            // merging the two overlapping halves reproduces the registers of the whole stream
+            first.merge(second);
+            first.merge(small);
+            expect(that % first.estimate() == whole.estimate());
+            expect(that % relative_error(whole.estimate(), 300'000.0) < 0.05);
+
+            // merging dense into sparse converts the target
+            small.merge(whole);
+            expect(!small.is_sparse());
+            expect(that % small.estimate() == whole.estimate());
+        };
+
+        "count_min_sketch"_test = [] {
+            auto sketch = hyperion::count_min_sketch::from_error_bounds(0.001, 0.01);
+            expect(that % sketch.width() == 4096_usize);
+            expect(that % sketch.depth() == 5_usize);
+
+            // key k occurs k % 100 times
+            auto keys = std::vector<u64>{};
+            for(auto key = 0_u64; key < 20'000_u64; ++key) {
+                for(auto count = 0_u64; count < key % 100_u64; ++count) {
+                    keys.push_back(key);
+                }
+            }
+            sketch.increment(std::span{keys});
+            sketch.increment(7_u64, 1'000'000_u64);
+            expect(that % sketch.total() == keys.size() + 1'000'000_usize);
+
+            const auto bound = static_cast<u64>(0.001 * static_cast<f64>(sketch.total()));
+            auto within_bounds = true;
+            auto exceeded = 0_usize;
+            for(auto key = 0_u64; key < 20'000_u64; ++key) {
+                const auto actual = key % 100_u64 + (key == 7_u64 ? 1'000'000_u64 : 0_u64);
+                const auto estimate = sketch.estimate(key);
+                within_bounds = within_bounds && estimate >= actual;
+                exceeded += static_cast<usize>(estimate > actual + bound);
+            }
+            expect(within_bounds);
+            expect(that % exceeded < 200_usize);
+        };
+
+        "count_min_sketch_merge"_test = [] {
+            auto first = hyperion::count_min_sketch{1000_usize, 4_usize};
+            auto second = hyperion::count_min_sketch{1000_usize, 4_usize};
+            expect(that % first.width() == 1024_usize);
+            for(auto key = 0_u64; key < 100_u64; ++key) {
+                first.increment(key, key);
+                second.increment(key, 2_u64);
+            }
+            first.merge(second);
+            expect(that % first.total() == 4950_u64 + 200_u64);
+            auto exact = 0_usize;
+            for(auto key = 0_u64; key < 100_u64; ++key) {
+                exact += static_cast<usize>(first.estimate(key) == key + 2_u64);
+            }
+            expect(that % exact > 95_usize);
+        };
+
+        "count_sketch"_test = [] {
+            auto sketch = hyperion::count_sketch{2048_usize, 5_usize};
+            auto other = hyperion::count_sketch{2048_usize, 5_usize};
+            auto keys = std::vector<u64>{};
+            for(auto key = 0_u64; key < 5'000_u64; ++key) {
+                keys.push_back(key);
+            }
+            sketch.increment(std::span{keys});
+            other.increment(42_u64, 5'000_i64);
+            other.increment(43_u64, -3_i64);
+            sketch.merge(other);
+
+            expect(that % sketch.estimate(42_u64) == 5'001_i64);
+            auto close = 0_usize;
+            for(auto key = 100_u64; key < 1'100_u64; ++key) {
+                close += static_cast<usize>(std::abs(sketch.estimate(key) - 1_i64) <= 2_i64);
+            }
+            expect(that % close > 950_usize);
+
+            sketch.clear();
+            expect(that % sketch.estimate(42_u64) == 0_i64);
+        };
+    };
+
+} // namespace hyperion::_test::platform::sketch
+
+#endif // defined(HYPERION_ENABLE_TESTING) && HYPERION_ENABLE_TESTING
+
+#endif // HYPERION_PLATFORM_SKETCH_H
@@ -0,0 +1,534 @@
+/// @file slot_map.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief A densely stored container addressed by stable, generational handles
+/// @version 0.4.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2024 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef HYPERION_PLATFORM_SLOT_MAP_H
+#define HYPERION_PLATFORM_SLOT_MAP_H
+
+#include <hyperion/platform.h>
+#include <hyperion/platform/assert.h>
+#include <hyperion/platform/def.h>
+#include <hyperion/platform/types.h>
+
+#include <concepts>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/// @ingroup platform
+/// @{
+///	@defgroup slot_map Slot Map
+/// `hyperion::slot_map<T>` stores its elements contiguously and hands out stable
+/// `hyperion::slot_map_handle`s to them, with O(1) insertion, erasure and lookup.
+///
+/// Each handle packs a slot index and a generation into a single `u32` or `u64`. Erasing an
+/// element increments its slot's generation, so handles to erased elements are detected as
+/// stale rather than aliasing whatever later reuses the slot. Slots whose generation would wrap
+/// are retired instead of being reused, so a stale handle can never become valid again.
+///
+/// Elements are kept densely packed (erasure moves the last element into the hole), so
+/// iterating a `slot_map` is iterating a contiguous array of only live elements. This makes it a
+/// cache-friendly replacement for `std::unordered_map<id, T>`-style tables of entities or
+/// sessions.
+///
+/// # Example
+/// @code {.cpp}
+/// auto sessions = hyperion::slot_map<session>{};
+/// const auto handle = sessions.emplace(socket);
+///
+/// if(auto* found = sessions.get(handle)) {
+///     found->send(message);
+/// }
+///
+/// for(auto& live : sessions) {
+///     live.poll();
+/// }
+///
+/// sessions.erase(handle);
+/// @endcode
+/// @headerfile hyperion/platform/slot_map.h
+/// @}
+
+namespace hyperion {
+
+    /// @brief A handle to an element of a `slot_map`, packing a slot index and a generation into
+    /// a single `TWord`.
+    ///
+    /// `u32` handles use 20 bits for the index (allowing about one million elements) and 12 bits
+    /// for the generation. `u64` handles use 32 bits for each.
+    ///
+    /// @tparam TWord The handle representation. Either `u32` or `u64`
+    /// @ingroup slot_map
+    /// @headerfile hyperion/platform/slot_map.h
+    template<typename TWord = u32>
+        requires std::same_as<TWord, u32> || std::same_as<TWord, u64>
+    class slot_map_handle {
+      public:
+        /// @brief The handle representation
+        using word_type = TWord;
+
+        /// @brief The number of bits used for the slot index
+        static constexpr auto index_bits = std::same_as<TWord, u32> ? 20_usize : 32_usize;
+        /// @brief The number of bits used for the generation
+        static constexpr auto generation_bits = sizeof(TWord) * 8_usize - index_bits;
+        /// @brief The largest valid slot index. Also bounds the number of elements
+        static constexpr auto max_index
+            = static_cast<TWord>((static_cast<TWord>(1) << index_bits) - 2U);
+        /// @brief The largest generation
+        static constexpr auto max_generation
+            = static_cast<TWord>((static_cast<TWord>(1) << generation_bits) - 1U);
+
+        /// @brief Constructs a null handle, which never refers to an element
+        constexpr slot_map_handle() noexcept = default;
+
+        /// @brief Constructs a handle from its slot index and generation
+        /// @param index The slot index
+        /// @param generation The generation
+        constexpr slot_map_handle(TWord index, TWord generation) noexcept
+            : m_bits{static_cast<TWord>((generation << index_bits) | index)} {
+        }
+
+        /// @brief Returns the slot index
+        /// @return The slot index
+        [[nodiscard]] constexpr auto index() const noexcept -> TWord {
+            return static_cast<TWord>(m_bits & k_index_mask);
+        }
+
+        /// @brief Returns the generation
+        /// @return The generation
+        [[nodiscard]] constexpr auto generation() const noexcept -> TWord {
+            return static_cast<TWord>(m_bits >> index_bits);
+        }
+
+        /// @brief Returns whether this is the null handle
+        /// @return Whether this is null
+        [[nodiscard]] constexpr auto is_null() const noexcept -> bool {
+            return m_bits == k_null;
+        }
+
+        /// @brief Returns the packed representation of this handle
+        /// @return The packed bits
+        [[nodiscard]] constexpr auto bits() const noexcept -> TWord {
+            return m_bits;
+        }
+
+        /// @brief Creates a handle from a packed representation previously obtained via `bits()`
+        /// @param bits The packed bits
+        /// @return The handle
+        [[nodiscard]] static constexpr auto from_bits(TWord bits) noexcept -> slot_map_handle {
+            auto handle = slot_map_handle{};
+            handle.m_bits = bits;
+            return handle;
+        }
+
+        friend constexpr auto
+        operator==(const slot_map_handle& lhs, const slot_map_handle& rhs) noexcept
+            -> bool = default;
+
+      private:
+        static constexpr auto k_null = std::numeric_limits<TWord>::max();
+        static constexpr auto k_index_mask
+            = static_cast<TWord>((static_cast<TWord>(1) << index_bits) - 1U);
+
+        TWord m_bits = k_null;
+    };
+
+    /// @brief A container storing its elements contiguously, addressed by stable, generational
+    /// handles
+    ///
+    /// @tparam TValue The element type. Must be nothrow move constructible and assignable
+    /// @tparam TWord The handle representation. Either `u32` or `u64`
+    /// @ingroup slot_map
+    /// @headerfile hyperion/platform/slot_map.h
+    template<typename TValue, typename TWord = u32>
+        requires std::is_nothrow_move_constructible_v<TValue>
+                 && std::is_nothrow_move_assignable_v<TValue>
+    class slot_map {
+      public:
+        /// @brief The element type
+        using value_type = TValue;
+        /// @brief The handle type
+        using handle_type = slot_map_handle<TWord>;
+        /// @brief The iterator over live elements
+        using iterator = typename std::vector<TValue>::iterator;
+        /// @brief The iterator over live elements
+        using const_iterator = typename std::vector<TValue>::const_iterator;
+
+        /// @brief Inserts `value`
+        /// @param value The value to insert
+        /// @return The handle to the inserted element
+        /// @pre `size() < max_size()`
+        auto insert(const TValue& value) -> handle_type {
+            return emplace(value);
+        }
+
+        /// @brief Inserts `value`
+        /// @param value The value to insert
+        /// @return The handle to the inserted element
+        /// @pre `size() < max_size()`
+        auto insert(TValue&& value) -> handle_type {
+            return emplace(std::move(value));
+        }
+
+        /// @brief Inserts an element constructed in place from `args`
+        /// @param args The arguments to construct the element with
+        /// @return The handle to the inserted element
+        /// @pre `size() < max_size()`
+        template<typename... TArgs>
+            requires std::constructible_from<TValue, TArgs...>
+        auto emplace(TArgs&&... args) -> handle_type {
+            const auto dense = static_cast<TWord>(m_values.size());
+            m_values.emplace_back(std::forward<TArgs>(args)...);
+
+            auto slot_index = m_free_head;
+            if(slot_index == k_no_slot) {
+                HYPERION_ASSERT(m_slots.size() <= handle_type::max_index,
+                                "slot_map has exceeded the capacity of its handle type");
+                slot_index = static_cast<TWord>(m_slots.size());
+                try {
+                    m_dense_to_slot.push_back(slot_index);
+                    try {
+                        m_slots.push_back(slot{dense, 0U});
+                    }
+                    catch(...) {
+                        m_dense_to_slot.pop_back();
+                        throw;
+                    }
+                }
+                catch(...) {
+                    m_values.pop_back();
+                    throw;
+                }
+            }
+            else {
+                try {
+                    m_dense_to_slot.push_back(slot_index);
+                }
+                catch(...) {
+                    m_values.pop_back();
+                    throw;
+                }
+                m_free_head = m_slots[slot_index].index;
+                m_slots[slot_index].index = dense;
+            }
+
+            return handle_type{slot_index, m_slots[slot_index].generation};
+        }
+
+        /// @brief Erases the element referred to by `handle`, if it is live
+        /// @param handle The handle of the element to erase
+        /// @return Whether an element was erased
+        auto erase(handle_type handle) noexcept -> bool {
+            if(!contains(handle)) {
+                return false;
+            }
+
+            const auto slot_index = handle.index();
+            auto& erased = m_slots[slot_index];
+            const auto dense = erased.index;
+            const auto last = static_cast<TWord>(m_values.size() - 1_usize);
+
+            if(dense != last) {
+                m_values[dense] = std::move(m_values[last]);
+                m_dense_to_slot[dense] = m_dense_to_slot[last];
+                m_slots[m_dense_to_slot[dense]].index = dense;
+            }
+            m_values.pop_back();
+            m_dense_to_slot.pop_back();
+            release(slot_index);
+            return true;
+        }
+
+        /// @brief Returns whether `handle` refers to a live element
+        /// @param handle The handle
+        /// @return Whether `handle` is live
+        [[nodiscard]] auto contains(handle_type handle) const noexcept -> bool {
+            const auto index = handle.index();
+            return index < m_slots.size() && m_slots[index].generation == handle.generation()
+                   && m_slots[index].index < m_values.size()
+                   && m_dense_to_slot[m_slots[index].index] == index;
+        }
+
+        /// @brief Returns a pointer to the element referred to by `handle`, or `nullptr` if it
+        /// is stale
+        /// @param handle The handle
+        /// @return A pointer to the element, or `nullptr`
+        [[nodiscard]] auto get(handle_type handle) noexcept -> TValue* {
+            return contains(handle) ? &m_values[m_slots[handle.index()].index] : nullptr;
+        }
+
+        /// @brief Returns a pointer to the element referred to by `handle`, or `nullptr` if it
+        /// is stale
+        /// @param handle The handle
+        /// @return A pointer to the element, or `nullptr`
+        [[nodiscard]] auto get(handle_type handle) const noexcept -> const TValue* {
+            return contains(handle) ? &m_values[m_slots[handle.index()].index] : nullptr;
+        }
+
+        /// @brief Returns the element referred to by `handle`
+        /// @param handle The handle
+        /// @return The element
+        /// @pre `contains(handle)`
+        [[nodiscard]] auto operator[](handle_type handle) noexcept -> TValue& {
+            HYPERION_DEBUG_ASSERT(contains(handle), "Accessed a slot_map with a stale handle");
+            return m_values[m_slots[handle.index()].index];
+        }
+
+        /// @brief Returns the element referred to by `handle`
+        /// @param handle The handle
+        /// @return The element
+        /// @pre `contains(handle)`
+        [[nodiscard]] auto operator[](handle_type handle) const noexcept -> const TValue& {
+            HYPERION_DEBUG_ASSERT(contains(handle), "Accessed a slot_map with a stale handle");
+            return m_values[m_slots[handle.index()].index];
+        }
+
+        /// @brief Returns the handle of the live element at `position` in iteration order
+        /// @param position The position of the element in `values()`
+        /// @return The element's handle
+        /// @pre `position < size()`
+        [[nodiscard]] auto handle_at(usize position) const noexcept -> handle_type {
+            HYPERION_DEBUG_ASSERT(position < size(), "slot_map position out of bounds");
+            const auto slot_index = m_dense_to_slot[position];
+            return handle_type{slot_index, m_slots[slot_index].generation};
+        }
+
+        /// @brief Returns the live elements, as a contiguous span
+        /// @return The live elements
+        [[nodiscard]] auto values() noexcept -> std::span<TValue> {
+            return m_values;
+        }
+
+        /// @brief Returns the live elements, as a contiguous span
+        /// @return The live elements
+        [[nodiscard]] auto values() const noexcept -> std::span<const TValue> {
+            return m_values;
+        }
+
+        [[nodiscard]] auto begin() noexcept -> iterator {
+            return m_values.begin();
+        }
+
+        [[nodiscard]] auto begin() const noexcept -> const_iterator {
+            return m_values.begin();
+        }
+
+        [[nodiscard]] auto end() noexcept -> iterator {
+            return m_values.end();
+        }
+
+        [[nodiscard]] auto end() const noexcept -> const_iterator {
+            return m_values.end();
+        }
+
+        /// @brief Returns the number of live elements
+        /// @return The number of elements
+        [[nodiscard]] auto size() const noexcept -> usize {
+            return m_values.size();
+        }
+
+        /// @brief Returns whether there are no live elements
+        /// @return Whether this is empty
+        [[nodiscard]] auto empty() const noexcept -> bool {
+            return m_values.empty();
+        }
+
+        /// @brief Returns the maximum number of elements supported by the handle type
+        /// @return The maximum number of elements
+        [[nodiscard]] static constexpr auto max_size() noexcept -> usize {
+            return static_cast<usize>(handle_type::max_index) + 1_usize;
+        }
+
+        /// @brief Reserves storage for `capacity` elements
+        /// @param capacity The number of elements to reserve storage for
+        auto reserve(usize capacity) -> void {
+            m_values.reserve(capacity);
+            m_dense_to_slot.reserve(capacity);
+            m_slots.reserve(capacity);
+        }
+
+        /// @brief Erases every element, invalidating all handles
+        auto clear() noexcept -> void {
+            for(const auto slot_index : m_dense_to_slot) {
+                release(slot_index);
+            }
+            m_values.clear();
+            m_dense_to_slot.clear();
+        }
+
+      private:
+        static constexpr auto k_no_slot = std::numeric_limits<TWord>::max();
+
+        struct slot {
+            // the element's position in `m_values` when live, the next free slot otherwise
+            TWord index;
+            TWord generation;
+        };
+
+        std::vector<TValue> m_values;
+        std::vector<TWord> m_dense_to_slot;
+        std::vector<slot> m_slots;
+        TWord m_free_head = k_no_slot;
+
+        auto release(TWord slot_index) noexcept -> void {
+            auto& released = m_slots[slot_index];
+            if(released.generation == handle_type::max_generation) {
+                // retire the slot, so that no stale handle can ever become valid again
+                released.index = k_no_slot;
+                return;
+            }
+
+            ++released.generation;
+            released.index = m_free_head;
+            m_free_head = slot_index;
+        }
+    };
+
+} // namespace hyperion
+
+#if defined(HYPERION_ENABLE_TESTING) && HYPERION_ENABLE_TESTING
+
+    #include <boost/ut.hpp>
+    #include <hyperion/platform/ignore.h>
+
+    #include <random>
+    #include <string>
+    #include <unordered_map>
+
+namespace hyperion::_test::platform::slot_map {
+
+    // NOLINTNEXTLINE(google-build-using-namespace)
+    using namespace boost::ut;
+
+    static_assert(sizeof(slot_map_handle<u32>) == sizeof(u32));
+    static_assert(sizeof(slot_map_handle<u64>) == sizeof(u64));
+    static_assert(slot_map_handle<u32>{5U, 3U}.index() == 5U);
+    static_assert(slot_map_handle<u32>{5U, 3U}.generation() == 3U);
+    static_assert(slot_map_handle<u32>{}.is_null());
+
+    // NOLINTNEXTLINE(cert-err58-cpp)
+    static const suite<"hyperion::platform::slot_map"> slot_map_tests = [] {
+        "insert_erase_lookup"_test = [] {
+            auto map = hyperion::slot_map<std::string>{};
+            const auto first = map.insert("first");
+            const auto second = map.emplace(3_usize, 'x');
+
+            expect(that % map.size() == 2_usize);
+            expect(map[first] == "first");
+            expect(*map.get(second) == "xxx");
+
+            expect(that % map.erase(first));
+            expect(that % !map.erase(first));
+            expect(that % !map.contains(first));
+            expect(that % map.get(first) == nullptr);
+            expect(map[second] == "xxx");
+
+            // the freed slot is reused with a new generation
+            const auto third = map.insert("third");
+            expect(that % third.index() == first.index());
+            expect(that % third.generation() != first.generation());
+            expect(that % !map.contains(first));
+            expect(that % map.contains(third));
+            expect(that % !map.contains(slot_map_handle<u32>{}));
+        };
+
+        "dense_iteration"_test = [] {
+            auto map = hyperion::slot_map<i32, u64>{};
+            std::vector<slot_map_handle<u64>> handles;
+            for(auto value = 0; value < 8; ++value) {
+                handles.push_back(map.insert(value));
+            }
+            hyperion::ignore(map.erase(handles[2]), map.erase(handles[5]));
+
+            auto sum = 0;
+            for(const auto value : map) {
+                sum += value;
+            }
+            expect(that % sum == 28 - 2 - 5);
+            expect(that % map.values().size() == 6_usize);
+
+            for(auto position = 0_usize; position < map.size(); ++position) {
+                expect(that % map[map.handle_at(position)] == map.values()[position]);
+            }
+
+            map.clear();
+            expect(that % map.empty());
+            expect(that % !map.contains(handles[0]));
+        };
+
+        "generation_exhaustion_retires_slots"_test = [] {
+            auto map = hyperion::slot_map<i32>{};
+            auto first = map.insert(0);
+            const auto retired_index = first.index();
+            for(auto round = 0U; round < slot_map_handle<u32>::max_generation; ++round) {
+                hyperion::ignore(map.erase(first));
+                first = map.insert(0);
+            }
+            expect(that % first.generation() == slot_map_handle<u32>::max_generation);
+            hyperion::ignore(map.erase(first));
+
+            const auto next = map.insert(1);
+            expect(that % next.index() != retired_index);
+        };
+
+        "randomized_against_unordered_map"_test = [] {
+            auto map = hyperion::slot_map<u64>{};
+            std::unordered_map<u32, u64> reference;
+            std::vector<slot_map_handle<u32>> handles;
+            auto random = std::mt19937_64{42_u64}; // NOLINT(cert-msc32-c, cert-msc51-cpp)
+
+            for(auto step = 0_u64; step < 20'000_u64; ++step) {
+                if(handles.empty() || random() % 3_u64 != 0_u64) {
+                    const auto handle = map.insert(step);
+                    handles.push_back(handle);
+                    reference[handle.bits()] = step;
+                }
+                else {
+                    const auto position = random() % handles.size();
+                    const auto handle = handles[position];
+                    expect(that % map.erase(handle) == (reference.erase(handle.bits()) == 1_usize));
+                    handles[position] = handles.back();
+                    handles.pop_back();
+                }
+            }
+
+            expect(that % map.size() == reference.size());
+            auto consistent = true;
+            for(const auto handle : handles) {
+                const auto* value = map.get(handle);
+                consistent = consistent && value != nullptr && *value == reference[handle.bits()];
+            }
+            expect(that % consistent);
+        };
+    };
+
+} // namespace hyperion::_test::platform::slot_map
+
+#endif // defined(HYPERION_ENABLE_TESTING) && HYPERION_ENABLE_TESTING
+
+#endif // HYPERION_PLATFORM_SLOT_MAP_H
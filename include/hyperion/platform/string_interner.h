@@ -0,0 +1,524 @@
+/// @file string_interner.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief A concurrent string interning table mapping strings to small, dense ids
+/// @version 0.4.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2024 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef HYPERION_PLATFORM_STRING_INTERNER_H
+#define HYPERION_PLATFORM_STRING_INTERNER_H
+
+#include <hyperion/platform.h>
+#include <hyperion/platform/assert.h>
+#include <hyperion/platform/compact_optional.h>
+#include <hyperion/platform/def.h>
+#include <hyperion/platform/fixed_string.h>
+#include <hyperion/platform/types.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+/// @ingroup platform
+/// @{
+///	@defgroup string_interner String Interner
+/// `hyperion::string_interner` maps strings to small, dense `u32` ids, so that strings that are
+/// compared and hashed frequently (metric labels, symbol names) can be handled as integers
+/// instead. Each distinct string is assigned the next id, starting from zero, and the id of a
+/// string never changes.
+///
+/// Interned strings are copied into an append-only arena and never move or get freed before the
+/// interner is destroyed, so the `std::string_view`s returned by `view` remain valid for the
+/// interner's lifetime.
+///
+/// Lookups (`find`, `view`, and `intern` of an already-interned string) are lock-free: the
+/// string table is split into shards, each an open-addressing hash table whose slots are
+/// published with release stores. Insertions lock the shard the string hashes to, and only
+/// briefly share a lock to assign the string its id, so concurrent insertions of unrelated
+/// strings rarely contend. Tables grow by copying into a new
+/// table; retired tables are kept until the interner is destroyed, so concurrent readers never
+/// observe freed memory.
+///
+/// Strings known at compile time can be interned with `hyperion::interned<"string">()`. Each
+/// such string is interned into `string_interner::global()` during static initialization, and
+/// retrieving its id afterwards is a single load.
+///
+/// # Example
+/// @code {.cpp}
+/// auto& interner = hyperion::string_interner::global();
+/// const auto label = interner.intern(request.route());
+///
+/// if(label == hyperion::interned<"/health">()) {
+///     return;
+/// }
+/// counters[label] += 1;
+/// @endcode
+/// @headerfile hyperion/platform/string_interner.h
+/// @}
+
+namespace hyperion {
+
+    namespace detail::interner {
+        static constexpr auto k_shard_bits = 4_usize;
+        static constexpr auto k_shard_count = 1_usize << k_shard_bits;
+        static constexpr auto k_shard_mask = k_shard_count - 1_usize;
+        static constexpr auto k_chunk_bits = 12_usize;
+        static constexpr auto k_chunk_size = 1_usize << k_chunk_bits;
+        static constexpr auto k_max_chunks = 4096_usize;
+        static constexpr auto k_initial_slots = 64_usize;
+        static constexpr auto k_arena_block_size = 64_usize * 1024_usize;
+        static constexpr auto k_tag_shift = 32_u64;
+        static constexpr auto k_id_mask = 0xFFFF'FFFF_u64;
+
+        /// @brief An open-addressing table of slots, each packing the high 32 bits of a
+        /// string's hash with its id + 1. Zero marks an empty slot
+        struct table {
+            usize mask;
+            std::unique_ptr<std::atomic<u64>[]> slots; // NOLINT(*-avoid-c-arrays)
+
+            explicit table(usize capacity)
+                : mask{capacity - 1_usize},
+                  slots{std::make_unique<std::atomic<u64>[]>(capacity)} { // NOLINT(*-c-arrays)
+            }
+        };
+
+        HYPERION_IGNORE_PADDING_WARNING_START;
+
+        struct alignas(HYPERION_PLATFORM_CACHE_LINE_SIZE) shard {
+            std::atomic<table*> current = nullptr;
+            std::mutex mutex;
+            // the current table and every retired one
+            std::vector<std::unique_ptr<table>> tables;
+            // the arena of interned strings
+            std::vector<std::unique_ptr<char[]>> blocks; // NOLINT(*-avoid-c-arrays)
+            char* cursor = nullptr;
+            usize remaining = 0;
+            usize count = 0;
+        };
+
+        HYPERION_IGNORE_PADDING_WARNING_STOP;
+
+        [[nodiscard]] inline auto hash(std::string_view string) noexcept -> u64 {
+            return static_cast<u64>(std::hash<std::string_view>{}(string));
+        }
+
+        [[nodiscard]] constexpr auto tag_of(u64 hash) noexcept -> u64 {
+            return hash >> k_tag_shift;
+        }
+
+        [[nodiscard]] constexpr auto home_of(u64 hash, usize mask) noexcept -> usize {
+            return static_cast<usize>(hash >> k_shard_bits) & mask;
+        }
+    } // namespace detail::interner
+
+    /// @brief A concurrent table mapping strings to small, dense `u32` ids
+    /// @ingroup string_interner
+    /// @headerfile hyperion/platform/string_interner.h
+    class string_interner {
+      public:
+        /// @brief The maximum number of distinct strings an interner can hold
+        static constexpr auto max_size
+            = detail::interner::k_chunk_size * detail::interner::k_max_chunks;
+
+        /// @brief Constructs an empty interner
+        constexpr string_interner() noexcept = default;
+        string_interner(const string_interner&) = delete;
+        string_interner(string_interner&&) = delete;
+
+        ~string_interner() noexcept {
+            for(auto& chunk : m_chunks) {
+                delete[] chunk.load(std::memory_order_relaxed); // NOLINT(*-owning-memory)
+            }
+        }
+
+        auto operator=(const string_interner&) -> string_interner& = delete;
+        auto operator=(string_interner&&) -> string_interner& = delete;
+
+        /// @brief Returns the global interner, which compile-time strings are interned into by
+        /// `hyperion::interned`. It is constant-initialized and never destroyed
+        /// @return The global interner
+        [[nodiscard]] static auto global() noexcept -> string_interner&;
+
+        /// @brief Returns the id of `string`, interning it if it has not been already
+        /// @param string The string to intern
+        /// @return The id of `string`
+        /// @pre Fewer than `max_size` distinct strings have been interned
+        [[nodiscard]] auto intern(std::string_view string) -> u32 {
+            using namespace detail::interner; // NOLINT(google-build-using-namespace)
+            const auto hashed = hash(string);
+            auto& owner = m_shards[static_cast<usize>(hashed) & k_shard_mask];
+            if(const auto found = find_in(owner, string, hashed); found.has_value()) {
+                return found.value();
+            }
+
+            const auto guard = std::scoped_lock{owner.mutex};
+            // another thread may have inserted it while we were acquiring the lock
+            if(const auto found = find_in(owner, string, hashed); found.has_value()) {
+                return found.value();
+            }
+
+            // everything that can throw happens before the string is assigned an id, so a
+            // failed insertion leaves no gap in the ids
+            auto* current = owner.current.load(std::memory_order_relaxed);
+            if(current == nullptr || (owner.count + 1_usize) * 2_usize > current->mask + 1_usize) {
+                current = grow(owner, current);
+            }
+            const auto stored = std::string_view{store(owner, string), string.size()};
+
+            auto id = 0_u32;
+            {
+                // ids are assigned and their entries written in order, so that `size` only
+                // counts strings whose entries are complete
+                const auto id_guard = std::scoped_lock{m_id_mutex};
+                id = m_size.load(std::memory_order_relaxed);
+                HYPERION_ASSERT(id < max_size, "string_interner capacity exceeded");
+                *entry_for(id) = stored;
+                m_size.store(id + 1_u32, std::memory_order_release);
+            }
+            insert(*current, hashed, id, std::memory_order_release);
+            ++owner.count;
+            return id;
+        }
+
+        /// @brief Returns the id of `string`, if it has been interned
+        /// @param string The string to look up
+        /// @return The id of `string`, or an empty optional
+        [[nodiscard]] auto find(std::string_view string) const noexcept -> compact_optional<u32> {
+            const auto hashed = detail::interner::hash(string);
+            const auto& owner
+                = m_shards[static_cast<usize>(hashed) & detail::interner::k_shard_mask];
+            return find_in(owner, string, hashed);
+        }
+
+        /// @brief Returns the string with the given id
+        /// @param id The id of an interned string
+        /// @return The string
+        /// @pre `id` was returned by `intern` or `find` on this interner
+        [[nodiscard]] auto view(u32 id) const noexcept -> std::string_view {
+            HYPERION_DEBUG_ASSERT(id < m_size.load(std::memory_order_relaxed),
+                                  "string_interner::view called with an unknown id");
+            const auto* entries
+                = m_chunks[id >> detail::interner::k_chunk_bits].load(std::memory_order_acquire);
+            return entries[id & (detail::interner::k_chunk_size - 1_usize)];
+        }
+
+        /// @brief Returns the number of strings that have been interned. Every id below it can
+        /// be passed to `view`, even while other threads are interning strings
+        /// @return The number of interned strings
+        [[nodiscard]] auto size() const noexcept -> usize {
+            return m_size.load(std::memory_order_acquire);
+        }
+
+      private:
+        std::array<detail::interner::shard, detail::interner::k_shard_count> m_shards{};
+        std::array<std::atomic<std::string_view*>, detail::interner::k_max_chunks> m_chunks{};
+        std::mutex m_id_mutex;
+        // the next id, published after its entry is written
+        std::atomic<u32> m_size = 0_u32;
+
+        [[nodiscard]] auto
+        find_in(const detail::interner::shard& owner, std::string_view string, u64 hashed)
+            const noexcept -> compact_optional<u32> {
+            using namespace detail::interner; // NOLINT(google-build-using-namespace)
+            const auto* const current = owner.current.load(std::memory_order_acquire);
+            if(current == nullptr) {
+                return std::nullopt;
+            }
+
+            const auto tag = tag_of(hashed);
+            for(auto index = home_of(hashed, current->mask);;
+                index = (index + 1_usize) & current->mask)
+            {
+                const auto slot = current->slots[index].load(std::memory_order_acquire);
+                if(slot == 0_u64) {
+                    return std::nullopt;
+                }
+                const auto id = static_cast<u32>((slot & k_id_mask) - 1_u64);
+                if(tag_of(slot) == tag && view(id) == string) {
+                    return id;
+                }
+            }
+        }
+
+        // returns the entry for `id`, allocating its chunk if necessary
+        [[nodiscard]] auto entry_for(u32 id) -> std::string_view* {
+            using namespace detail::interner; // NOLINT(google-build-using-namespace)
+            auto& chunk = m_chunks[id >> k_chunk_bits];
+            auto* entries = chunk.load(std::memory_order_acquire);
+            if(entries == nullptr) {
+                auto fresh = std::make_unique<std::string_view[]>(k_chunk_size); // NOLINT
+                if(chunk.compare_exchange_strong(entries,
+                                                 fresh.get(),
+                                                 std::memory_order_acq_rel,
+                                                 std::memory_order_acquire))
+                {
+                    entries = fresh.release();
+                }
+            }
+            return entries + (id & (k_chunk_size - 1_usize));
+        }
+
+        // copies `string` into the shard's arena
+        [[nodiscard]] static auto
+        store(detail::interner::shard& owner, std::string_view string) -> const char* {
+            using namespace detail::interner; // NOLINT(google-build-using-namespace)
+            if(string.size() > k_arena_block_size / 4_usize) {
+                // large strings get a block of their own, so they don't waste the current one
+                auto& block = owner.blocks.emplace_back(
+                    std::make_unique<char[]>(string.size())); // NOLINT(*-avoid-c-arrays)
+                std::memcpy(block.get(), string.data(), string.size());
+                return block.get();
+            }
+
+            if(owner.remaining < string.size()) {
+                owner.cursor = owner.blocks
+                                   .emplace_back(std::make_unique<char[]>( // NOLINT(*-c-arrays)
+                                       k_arena_block_size))
+                                   .get();
+                owner.remaining = k_arena_block_size;
+            }
+            auto* const stored = owner.cursor;
+            if(!string.empty()) {
+                std::memcpy(stored, string.data(), string.size());
+            }
+            owner.cursor += string.size();
+            owner.remaining -= string.size();
+            return stored;
+        }
+
+        static auto insert(detail::interner::table& target,
+                           u64 hashed,
+                           u32 id,
+                           std::memory_order order) noexcept -> void {
+            using namespace detail::interner; // NOLINT(google-build-using-namespace)
+            auto index = home_of(hashed, target.mask);
+            while(target.slots[index].load(std::memory_order_relaxed) != 0_u64) {
+                index = (index + 1_usize) & target.mask;
+            }
+            const auto slot = (tag_of(hashed) << k_tag_shift) | (static_cast<u64>(id) + 1_u64);
+            target.slots[index].store(slot, order);
+        }
+
+        // replaces the shard's table with one twice the size, retaining the old one for
+        // concurrent readers
+        auto grow(detail::interner::shard& owner, detail::interner::table* current)
+            -> detail::interner::table* {
+            using namespace detail::interner; // NOLINT(google-build-using-namespace)
+            const auto capacity = current == nullptr ? k_initial_slots :
+                                                       (current->mask + 1_usize) * 2_usize;
+            auto& replacement = owner.tables.emplace_back(std::make_unique<table>(capacity));
+            if(current != nullptr) {
+                for(auto index = 0_usize; index <= current->mask; ++index) {
+                    const auto slot = current->slots[index].load(std::memory_order_relaxed);
+                    if(slot != 0_u64) {
+                        const auto id = static_cast<u32>((slot & k_id_mask) - 1_u64);
+                        insert(*replacement, hash(view(id)), id, std::memory_order_relaxed);
+                    }
+                }
+            }
+            owner.current.store(replacement.get(), std::memory_order_release);
+            return replacement.get();
+        }
+    };
+
+    namespace detail::interner {
+        /// @brief Storage for the global interner that is constant-initialized and never
+        /// destroyed, so interned ids remain valid during static initialization and destruction
+        union global_interner_storage {
+            string_interner instance;
+
+            constexpr global_interner_storage() noexcept
+                : instance{} {
+            }
+            global_interner_storage(const global_interner_storage&) = delete;
+            global_interner_storage(global_interner_storage&&) = delete;
+            ~global_interner_storage() noexcept { // NOLINT(modernize-use-equals-default)
+            }
+            auto operator=(const global_interner_storage&) -> global_interner_storage& = delete;
+            auto operator=(global_interner_storage&&) -> global_interner_storage& = delete;
+        };
+
+        // NOLINTNEXTLINE(*-avoid-non-const-global-variables)
+        inline constinit global_interner_storage g_interner;
+
+        /// @brief Interns `TString` during static initialization, for every string used with
+        /// `hyperion::interned`
+        template<fixed_string TString>
+        struct pre_interned {
+            static const u32 id;
+        };
+    } // namespace detail::interner
+
+    inline auto string_interner::global() noexcept -> string_interner& {
+        return detail::interner::g_interner.instance;
+    }
+
+    /// @brief Returns the id of the compile-time string `TString` in `string_interner::global()`
+    ///
+    /// Every string used with `interned` is interned during static initialization, so calls
+    /// after `main` has started only load the already-known id.
+    ///
+    /// @tparam TString The string
+    /// @return The id of `TString`
+    /// @ingroup string_interner
+    /// @headerfile hyperion/platform/string_interner.h
+    template<fixed_string TString>
+    [[nodiscard]] inline auto interned() -> u32 {
+        // odr-use the pre-interning variable, so that it is instantiated and initialized at
+        // startup for every string used with `interned`
+        static_cast<void>(&detail::interner::pre_interned<TString>::id);
+        static const auto id = string_interner::global().intern(TString.view());
+        return id;
+    }
+
+    template<fixed_string TString>
+    const u32 detail::interner::pre_interned<TString>::id = interned<TString>();
+
+} // namespace hyperion
+
+#if defined(HYPERION_ENABLE_TESTING) && HYPERION_ENABLE_TESTING
+
+    #include <boost/ut.hpp>
+
+    #include <string>
+    #include <thread>
+
+namespace hyperion::_test::platform::string_interner {
+
+    // NOLINTNEXTLINE(google-build-using-namespace)
+    using namespace boost::ut;
+
+    // NOLINTNEXTLINE(cert-err58-cpp)
+    static const suite<"hyperion::platform::string_interner"> string_interner_tests = [] {
+        "intern_and_view"_test = [] {
+            auto interner = hyperion::string_interner{};
+            const auto first = interner.intern("first");
+            const auto second = interner.intern("second");
+            const auto empty = interner.intern("");
+
+            expect(that % first == 0_u32);
+            expect(that % second == 1_u32);
+            expect(that % interner.intern(std::string{"first"}) == first);
+            expect(that % interner.view(second) == std::string_view{"second"});
+            expect(that % interner.view(empty).empty());
+            expect(that % interner.size() == 3_usize);
+
+            expect(interner.find("second") == second);
+            expect(!interner.find("third").has_value());
+
+            const auto large = std::string(100'000_usize, 'x');
+            expect(that % interner.view(interner.intern(large)) == std::string_view{large});
+        };
+
+        "many_strings"_test = [] {
+            auto interner = hyperion::string_interner{};
+            auto consistent = true;
+            for(auto index = 0_u32; index < 20'000_u32; ++index) {
+                consistent = consistent && interner.intern(std::to_string(index)) == index;
+            }
+            for(auto index = 0_u32; index < 20'000_u32; ++index) {
+                consistent = consistent && interner.view(index) == std::to_string(index)
+                             && interner.find(std::to_string(index)) == index;
+            }
+            expect(that % consistent);
+        };
+
+        "concurrent_interning"_test = [] {
+            static constexpr auto k_threads = 8_usize;
+            static constexpr auto k_strings = 5'000_usize;
+
+            auto interner = hyperion::string_interner{};
+            auto ids = std::vector<std::vector<u32>>(k_threads);
+            {
+                auto threads = std::vector<std::jthread>{};
+                for(auto thread = 0_usize; thread < k_threads; ++thread) {
+                    threads.emplace_back([&interner, &ids, thread] {
+                        ids[thread].reserve(k_strings);
+                        // every thread interns the same strings, in a different order
+                        for(auto index = 0_usize; index < k_strings; ++index) {
+                            const auto value
+                                = (index * (thread + 1_usize) * 7919_usize) % k_strings;
+                            ids[thread].push_back(
+                                interner.intern("label." + std::to_string(value)));
+                        }
+                    });
+                }
+            }
+
+            expect(that % interner.size() == k_strings);
+            auto consistent = true;
+            for(auto thread = 0_usize; thread < k_threads; ++thread) {
+                for(auto index = 0_usize; index < k_strings; ++index) {
+                    const auto value = (index * (thread + 1_usize) * 7919_usize) % k_strings;
+                    consistent = consistent
+                                 && interner.view(ids[thread][index])
+                                        == "label." + std::to_string(value);
+                }
+            }
+            expect(that % consistent);
+        };
+
+        "size_while_interning"_test = [] {
+            static constexpr auto k_strings = 20'000_usize;
+
+            auto interner = hyperion::string_interner{};
+            auto consistent = true;
+            auto writer = std::thread{[&interner] {
+                for(auto index = 0_usize; index < k_strings; ++index) {
+                    static_cast<void>(interner.intern(std::to_string(index)));
+                }
+            }};
+            // every id below `size` already has its string
+            for(auto seen = 0_usize; seen < k_strings;) {
+                const auto size = interner.size();
+                for(; seen < size; ++seen) {
+                    consistent = consistent
+                                 && interner.view(static_cast<u32>(seen)) == std::to_string(seen);
+                }
+            }
+            writer.join();
+            expect(that % consistent);
+        };
+
+        "pre_interned"_test = [] {
+            auto& global = hyperion::string_interner::global();
+            const auto id = hyperion::interned<"hyperion.test.pre_interned">();
+            expect(that % id == hyperion::interned<"hyperion.test.pre_interned">());
+            expect(global.find("hyperion.test.pre_interned") == id);
+            expect(that % id != hyperion::interned<"hyperion.test.other">());
+            expect(that % global.view(hyperion::interned<"hyperion.test.pre_interned">())
+                   == std::string_view{"hyperion.test.pre_interned"});
+        };
+    };
+
+} // namespace hyperion::_test::platform::string_interner
+
+#endif // defined(HYPERION_ENABLE_TESTING) && HYPERION_ENABLE_TESTING
+
+#endif // HYPERION_PLATFORM_STRING_INTERNER_H
@@ -0,0 +1,250 @@
+/// @file tagged_ptr.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Pointers carrying a tag or version in their unused high address bits
+/// @version 0.4.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2024 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef HYPERION_PLATFORM_TAGGED_PTR_H
+#define HYPERION_PLATFORM_TAGGED_PTR_H
+
+#include <hyperion/platform.h>
+#include <hyperion/platform/def.h>
+#include <hyperion/platform/types.h>
+
+#include <cstdint>
+#include <type_traits>
+
+/// @ingroup platform
+/// @{
+///	@defgroup tagged_ptr Tagged Pointers
+/// `hyperion::tagged_ptr<T>` packs a pointer and a 16-bit tag into a single 64-bit word, using
+/// the address bits that current x86_64 and ARMv8 virtual address spaces leave unused.
+///
+/// Because a `tagged_ptr` is a single word, `std::atomic<tagged_ptr<T>>` is lock-free, and
+/// using the tag as a version counter that is incremented on every update makes
+/// compare-and-swap loops over it resistant to the ABA problem. Where a full 64-bit version is
+/// needed, use `hyperion::atomic_pair` from `hyperion/platform/atomic128.h` instead.
+///
+/// # Example
+/// @code {.cpp}
+/// std::atomic<hyperion::tagged_ptr<node>> g_head;
+///
+/// auto pop() -> node* {
+///     auto head = g_head.load(std::memory_order_acquire);
+///     while(head.get() != nullptr
+///           && !g_head.compare_exchange_weak(head, head.next_version(head.get()->next))) {
+///     }
+///     return head.get();
+/// }
+/// @endcode
+/// @headerfile hyperion/platform/tagged_ptr.h
+/// @}
+
+/// @def HYPERION_PLATFORM_TAGGED_PTR_ADDRESS_BITS
+/// @brief The number of significant virtual address bits assumed by `hyperion::tagged_ptr`.
+///
+/// x86_64 (with 4-level paging) and ARMv8 (with 48-bit virtual addresses) both use 48-bit
+/// virtual addresses. Note that on Linux, addresses above 47 bits are only handed out to
+/// processes that explicitly request them from `mmap` when 5-level paging is enabled.
+/// @ingroup tagged_ptr
+/// @headerfile hyperion/platform/tagged_ptr.h
+#ifndef HYPERION_PLATFORM_TAGGED_PTR_ADDRESS_BITS
+    #if HYPERION_PLATFORM_IS_ARCHITECTURE(HYPERION_PLATFORM_X86_64) \
+        || HYPERION_PLATFORM_IS_ARCHITECTURE(HYPERION_PLATFORM_ARM_V8)
+        #define HYPERION_PLATFORM_TAGGED_PTR_ADDRESS_BITS 48 // NOLINT
+    #else
+        #define HYPERION_PLATFORM_TAGGED_PTR_ADDRESS_BITS 0 // NOLINT
+    #endif // HYPERION_PLATFORM_IS_ARCHITECTURE(HYPERION_PLATFORM_X86_64)
+           // || HYPERION_PLATFORM_IS_ARCHITECTURE(HYPERION_PLATFORM_ARM_V8)
+#endif     // HYPERION_PLATFORM_TAGGED_PTR_ADDRESS_BITS
+
+namespace hyperion {
+
+    namespace detail::tagged_ptr {
+        static inline constexpr auto k_address_bits
+            = static_cast<u64>(HYPERION_PLATFORM_TAGGED_PTR_ADDRESS_BITS);
+        static inline constexpr auto k_tag_bits = 64_u64 - k_address_bits;
+        static inline constexpr auto k_address_mask = (1_u64 << k_address_bits) - 1_u64;
+    } // namespace detail::tagged_ptr
+
+    /// @brief A pointer to `TType` carrying a 16-bit tag in its unused high address bits.
+    ///
+    /// `tagged_ptr` is trivially copyable and the size of a `u64`, so it can be used with
+    /// `std::atomic`. Equality compares both the pointer and the tag.
+    ///
+    /// @tparam TType The pointed-to type
+    /// @ingroup tagged_ptr
+    /// @headerfile hyperion/platform/tagged_ptr.h
+    template<typename TType>
+        requires(sizeof(void*) == sizeof(u64)) && (detail::tagged_ptr::k_tag_bits == 16_u64)
+    class tagged_ptr {
+      public:
+        /// @brief The type of the tag
+        using tag_type = u16;
+
+        /// @brief Constructs a null `tagged_ptr` with a zero tag
+        constexpr tagged_ptr() noexcept = default;
+
+        /// @brief Constructs a `tagged_ptr` from the given pointer and tag
+        /// @param ptr The pointer
+        /// @param tag The tag
+        explicit tagged_ptr(TType* ptr, tag_type tag = 0U) noexcept
+            : m_bits{pack(ptr, tag)} {
+        }
+
+        /// @brief Returns the pointer
+        /// @return The pointer
+        [[nodiscard]] auto get() const noexcept -> TType* {
+            // restore the canonical form by sign-extending the highest address bit
+            const auto shift = detail::tagged_ptr::k_tag_bits;
+            const auto address
+                = static_cast<std::uintptr_t>(static_cast<i64>(m_bits << shift) >> shift);
+            // NOLINTNEXTLINE(*-reinterpret-cast, *-no-int-to-ptr)
+            return reinterpret_cast<TType*>(address);
+        }
+
+        /// @brief Returns the tag
+        /// @return The tag
+        [[nodiscard]] constexpr auto tag() const noexcept -> tag_type {
+            return static_cast<tag_type>(m_bits >> detail::tagged_ptr::k_address_bits);
+        }
+
+        /// @brief Returns a copy of this pointing to the same address, with the given tag
+        /// @param tag The new tag
+        /// @return The retagged pointer
+        [[nodiscard]] constexpr auto with_tag(tag_type tag) const noexcept -> tagged_ptr {
+            return from_bits((m_bits & detail::tagged_ptr::k_address_mask)
+                             | (static_cast<u64>(tag) << detail::tagged_ptr::k_address_bits));
+        }
+
+        /// @brief Returns a `tagged_ptr` pointing to `ptr` whose tag is this one's incremented
+        /// by one (wrapping on overflow). Used to version successive values of an atomic
+        /// `tagged_ptr` to avoid the ABA problem.
+        /// @param ptr The new pointer
+        /// @return The next version
+        [[nodiscard]] auto next_version(TType* ptr) const noexcept -> tagged_ptr {
+            return tagged_ptr{ptr, static_cast<tag_type>(tag() + 1U)};
+        }
+
+        /// @brief Returns the packed bit representation of this
+        /// @return The packed bits
+        [[nodiscard]] constexpr auto bits() const noexcept -> u64 {
+            return m_bits;
+        }
+
+        /// @brief Creates a `tagged_ptr` from a packed bit representation previously obtained
+        /// via `bits()`
+        /// @param packed The packed bits
+        /// @return The `tagged_ptr`
+        [[nodiscard]] static constexpr auto from_bits(u64 packed) noexcept -> tagged_ptr {
+            auto ptr = tagged_ptr{};
+            ptr.m_bits = packed;
+            return ptr;
+        }
+
+        /// @brief Dereferences the pointer
+        /// @return A reference to the pointed-to object
+        /// @pre `get() != nullptr`
+        [[nodiscard]] auto operator*() const noexcept -> TType& {
+            return *get();
+        }
+
+        /// @brief Accesses members of the pointed-to object
+        /// @return The pointer
+        [[nodiscard]] auto operator->() const noexcept -> TType* {
+            return get();
+        }
+
+        friend constexpr auto
+        operator==(const tagged_ptr& lhs, const tagged_ptr& rhs) noexcept -> bool = default;
+
+      private:
+        u64 m_bits = 0_u64;
+
+        [[nodiscard]] static auto pack(TType* ptr, tag_type tag) noexcept -> u64 {
+            // NOLINTNEXTLINE(*-reinterpret-cast)
+            const auto address = static_cast<u64>(reinterpret_cast<std::uintptr_t>(ptr));
+            return (address & detail::tagged_ptr::k_address_mask)
+                   | (static_cast<u64>(tag) << detail::tagged_ptr::k_address_bits);
+        }
+    };
+
+} // namespace hyperion
+
+#if defined(HYPERION_ENABLE_TESTING) && HYPERION_ENABLE_TESTING
+
+    #include <boost/ut.hpp>
+
+    #include <atomic>
+
+namespace hyperion::_test::platform::tagged_ptr {
+
+    // NOLINTNEXTLINE(google-build-using-namespace)
+    using namespace boost::ut;
+
+    static_assert(sizeof(hyperion::tagged_ptr<int>) == sizeof(u64));
+    static_assert(std::is_trivially_copyable_v<hyperion::tagged_ptr<int>>);
+    static_assert(std::atomic<hyperion::tagged_ptr<int>>::is_always_lock_free);
+
+    // NOLINTNEXTLINE(cert-err58-cpp)
+    static const suite<"hyperion::platform::tagged_ptr"> tagged_ptr_tests = [] {
+        "pack_unpack"_test = [] {
+            auto value = 42;
+            const auto ptr = hyperion::tagged_ptr<int>{&value, static_cast<u16>(0xBEEF)};
+            expect(that % ptr.get() == &value);
+            expect(that % ptr.tag() == static_cast<u16>(0xBEEF));
+            expect(that % *ptr == 42);
+
+            const auto retagged = ptr.with_tag(static_cast<u16>(1));
+            expect(that % retagged.get() == &value);
+            expect(that % retagged.tag() == static_cast<u16>(1));
+            expect(that % retagged != ptr);
+
+            expect(that % hyperion::tagged_ptr<int>::from_bits(ptr.bits()) == ptr);
+            expect(that % hyperion::tagged_ptr<int>{}.get() == nullptr);
+        };
+
+        "versioning"_test = [] {
+            auto first = 1;
+            auto second = 2;
+            const auto ptr = hyperion::tagged_ptr<int>{&first, static_cast<u16>(0xFFFF)};
+            const auto next = ptr.next_version(&second);
+            expect(that % next.get() == &second);
+            expect(that % next.tag() == static_cast<u16>(0));
+
+            // the same address with a different version compares unequal, defeating ABA
+            std::atomic<hyperion::tagged_ptr<int>> head{ptr};
+            auto stale = ptr.with_tag(static_cast<u16>(3));
+            expect(that % !head.compare_exchange_strong(stale, next));
+            expect(that % stale == ptr);
+            expect(that % head.compare_exchange_strong(stale, next));
+            expect(that % head.load().get() == &second);
+        };
+    };
+
+} // namespace hyperion::_test::platform::tagged_ptr
+
+#endif // defined(HYPERION_ENABLE_TESTING) && HYPERION_ENABLE_TESTING
+
+#endif // HYPERION_PLATFORM_TAGGED_PTR_H
@@ -0,0 +1,844 @@
+/// @file thread_caching_allocator.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief A thread-caching, size-class allocator with cross-thread frees
+/// @version 0.4.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2024 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+#ifndef HYPERION_PLATFORM_THREAD_CACHING_ALLOCATOR_H
+#define HYPERION_PLATFORM_THREAD_CACHING_ALLOCATOR_H
+
+#include <hyperion/platform.h>
+#include <hyperion/platform/assert.h>
+#include <hyperion/platform/def.h>
+#include <hyperion/platform/futex.h>
+#include <hyperion/platform/types.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory_resource>
+#include <mutex>
+#include <new>
+#include <span>
+
+#if HYPERION_PLATFORM_COMPILER_IS_MSVC
+    #include <malloc.h>
+#endif // HYPERION_PLATFORM_COMPILER_IS_MSVC
+
+/// @ingroup platform
+/// @{
+///	@defgroup thread_caching_allocator Thread-Caching Allocator
+/// A general-purpose allocator built for workloads that allocate and free at a high rate from
+/// many threads, in particular producer/consumer pipelines where memory is allocated on one
+/// thread and freed on another.
+///
+/// Small requests, up to 16 KiB, are rounded up to one of 36 size classes. Each thread owns a
+/// heap holding a free list per size class, so the common allocation and free are a pointer
+/// pop and push with no synchronization. Objects are carved from 256 KiB segments owned by the
+/// heap that created them:
+///
+/// - Freeing an object on its owning thread pushes it on that thread's free list. When a list
+/// grows past its limit, a batch of objects is moved to a central, per-size-class free list,
+/// from which any thread with an empty list can take a whole batch under a single lock.
+/// - Freeing an object on any other thread pushes it on the owning heap's remote-free queue
+/// with a single compare-and-swap. The owner takes the whole queue back in one atomic exchange
+/// the next time one of its free lists runs empty, so memory flowing from producer to consumer
+/// is recycled to the producer without either side taking a lock.
+///
+/// When a thread exits its cached objects are returned to the central lists, and its heap,
+/// along with any objects still in flight to it, is adopted by the next new thread. Segments
+/// are retained for reuse rather than returned to the operating system.
+///
+/// Larger requests, and requests aligned to more than 4 KiB, are forwarded to the system's aligned
+/// allocation function.
+///
+/// The allocator is exposed through `thread_caching_allocate` and `thread_caching_deallocate`,
+/// as the `std::pmr::memory_resource` `thread_caching_resource`, and, optionally, as the
+/// program's global `operator new` and `operator delete` by invoking
+/// `HYPERION_THREAD_CACHING_REPLACE_GLOBAL_NEW()` at namespace scope in exactly one source file.
+///
+/// # Example
+/// @code {.cpp}
+/// auto* resource = hyperion::thread_caching_resource::instance();
+/// auto messages = std::pmr::vector<std::pmr::string>{resource};
+///
+/// // in main.cpp
+/// HYPERION_THREAD_CACHING_REPLACE_GLOBAL_NEW();
+/// @endcode
+/// @headerfile hyperion/platform/thread_caching_allocator.h
+/// @}
+
+namespace hyperion {
+
+    namespace detail::thread_caching {
+        static constexpr auto k_cache_line = static_cast<usize>(HYPERION_PLATFORM_CACHE_LINE_SIZE);
+        static constexpr auto k_segment_size = 256_usize * 1024_usize;
+        static constexpr auto k_header_size = k_cache_line;
+        static constexpr auto k_max_small_size = 16_usize * 1024_usize;
+        static constexpr auto k_max_small_alignment = 4096_usize;
+        // a large allocation's header is found by rounding its address down to its segment, so
+        // the allocation must start within the first segment-sized block of its memory
+        static constexpr auto k_max_alignment = k_segment_size / 2_usize;
+        static constexpr auto k_class_count = 36_usize;
+        static constexpr auto k_large_class = k_class_count;
+
+        /// @brief Returns the size class of a `size` byte object. Classes are spaced 16 bytes
+        /// apart up to 128 bytes, then four to each power of two
+        [[nodiscard]] constexpr auto size_class(usize size) noexcept -> usize {
+            if(size <= 128_usize) {
+                return size == 0_usize ? 0_usize : (size - 1_usize) / 16_usize;
+            }
+            const auto last = size - 1_usize;
+            const auto exponent = static_cast<usize>(std::bit_width(last)) - 1_usize;
+            const auto sub_class = (last >> (exponent - 2_usize)) - 4_usize;
+            return 8_usize + (exponent - 7_usize) * 4_usize + sub_class;
+        }
+
+        /// @brief Returns the size of the objects of size class `index`
+        [[nodiscard]] constexpr auto class_size(usize index) noexcept -> usize {
+            if(index < 8_usize) {
+                return (index + 1_usize) * 16_usize;
+            }
+            const auto exponent = 7_usize + (index - 8_usize) / 4_usize;
+            return (5_usize + (index - 8_usize) % 4_usize) << (exponent - 2_usize);
+        }
+
+        /// @brief Returns the number of objects moved to or from the central free lists at once
+        [[nodiscard]] constexpr auto batch_size(usize index) noexcept -> usize {
+            return std::clamp(32_usize * 1024_usize / class_size(index), 4_usize, 64_usize);
+        }
+
+        /// @brief Returns the offset of the first object of size class `index` in a segment.
+        /// Objects are laid out at multiples of their size from here, so it is aligned to the
+        /// largest power of two dividing the size, up to `k_max_small_alignment`, so that each
+        /// object is too
+        [[nodiscard]] constexpr auto first_offset(usize index) noexcept -> usize {
+            const auto size = class_size(index);
+            return std::clamp(size & (~size + 1_usize), k_header_size, k_max_small_alignment);
+        }
+
+        static_assert(size_class(1_usize) == 0_usize && class_size(0_usize) == 16_usize);
+        static_assert(size_class(129_usize) == 8_usize && class_size(8_usize) == 160_usize);
+        static_assert(size_class(k_max_small_size) == k_class_count - 1_usize);
+        static_assert(class_size(k_class_count - 1_usize) == k_max_small_size);
+
+        struct heap;
+
+        HYPERION_IGNORE_PADDING_WARNING_START;
+
+        /// @brief The header at the start of every segment. Large allocations are given a
+        /// segment of their own with `size_class == k_large_class`
+        struct segment {
+            heap* owner;
+            usize size_class;
+            usize object_size;
+            usize carved;
+        };
+
+        static_assert(sizeof(segment) <= k_header_size);
+
+        struct free_list {
+            void* head = nullptr;
+            usize count = 0_usize;
+        };
+
+        struct alignas(k_cache_line) heap {
+            std::array<free_list, k_class_count> lists{};
+            std::array<segment*, k_class_count> carving{};
+            heap* next = nullptr;
+            std::atomic<bool> abandoned = false;
+            // written by other threads, so kept off the owner's cache lines
+            alignas(k_cache_line) std::atomic<void*> remote = nullptr;
+        };
+
+        struct alignas(k_cache_line) central_list {
+            platform::futex_mutex mutex;
+            void* batches = nullptr;
+        };
+
+        struct global_state {
+            std::array<central_list, k_class_count> central{};
+            platform::futex_mutex registry_mutex;
+            heap* heaps = nullptr;
+        };
+
+        HYPERION_IGNORE_PADDING_WARNING_STOP;
+
+        inline constinit global_state g_state{}; // NOLINT(*-avoid-non-const-global-variables)
+        // NOLINTNEXTLINE(*-avoid-non-const-global-variables)
+        inline constinit thread_local heap* t_heap = nullptr;
+        // NOLINTNEXTLINE(*-avoid-non-const-global-variables)
+        inline constinit thread_local bool t_exited = false;
+
+        // the allocator may back the global operator new, so it only ever takes memory from the
+        // C allocation functions
+        [[nodiscard]] inline auto system_allocate(usize size, usize alignment) noexcept -> void* {
+#if HYPERION_PLATFORM_COMPILER_IS_MSVC
+            return ::_aligned_malloc(size, alignment);
+#elif HYPERION_PLATFORM_IS_UNIX
+            void* memory = nullptr;
+            return ::posix_memalign(&memory, alignment, size) == 0 ? memory : nullptr;
+#else
+            const auto rounded = (size + alignment - 1_usize) & ~(alignment - 1_usize);
+            return std::aligned_alloc(alignment, rounded);
+#endif // HYPERION_PLATFORM_COMPILER_IS_MSVC
+        }
+
+        inline auto system_free(void* memory) noexcept -> void {
+#if HYPERION_PLATFORM_COMPILER_IS_MSVC
+            ::_aligned_free(memory);
+#else
+            std::free(memory); // NOLINT(*-no-malloc, *-owning-memory)
+#endif // HYPERION_PLATFORM_COMPILER_IS_MSVC
+        }
+
+        // free objects are linked through their first word, and the first object of a batch in
+        // a central list links to the next batch through its second
+        [[nodiscard]] inline auto next_of(void* object) noexcept -> void*& {
+            return *static_cast<void**>(object);
+        }
+
+        [[nodiscard]] inline auto next_batch_of(void* object) noexcept -> void*& {
+            return static_cast<void**>(object)[1]; // NOLINT(*-pro-bounds-pointer-arithmetic)
+        }
+
+        [[nodiscard]] inline auto segment_of(const void* object) noexcept -> segment* {
+            // NOLINTBEGIN(*-pro-type-reinterpret-cast, performance-no-int-to-ptr)
+            return reinterpret_cast<segment*>(reinterpret_cast<std::uintptr_t>(object)
+                                              & ~(k_segment_size - 1_usize));
+            // NOLINTEND(*-pro-type-reinterpret-cast, performance-no-int-to-ptr)
+        }
+
+        inline auto push(free_list& list, void* object) noexcept -> void {
+            next_of(object) = list.head;
+            list.head = object;
+            ++list.count;
+        }
+
+        /// @brief Moves up to a batch of objects from `list` to its central list
+        inline auto flush_batch(free_list& list, usize index) noexcept -> void {
+            auto* const first = list.head;
+            auto* last = first;
+            auto count = 1_usize;
+            for(; count < batch_size(index) && next_of(last) != nullptr; ++count) {
+                last = next_of(last);
+            }
+            list.head = next_of(last);
+            list.count -= count;
+            next_of(last) = nullptr;
+
+            auto& central = g_state.central[index]; // NOLINT(*-pro-bounds-constant-array-index)
+            const auto guard = std::scoped_lock{central.mutex};
+            next_batch_of(first) = central.batches;
+            central.batches = first;
+        }
+
+        /// @brief Moves everything in `owner`'s remote-free queue to its free lists
+        inline auto drain_remote(heap& owner) noexcept -> void {
+            if(owner.remote.load(std::memory_order_relaxed) == nullptr) {
+                return;
+            }
+            auto* object = owner.remote.exchange(nullptr, std::memory_order_acquire);
+            while(object != nullptr) {
+                auto* const next = next_of(object);
+                // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                push(owner.lists[segment_of(object)->size_class], object);
+                object = next;
+            }
+        }
+
+        struct thread_guard {
+            bool armed = false;
+
+            constexpr thread_guard() noexcept = default;
+            thread_guard(const thread_guard&) = delete;
+            thread_guard(thread_guard&&) = delete;
+            ~thread_guard() noexcept;
+            auto operator=(const thread_guard&) -> thread_guard& = delete;
+            auto operator=(thread_guard&&) -> thread_guard& = delete;
+        };
+
+        inline thread_local thread_guard t_guard; // NOLINT(*-avoid-non-const-global-variables)
+
+        /// @brief Gives the calling thread a heap, adopting one abandoned by an exited thread
+        /// if there is one
+        [[nodiscard]] inline auto acquire_heap() noexcept -> heap* {
+            if(t_exited) {
+                return nullptr;
+            }
+
+            auto* adopted = static_cast<heap*>(nullptr);
+            {
+                const auto guard = std::scoped_lock{g_state.registry_mutex};
+                for(auto* current = g_state.heaps; current != nullptr; current = current->next) {
+                    if(current->abandoned.load(std::memory_order_relaxed)) {
+                        current->abandoned.store(false, std::memory_order_relaxed);
+                        adopted = current;
+                        break;
+                    }
+                }
+
+                if(adopted == nullptr) {
+                    auto* const memory = system_allocate(sizeof(heap), alignof(heap));
+                    if(memory == nullptr) {
+                        return nullptr;
+                    }
+                    adopted = new(memory) heap{};
+                    adopted->next = g_state.heaps;
+                    g_state.heaps = adopted;
+                }
+            }
+
+            t_guard.armed = true;
+            t_heap = adopted;
+            return adopted;
+        }
+
+        inline thread_guard::~thread_guard() noexcept {
+            auto* const owner = t_heap;
+            t_heap = nullptr;
+            t_exited = true;
+            if(owner == nullptr) {
+                return;
+            }
+
+            drain_remote(*owner);
+            for(auto index = 0_usize; index < k_class_count; ++index) {
+                // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                auto& list = owner->lists[index];
+                while(list.head != nullptr) {
+                    flush_batch(list, index);
+                }
+            }
+            const auto guard = std::scoped_lock{g_state.registry_mutex};
+            owner->abandoned.store(true, std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] inline auto allocate_large(usize size, usize alignment) noexcept -> void* {
+            const auto offset = std::max(k_header_size, alignment);
+            if(alignment > k_max_alignment || size > static_cast<usize>(-1) - offset) {
+                return nullptr;
+            }
+            auto* const memory = system_allocate(offset + size, k_segment_size);
+            if(memory == nullptr) {
+                return nullptr;
+            }
+            new(memory) segment{nullptr, k_large_class, size, 0_usize};
+            return static_cast<std::byte*>(memory) + offset; // NOLINT(*-pointer-arithmetic)
+        }
+
+        /// @brief Takes an object of size class `index` once `owner`'s free list is empty
+        [[nodiscard]] inline auto refill(heap& owner, usize index) noexcept -> void* {
+            auto& list = owner.lists[index]; // NOLINT(*-pro-bounds-constant-array-index)
+            drain_remote(owner);
+
+            if(list.head == nullptr) {
+                auto& central = g_state.central[index]; // NOLINT(*-constant-array-index)
+                {
+                    const auto guard = std::scoped_lock{central.mutex};
+                    list.head = central.batches;
+                    if(list.head != nullptr) {
+                        central.batches = next_batch_of(list.head);
+                    }
+                }
+                for(auto* object = list.head; object != nullptr; object = next_of(object)) {
+                    ++list.count;
+                }
+            }
+
+            if(list.head != nullptr) {
+                auto* const object = list.head;
+                list.head = next_of(object);
+                --list.count;
+                return object;
+            }
+
+            // carve a fresh object from the class's current segment
+            const auto size = class_size(index);
+            auto*& current = owner.carving[index]; // NOLINT(*-pro-bounds-constant-array-index)
+            if(current == nullptr || current->carved + size > k_segment_size) {
+                auto* const memory = system_allocate(k_segment_size, k_segment_size);
+                if(memory == nullptr) {
+                    return nullptr;
+                }
+                current = new(memory) segment{&owner, index, size, first_offset(index)};
+            }
+            // NOLINTNEXTLINE(*-pro-bounds-pointer-arithmetic)
+            auto* const object = reinterpret_cast<std::byte*>(current) + current->carved;
+            current->carved += size;
+            return object;
+        }
+
+        [[nodiscard]] inline auto allocate_small(usize index) noexcept -> void* {
+            auto* owner = t_heap;
+            if(owner == nullptr) [[unlikely]] {
+                owner = acquire_heap();
+                if(owner == nullptr) {
+                    // the thread is exiting; give it memory that does not need a heap
+                    return allocate_large(class_size(index), k_header_size);
+                }
+            }
+
+            auto& list = owner->lists[index]; // NOLINT(*-pro-bounds-constant-array-index)
+            if(auto* const object = list.head; object != nullptr) [[likely]] {
+                list.head = next_of(object);
+                --list.count;
+                return object;
+            }
+            return refill(*owner, index);
+        }
+    } // namespace detail::thread_caching
+
+    /// @brief Allocates `size` bytes aligned to `alignment` from the thread-caching allocator
+    ///
+    /// # Requirements
+    /// - `alignment` is a power of two
+    ///
+    /// @param size The number of bytes to allocate
+    /// @param alignment The alignment of the allocation. At most 128 KiB
+    /// @return The memory, or `nullptr` if it could not be allocated or `alignment` is larger
+    /// than 128 KiB
+    /// @ingroup thread_caching_allocator
+    /// @headerfile hyperion/platform/thread_caching_allocator.h
+    [[nodiscard]] inline auto
+    thread_caching_allocate(usize size, usize alignment = alignof(std::max_align_t)) noexcept
+        -> void* {
+        using namespace detail::thread_caching; // NOLINT(google-build-using-namespace)
+        HYPERION_DEBUG_ASSERT(alignment != 0_usize && (alignment & (alignment - 1_usize)) == 0,
+                              "allocation alignment must be a power of two");
+
+        if(size <= k_max_small_size) [[likely]] {
+            if(alignment <= 16_usize) [[likely]] {
+                return allocate_small(size_class(size));
+            }
+            // objects are aligned to the largest power of two dividing their size, so a class
+            // whose size is a multiple of the alignment satisfies it
+            if(alignment <= k_max_small_alignment) {
+                for(auto index = size_class(std::max(size, alignment)); index < k_class_count;
+                    ++index)
+                {
+                    if(class_size(index) % alignment == 0_usize) {
+                        return allocate_small(index);
+                    }
+                }
+            }
+        }
+        return allocate_large(size, alignment);
+    }
+
+    /// @brief Returns memory allocated by `thread_caching_allocate` to the allocator. May be
+    /// called from any thread
+    /// @param memory The memory to free. May be `nullptr`
+    /// @ingroup thread_caching_allocator
+    /// @headerfile hyperion/platform/thread_caching_allocator.h
+    inline auto thread_caching_deallocate(void* memory) noexcept -> void {
+        using namespace detail::thread_caching; // NOLINT(google-build-using-namespace)
+        if(memory == nullptr) {
+            return;
+        }
+
+        auto* const segment = segment_of(memory);
+        if(segment->size_class == k_large_class) [[unlikely]] {
+            system_free(segment);
+            return;
+        }
+
+        auto* const owner = segment->owner;
+        if(owner == t_heap) [[likely]] {
+            // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+            auto& list = owner->lists[segment->size_class];
+            push(list, memory);
+            if(list.count > 2_usize * batch_size(segment->size_class)) [[unlikely]] {
+                flush_batch(list, segment->size_class);
+            }
+            return;
+        }
+
+        auto* head = owner->remote.load(std::memory_order_relaxed);
+        do {
+            next_of(memory) = head;
+        } while(!owner->remote.compare_exchange_weak(head,
+                                                     memory,
+                                                     std::memory_order_release,
+                                                     std::memory_order_relaxed));
+    }
+
+    /// @brief Returns the number of usable bytes in an allocation made by
+    /// `thread_caching_allocate`, which is at least the requested size
+    /// @param memory The allocation
+    /// @return The usable size of `memory`, in bytes
+    /// @ingroup thread_caching_allocator
+    /// @headerfile hyperion/platform/thread_caching_allocator.h
+    [[nodiscard]] inline auto thread_caching_usable_size(const void* memory) noexcept -> usize {
+        const auto* const segment = detail::thread_caching::segment_of(memory);
+        return segment->size_class == detail::thread_caching::k_large_class
+                   ? segment->object_size
+                   : detail::thread_caching::class_size(segment->size_class);
+    }
+
+    /// @brief A `std::pmr::memory_resource` allocating from the thread-caching allocator.
+    ///
+    /// All instances share the same allocator, so memory allocated through one may be freed
+    /// through any other, on any thread.
+    /// @ingroup thread_caching_allocator
+    /// @headerfile hyperion/platform/thread_caching_allocator.h
+    class thread_caching_resource final : public std::pmr::memory_resource {
+      public:
+        /// @brief Returns the process-wide instance
+        /// @return The resource
+        [[nodiscard]] static auto instance() noexcept -> thread_caching_resource* {
+            static auto resource = thread_caching_resource{};
+            return &resource;
+        }
+
+      private:
+        [[nodiscard]] auto do_allocate(usize bytes, usize alignment) -> void* override {
+            auto* const memory = thread_caching_allocate(bytes, alignment);
+            if(memory == nullptr) {
+                throw std::bad_alloc{};
+            }
+            return memory;
+        }
+
+        auto do_deallocate(void* memory,
+                           [[maybe_unused]] usize bytes,
+                           [[maybe_unused]] usize alignment) -> void override {
+            thread_caching_deallocate(memory);
+        }
+
+        [[nodiscard]] auto
+        do_is_equal(const std::pmr::memory_resource& other) const noexcept -> bool override {
+            return dynamic_cast<const thread_caching_resource*>(&other) != nullptr;
+        }
+    };
+
+    namespace detail::thread_caching {
+        // implements the throwing `operator new`s, which call the new handler until the
+        // allocation succeeds
+        [[nodiscard]] inline auto operator_new(usize size, usize alignment) -> void* {
+            while(true) {
+                if(auto* const memory = thread_caching_allocate(size, alignment);
+                   memory != nullptr)
+                {
+                    return memory;
+                }
+                auto* const handler = std::get_new_handler();
+                if(handler == nullptr) {
+                    throw std::bad_alloc{};
+                }
+                handler();
+            }
+        }
+
+        [[nodiscard]] inline auto operator_new_nothrow(usize size, usize alignment) noexcept
+            -> void* {
+            try {
+                return operator_new(size, alignment);
+            }
+            catch(...) {
+                return nullptr;
+            }
+        }
+    } // namespace detail::thread_caching
+
+} // namespace hyperion
+
+/// @def HYPERION_THREAD_CACHING_REPLACE_GLOBAL_NEW
+/// @brief Replaces the program's global `operator new` and `operator delete` with the
+/// thread-caching allocator. Invoke it at global namespace scope in exactly one source file
+/// @ingroup thread_caching_allocator
+/// @headerfile hyperion/platform/thread_caching_allocator.h
+
+// clang-format off
+
+// NOLINTBEGIN(cppcoreguidelines-macro-usage)
+#define HYPERION_THREAD_CACHING_REPLACE_GLOBAL_NEW()                                              \
+    auto operator new(std::size_t size) -> void* {                                               \
+        return hyperion::detail::thread_caching::operator_new(size, alignof(std::max_align_t));  \
+    }                                                                                             \
+    auto operator new[](std::size_t size) -> void* {                                             \
+        return hyperion::detail::thread_caching::operator_new(size, alignof(std::max_align_t));  \
+    }                                                                                             \
+    auto operator new(std::size_t size, std::align_val_t alignment) -> void* {                   \
+        return hyperion::detail::thread_caching::operator_new(                                    \
+            size, static_cast<std::size_t>(alignment));                                           \
+    }                                                                                             \
+    auto operator new[](std::size_t size, std::align_val_t alignment) -> void* {                 \
+        return hyperion::detail::thread_caching::operator_new(                                    \
+            size, static_cast<std::size_t>(alignment));                                           \
+    }                                                                                             \
+    auto operator new(std::size_t size, const std::nothrow_t&) noexcept -> void* {               \
+        return hyperion::detail::thread_caching::operator_new_nothrow(size,                      \
+                                                                      alignof(std::max_align_t)); \
+    }                                                                                             \
+    auto operator new[](std::size_t size, const std::nothrow_t&) noexcept -> void* {             \
+        return hyperion::detail::thread_caching::operator_new_nothrow(size,                      \
+                                                                      alignof(std::max_align_t)); \
+    }                                                                                             \
+    auto operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&)       \
+        noexcept -> void* {                                                                       \
+        return hyperion::detail::thread_caching::operator_new_nothrow(                           \
+            size, static_cast<std::size_t>(alignment));                                           \
+    }                                                                                             \
+    auto operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&)     \
+        noexcept -> void* {                                                                       \
+        return hyperion::detail::thread_caching::operator_new_nothrow(                           \
+            size, static_cast<std::size_t>(alignment));                                           \
+    }                                                                                             \
+    auto operator delete(void* memory) noexcept -> void {                                        \
+        hyperion::thread_caching_deallocate(memory);                                              \
+    }                                                                                             \
+    auto operator delete[](void* memory) noexcept -> void {                                      \
+        hyperion::thread_caching_deallocate(memory);                                              \
+    }                                                                                             \
+    auto operator delete(void* memory, std::size_t) noexcept -> void {                           \
+        hyperion::thread_caching_deallocate(memory);                                              \
+    }                                                                                             \
+    auto operator delete[](void* memory, std::size_t) noexcept -> void {                         \
+        hyperion::thread_caching_deallocate(memory);                                              \
+    }                                                                                             \
+    auto operator delete(void* memory, std::align_val_t) noexcept -> void {                      \
+        hyperion::thread_caching_deallocate(memory);                                              \
+    }                                                                                             \
+    auto operator delete[](void* memory, std::align_val_t) noexcept -> void {                    \
+        hyperion::thread_caching_deallocate(memory);                                              \
+    }                                                                                             \
+    auto operator delete(void* memory, std::size_t, std::align_val_t) noexcept -> void {         \
+        hyperion::thread_caching_deallocate(memory);                                              \
+    }                                                                                             \
+    auto operator delete[](void* memory, std::size_t, std::align_val_t) noexcept -> void {       \
+        hyperion::thread_caching_deallocate(memory);                                              \
+    }                                                                                             \
+    auto operator delete(void* memory, const std::nothrow_t&) noexcept -> void {                 \
+        hyperion::thread_caching_deallocate(memory);                                              \
+    }                                                                                             \
+    auto operator delete[](void* memory, const std::nothrow_t&) noexcept -> void {               \
+        hyperion::thread_caching_deallocate(memory);                                              \
+    }                                                                                             \
+    auto operator delete(void* memory, std::align_val_t, const std::nothrow_t&) noexcept -> void { \
+        hyperion::thread_caching_deallocate(memory);                                              \
+    }                                                                                             \
+    auto operator delete[](void* memory, std::align_val_t, const std::nothrow_t&) noexcept       \
+        -> void {                                                                                 \
+        hyperion::thread_caching_deallocate(memory);                                              \
+    }                                                                                             \
+    static_assert(true, "")
+// NOLINTEND(cppcoreguidelines-macro-usage)
+
+// clang-format on
+
+#if defined(HYPERION_ENABLE_TESTING) && HYPERION_ENABLE_TESTING
+
+    #include <boost/ut.hpp>
+
+    #include <deque>
+    #include <string>
+    #include <thread>
+    #include <unordered_set>
+    #include <vector>
+
+namespace hyperion::_test::platform::thread_caching_allocator {
+
+    // NOLINTNEXTLINE(google-build-using-namespace)
+    using namespace boost::ut;
+
+    // NOLINTNEXTLINE(cert-err58-cpp)
+    static const suite<"hyperion::platform::thread_caching_allocator">
+        thread_caching_allocator_tests = [] {
+            "size_classes"_test = [] {
+                using namespace hyperion::detail::thread_caching; // NOLINT
+                auto monotonic = true;
+                for(auto size = 1_usize; size <= k_max_small_size; ++size) {
+                    const auto index = size_class(size);
+                    monotonic = monotonic && class_size(index) >= size
+                                && (index == 0_usize || class_size(index - 1_usize) < size);
+                }
+                expect(monotonic);
+            };
+
+            "allocate_and_free"_test = [] {
+                auto allocations = std::vector<std::pair<std::byte*, usize>>{};
+                for(auto size = 0_usize; size < 70'000_usize;
+                    size = size * 3_usize / 2_usize + 1_usize)
+                {
+                    auto* const memory = static_cast<std::byte*>(thread_caching_allocate(size));
+                    expect(memory != nullptr);
+                    expect(that % thread_caching_usable_size(memory) >= size);
+                    std::fill_n(memory, size, static_cast<std::byte>(size));
+                    allocations.emplace_back(memory, size);
+                }
+                auto intact = true;
+                for(const auto& [memory, size] : allocations) {
+                    const auto bytes = std::span{memory, size};
+                    intact = intact && std::all_of(bytes.begin(), bytes.end(), [size](auto value) {
+                                 return value == static_cast<std::byte>(size);
+                             });
+                    thread_caching_deallocate(memory);
+                }
+                expect(intact);
+                thread_caching_deallocate(nullptr);
+            };
+
+            "alignment"_test = [] {
+                auto aligned = true;
+                for(auto alignment = 1_usize; alignment <= 16_usize * 1024_usize;
+                    alignment *= 2_usize)
+                {
+                    for(const auto size : {1_usize, 24_usize, 100_usize, 5'000_usize, 40'000_usize})
+                    {
+                        auto* const memory = thread_caching_allocate(size, alignment);
+                        // NOLINTNEXTLINE(*-pro-type-reinterpret-cast)
+                        aligned = aligned && memory != nullptr
+                                  && reinterpret_cast<std::uintptr_t>(memory) % alignment == 0U;
+                        thread_caching_deallocate(memory);
+                    }
+                }
+                expect(aligned);
+
+                auto* const largest = thread_caching_allocate(64_usize, 128_usize * 1024_usize);
+                // NOLINTNEXTLINE(*-pro-type-reinterpret-cast)
+                expect(largest != nullptr
+                       && reinterpret_cast<std::uintptr_t>(largest) % (128U * 1024U) == 0U);
+                thread_caching_deallocate(largest);
+                expect(that % thread_caching_allocate(64_usize, 256_usize * 1024_usize) == nullptr);
+            };
+
+            "local_reuse"_test = [] {
+                auto* const first = thread_caching_allocate(48_usize);
+                thread_caching_deallocate(first);
+                auto* const second = thread_caching_allocate(48_usize);
+                expect(that % second == first);
+                thread_caching_deallocate(second);
+            };
+
+            "remote_free"_test = [] {
+                // a size class used by no other test, so the producer's lists hold only these
+                static constexpr auto size = 3000_usize;
+                static constexpr auto count = 500_usize;
+                auto first = std::vector<void*>{};
+                auto reused = 0_usize;
+                std::jthread{[&] {
+                    for(auto index = 0_usize; index < count; ++index) {
+                        first.push_back(thread_caching_allocate(size));
+                    }
+                    std::jthread{[&] {
+                        for(auto* memory : first) {
+                            thread_caching_deallocate(memory);
+                        }
+                    }}.join();
+
+                    const auto freed = std::unordered_set<void*>{first.begin(), first.end()};
+                    auto second = std::vector<void*>{};
+                    for(auto index = 0_usize; index < count; ++index) {
+                        second.push_back(thread_caching_allocate(size));
+                        reused += freed.contains(second.back()) ? 1_usize : 0_usize;
+                    }
+                    for(auto* memory : second) {
+                        thread_caching_deallocate(memory);
+                    }
+                }}.join();
+                expect(that % reused == count);
+            };
+
+            "producer_consumer"_test = [] {
+                auto mutex = std::mutex{};
+                auto queue = std::deque<std::pair<u8*, usize>>{};
+                auto done = 0_usize;
+                auto corrupted = 0_usize;
+                static constexpr auto producers = 3_usize;
+
+                auto consumer = std::jthread{[&] {
+                    while(true) {
+                        auto item = std::pair<u8*, usize>{};
+                        {
+                            const auto guard = std::scoped_lock{mutex};
+                            if(queue.empty()) {
+                                if(done == producers) {
+                                    return;
+                                }
+                                continue;
+                            }
+                            item = queue.front();
+                            queue.pop_front();
+                        }
+                        const auto [memory, size] = item;
+                        for(auto index = 0_usize; index < size; ++index) {
+                            // NOLINTNEXTLINE(*-pro-bounds-pointer-arithmetic)
+                            corrupted += memory[index] != static_cast<u8>(size + index) ? 1 : 0;
+                        }
+                        thread_caching_deallocate(memory);
+                    }
+                }};
+
+                {
+                    auto workers = std::vector<std::jthread>{};
+                    for(auto producer = 0_usize; producer < producers; ++producer) {
+                        workers.emplace_back([&, producer] {
+                            for(auto index = 0_usize; index < 5'000_usize; ++index) {
+                                const auto size
+                                    = (index * 37_usize + producer) % 2'000_usize + 1_usize;
+                                auto* const memory
+                                    = static_cast<u8*>(thread_caching_allocate(size));
+                                for(auto offset = 0_usize; offset < size; ++offset) {
+                                    // NOLINTNEXTLINE(*-pro-bounds-pointer-arithmetic)
+                                    memory[offset] = static_cast<u8>(size + offset);
+                                }
+                                const auto guard = std::scoped_lock{mutex};
+                                queue.emplace_back(memory, size);
+                            }
+                            const auto guard = std::scoped_lock{mutex};
+                            ++done;
+                        });
+                    }
+                }
+                consumer.join();
+                expect(that % corrupted == 0_usize);
+            };
+
+            "memory_resource"_test = [] {
+                auto* const resource = thread_caching_resource::instance();
+                auto strings = std::pmr::vector<std::pmr::string>{resource};
+                for(auto index = 0_usize; index < 1'000_usize; ++index) {
+                    strings.emplace_back(std::string(index % 100_usize, 'x'));
+                }
+                expect(that % strings.back().size() == 99_usize);
+                expect(resource->is_equal(*thread_caching_resource::instance()));
+
+                auto* const aligned = resource->allocate(100_usize, 64_usize);
+                // NOLINTNEXTLINE(*-pro-type-reinterpret-cast)
+                expect(that % (reinterpret_cast<std::uintptr_t>(aligned) % 64U) == 0U);
+                resource->deallocate(aligned, 100_usize, 64_usize);
+            };
+        };
+
+} // namespace hyperion::_test::platform::thread_caching_allocator
+
+#endif // defined(HYPERION_ENABLE_TESTING) && HYPERION_ENABLE_TESTING
+
+#endif // HYPERION_PLATFORM_THREAD_CACHING_ALLOCATOR_H
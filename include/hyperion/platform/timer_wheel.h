@@ -0,0 +1,669 @@
+/// @file timer_wheel.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Hierarchical hashed timer wheel for large numbers of timeouts
+/// @version 0.4.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2024 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef HYPERION_PLATFORM_TIMER_WHEEL_H
+#define HYPERION_PLATFORM_TIMER_WHEEL_H
+
+#include <hyperion/platform.h>
+#include <hyperion/platform/def.h>
+#include <hyperion/platform/types.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <concepts>
+#include <limits>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/// @ingroup platform
+/// @{
+///	@defgroup timer_wheel Timer Wheel
+/// `hyperion::timer_wheel<TPayload>` schedules large numbers of timeouts with O(1) insertion
+/// and cancellation, and processes expired timers in batches.
+///
+/// Time is divided into ticks of a fixed resolution, and pending timers are hashed into the
+/// slots of a hierarchy of wheels by their expiry tick: timers due within the next 64 ticks
+/// live in the first wheel, those due within the next 64² ticks in the second, and so on.
+/// As time advances, the slots of the outer wheels are cascaded into the inner ones, so each
+/// timer is touched at most once per wheel over its lifetime, independent of the number of
+/// pending timers. Empty slots are skipped using per-wheel occupancy bitmaps, so advancing
+/// over long idle periods is cheap.
+///
+/// A `timer_wheel` is driven explicitly by calling `advance` with the current time, which
+/// makes it straightforward to integrate into an event loop (using `next_expiry` to bound the
+/// loop's poll timeout) or a thread pool (by submitting expired payloads as tasks).
+///
+/// # Example
+/// @code {.cpp}
+/// hyperion::timer_wheel<connection_id> timeouts{std::chrono::milliseconds{1}};
+///
+/// const auto timeout = timeouts.schedule_after(std::chrono::seconds{30}, connection.id());
+/// // ... if the connection completes in time
+/// timeouts.cancel(timeout);
+///
+/// // in the event loop
+/// while(running) {
+///     const auto deadline = timeouts.next_expiry();
+///     poll_for_events(deadline);
+///     timeouts.advance(std::chrono::steady_clock::now(), [&](auto, connection_id id) {
+///         pool.submit([id]() { close_connection(id); });
+///     });
+/// }
+/// @endcode
+/// @headerfile hyperion/platform/timer_wheel.h
+/// @}
+
+namespace hyperion {
+
+    /// @brief Identifies a timer scheduled on a `timer_wheel`. Remains safe to use with
+    /// `timer_wheel::cancel` after the timer has expired or been cancelled.
+    /// @ingroup timer_wheel
+    /// @headerfile hyperion/platform/timer_wheel.h
+    struct timer_id {
+        /// @brief The index of the timer's storage in the wheel
+        u32 index = std::numeric_limits<u32>::max();
+        /// @brief The generation of the timer's storage at the time it was scheduled
+        u32 generation = 0_u32;
+
+        friend constexpr auto
+        operator==(const timer_id& lhs, const timer_id& rhs) noexcept -> bool = default;
+    };
+
+    namespace detail::timer_wheel {
+        static inline constexpr auto k_slot_bits = 6_u64;
+        static inline constexpr auto k_slots = 1_usize << k_slot_bits;
+        static inline constexpr auto k_slot_mask = static_cast<u64>(k_slots) - 1_u64;
+        static inline constexpr auto k_levels = 6_usize;
+        static inline constexpr auto k_max_delta = (1_u64 << (k_slot_bits * k_levels)) - 1_u64;
+        static inline constexpr auto k_null = std::numeric_limits<u32>::max();
+        // the list of expired timers currently being delivered
+        static inline constexpr auto k_batch_level = static_cast<u8>(k_levels);
+    } // namespace detail::timer_wheel
+
+    /// @brief A hierarchical hashed timer wheel holding timers carrying a `TPayload`.
+    ///
+    /// Timers never expire early: a timer scheduled for a deadline is delivered by the first
+    /// call to `advance` with a time at or after the end of the tick containing that deadline.
+    /// Timers whose deadline has already passed are delivered on the next tick.
+    ///
+    /// `timer_wheel` is not thread-safe; it is intended to be owned by a single event loop or
+    /// timer thread.
+    ///
+    /// @tparam TPayload The type of the data associated with each timer, such as a connection
+    /// ID or a callback
+    /// @tparam TClock The clock the wheel's time points are measured with
+    /// @ingroup timer_wheel
+    /// @headerfile hyperion/platform/timer_wheel.h
+    template<typename TPayload, typename TClock = std::chrono::steady_clock>
+        requires std::move_constructible<TPayload> && std::chrono::is_clock_v<TClock>
+    class timer_wheel {
+      public:
+        /// @brief The clock the wheel's time points are measured with
+        using clock = TClock;
+        /// @brief The time point type of `clock`
+        using time_point = typename TClock::time_point;
+        /// @brief The duration type of `clock`
+        using duration = typename TClock::duration;
+
+        /// @brief Constructs an empty `timer_wheel`
+        /// @param resolution The length of one tick, which bounds how late a timer may be
+        /// delivered
+        /// @param start The time at which the wheel starts
+        /// @pre `resolution > duration::zero()`
+        explicit timer_wheel(duration resolution = std::chrono::milliseconds{1},
+                             time_point start = TClock::now())
+            : m_resolution{resolution}, m_start{start} {
+            for(auto& level : m_heads) {
+                level.fill(detail::timer_wheel::k_null);
+            }
+        }
+
+        timer_wheel(const timer_wheel&) = delete;
+        timer_wheel(timer_wheel&&) noexcept = default;
+        ~timer_wheel() noexcept = default;
+        auto operator=(const timer_wheel&) -> timer_wheel& = delete;
+        auto operator=(timer_wheel&&) noexcept -> timer_wheel& = default;
+
+        /// @brief Schedules a timer to expire at `deadline`. O(1).
+        /// @param deadline The time at which the timer expires
+        /// @param payload The data to deliver when the timer expires
+        /// @return The ID of the scheduled timer
+        auto schedule_at(time_point deadline, TPayload payload) -> timer_id {
+            const auto index = allocate_node(std::move(payload));
+            auto& node = m_nodes[index];
+            node.expiry = ticks_ceil(deadline);
+            place(index, m_now + 1_u64);
+            ++m_size;
+            return timer_id{index, node.generation};
+        }
+
+        /// @brief Schedules a timer to expire `delay` after the wheel's current time (the time
+        /// passed to the last call to `advance`, rounded down to a tick). O(1).
+        /// @param delay The delay after which the timer expires
+        /// @param payload The data to deliver when the timer expires
+        /// @return The ID of the scheduled timer
+        auto schedule_after(duration delay, TPayload payload) -> timer_id {
+            return schedule_at(now() + delay, std::move(payload));
+        }
+
+        /// @brief Cancels the timer identified by `id`, if it is still pending. O(1).
+        /// @param id The ID of the timer to cancel
+        /// @return Whether the timer was pending and has been cancelled
+        auto cancel(timer_id id) noexcept -> bool {
+            if(id.index >= m_nodes.size()) {
+                return false;
+            }
+
+            auto& node = m_nodes[id.index];
+            if(!node.payload.has_value() || node.generation != id.generation) {
+                return false;
+            }
+
+            unlink(id.index);
+            free_node(id.index);
+            --m_size;
+            return true;
+        }
+
+        /// @brief Advances the wheel to `current_time`, delivering every timer that has expired
+        /// by invoking `on_expired` with its ID and payload.
+        ///
+        /// Timers are delivered in batches, one slot at a time, in order of their expiry tick.
+        /// `on_expired` may schedule and cancel timers (including others in the same batch),
+        /// but must not call `advance`. If `on_expired` throws, the exception is propagated and
+        /// any remaining expired timers are delivered by the next call to `advance`.
+        ///
+        /// @tparam TFunc The type of the expiry handler
+        /// @param current_time The current time
+        /// @param on_expired The function to invoke for each expired timer
+        /// @return The number of timers delivered
+        template<typename TFunc>
+            requires std::invocable<TFunc&, timer_id, TPayload&&>
+        auto advance(time_point current_time, TFunc&& on_expired) -> usize {
+            const auto target = std::max(ticks_floor(current_time), m_now);
+            auto delivered = deliver_batch(on_expired);
+
+            while(m_size != 0_usize) {
+                const auto next = next_event_tick();
+                if(next > target) {
+                    break;
+                }
+
+                m_now = next;
+                cascade();
+                batch_slot(static_cast<usize>(m_now & detail::timer_wheel::k_slot_mask));
+                delivered += deliver_batch(on_expired);
+            }
+
+            m_now = target;
+            return delivered;
+        }
+
+        /// @brief Returns the earliest time at which `advance` may have work to do, either
+        /// delivering expired timers or cascading them from an outer wheel. An event loop can
+        /// sleep until this time without delivering any timer late.
+        /// @return The time of the next event, or `std::nullopt` if no timers are pending
+        [[nodiscard]] auto next_expiry() const noexcept -> std::optional<time_point> {
+            if(m_size == 0_usize) {
+                return std::nullopt;
+            }
+
+            if(m_batch_head != detail::timer_wheel::k_null) {
+                return now();
+            }
+
+            return to_time_point(next_event_tick());
+        }
+
+        /// @brief Returns the wheel's current time: the time passed to the last call to
+        /// `advance`, rounded down to a tick
+        /// @return The current time
+        [[nodiscard]] auto now() const noexcept -> time_point {
+            return to_time_point(m_now);
+        }
+
+        /// @brief Returns the length of one tick
+        /// @return The resolution
+        [[nodiscard]] auto resolution() const noexcept -> duration {
+            return m_resolution;
+        }
+
+        /// @brief Returns the number of pending timers
+        /// @return The number of pending timers
+        [[nodiscard]] auto size() const noexcept -> usize {
+            return m_size;
+        }
+
+        /// @brief Returns whether there are no pending timers
+        /// @return Whether the wheel is empty
+        [[nodiscard]] auto empty() const noexcept -> bool {
+            return m_size == 0_usize;
+        }
+
+        /// @brief Reserves storage for `capacity` timers, so that scheduling up to that many
+        /// never allocates
+        /// @param capacity The number of timers to reserve storage for
+        auto reserve(usize capacity) -> void {
+            m_nodes.reserve(capacity);
+        }
+
+      private:
+        struct timer_node {
+            std::optional<TPayload> payload;
+            u64 expiry = 0_u64;
+            u32 prev = detail::timer_wheel::k_null;
+            u32 next = detail::timer_wheel::k_null;
+            u32 generation = 0_u32;
+            u8 level = 0;
+            u8 slot = 0;
+        };
+
+        using slot_heads = std::array<u32, detail::timer_wheel::k_slots>;
+
+        duration m_resolution;
+        time_point m_start;
+        // the last tick that has been fully processed
+        u64 m_now = 0_u64;
+        usize m_size = 0_usize;
+        std::vector<timer_node> m_nodes;
+        u32 m_free_head = detail::timer_wheel::k_null;
+        u32 m_batch_head = detail::timer_wheel::k_null;
+        std::array<slot_heads, detail::timer_wheel::k_levels> m_heads = {};
+        std::array<u64, detail::timer_wheel::k_levels> m_occupied = {};
+
+        [[nodiscard]] auto ticks_floor(time_point time) const noexcept -> u64 {
+            if(time <= m_start) {
+                return 0_u64;
+            }
+
+            return static_cast<u64>((time - m_start) / m_resolution);
+        }
+
+        [[nodiscard]] auto ticks_ceil(time_point time) const noexcept -> u64 {
+            if(time <= m_start) {
+                return 0_u64;
+            }
+
+            const auto elapsed = time - m_start;
+            const auto ticks = static_cast<u64>(elapsed / m_resolution);
+            return elapsed % m_resolution == duration::zero() ? ticks : ticks + 1_u64;
+        }
+
+        [[nodiscard]] auto to_time_point(u64 tick) const noexcept -> time_point {
+            return m_start + m_resolution * static_cast<typename duration::rep>(tick);
+        }
+
+        [[nodiscard]] auto allocate_node(TPayload&& payload) -> u32 {
+            if(m_free_head != detail::timer_wheel::k_null) {
+                const auto index = m_free_head;
+                auto& node = m_nodes[index];
+                m_free_head = node.next;
+                node.payload.emplace(std::move(payload));
+                return index;
+            }
+
+            const auto index = static_cast<u32>(m_nodes.size());
+            m_nodes.push_back(timer_node{.payload = std::move(payload)});
+            return index;
+        }
+
+        auto free_node(u32 index) noexcept -> void {
+            auto& node = m_nodes[index];
+            node.payload.reset();
+            ++node.generation;
+            node.prev = detail::timer_wheel::k_null;
+            node.next = m_free_head;
+            m_free_head = index;
+        }
+
+        [[nodiscard]] auto head_of(u8 level, u8 slot) noexcept -> u32& {
+            if(level == detail::timer_wheel::k_batch_level) {
+                return m_batch_head;
+            }
+
+            // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+            return m_heads[level][slot];
+        }
+
+        auto link(u32 index, u8 level, u8 slot) noexcept -> void {
+            auto& head = head_of(level, slot);
+            auto& node = m_nodes[index];
+            node.level = level;
+            node.slot = slot;
+            node.prev = detail::timer_wheel::k_null;
+            node.next = head;
+            if(head != detail::timer_wheel::k_null) {
+                m_nodes[head].prev = index;
+            }
+            head = index;
+
+            if(level != detail::timer_wheel::k_batch_level) {
+                // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                m_occupied[level] |= 1_u64 << slot;
+            }
+        }
+
+        auto unlink(u32 index) noexcept -> void {
+            auto& node = m_nodes[index];
+            if(node.prev != detail::timer_wheel::k_null) {
+                m_nodes[node.prev].next = node.next;
+            }
+            else {
+                head_of(node.level, node.slot) = node.next;
+            }
+
+            if(node.next != detail::timer_wheel::k_null) {
+                m_nodes[node.next].prev = node.prev;
+            }
+
+            if(node.level != detail::timer_wheel::k_batch_level
+               && head_of(node.level, node.slot) == detail::timer_wheel::k_null)
+            {
+                // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                m_occupied[node.level] &= ~(1_u64 << node.slot);
+            }
+        }
+
+        /// @brief Links the timer at `index` into the wheel slot for its expiry tick, treating
+        /// expiry ticks before `earliest` as `earliest`
+        auto place(u32 index, u64 earliest) noexcept -> void {
+            const auto expiry = std::max(m_nodes[index].expiry, earliest);
+            const auto delta = std::min(expiry - m_now, detail::timer_wheel::k_max_delta);
+            const auto clamped = m_now + delta;
+
+            auto level = 0_usize;
+            if(delta >= detail::timer_wheel::k_slots) {
+                level = static_cast<usize>(std::bit_width(delta) - 1)
+                        / static_cast<usize>(detail::timer_wheel::k_slot_bits);
+            }
+
+            const auto shift = detail::timer_wheel::k_slot_bits * static_cast<u64>(level);
+            const auto slot = (clamped >> shift) & detail::timer_wheel::k_slot_mask;
+            link(index, static_cast<u8>(level), static_cast<u8>(slot));
+        }
+
+        /// @brief Returns the next tick after `m_now` at which an occupied slot is reached,
+        /// either expiring (in the innermost wheel) or cascading (in the outer wheels)
+        [[nodiscard]] auto next_event_tick() const noexcept -> u64 {
+            auto next = std::numeric_limits<u64>::max();
+            for(auto level = 0_usize; level < detail::timer_wheel::k_levels; ++level) {
+                // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                const auto occupied = m_occupied[level];
+                if(occupied == 0_u64) {
+                    continue;
+                }
+
+                const auto shift = detail::timer_wheel::k_slot_bits * static_cast<u64>(level);
+                const auto position = m_now >> shift;
+                const auto current = static_cast<int>(position & detail::timer_wheel::k_slot_mask);
+                // bit `i` of `rotated` represents the slot `i + 1` slots after the current one
+                const auto rotated = std::rotr(occupied, current + 1);
+                const auto distance = static_cast<u64>(std::countr_zero(rotated)) + 1_u64;
+                next = std::min(next, (position + distance) << shift);
+            }
+
+            return next;
+        }
+
+        /// @brief Redistributes the timers in the outer wheel slots reached at `m_now` into
+        /// inner wheels
+        auto cascade() noexcept -> void {
+            for(auto level = detail::timer_wheel::k_levels - 1_usize; level > 0_usize; --level) {
+                const auto shift = detail::timer_wheel::k_slot_bits * static_cast<u64>(level);
+                if((m_now & ((1_u64 << shift) - 1_u64)) != 0_u64) {
+                    continue;
+                }
+
+                const auto slot = static_cast<usize>((m_now >> shift)
+                                                     & detail::timer_wheel::k_slot_mask);
+                // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                auto index = std::exchange(m_heads[level][slot], detail::timer_wheel::k_null);
+                // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                m_occupied[level] &= ~(1_u64 << slot);
+
+                while(index != detail::timer_wheel::k_null) {
+                    const auto next = m_nodes[index].next;
+                    place(index, m_now);
+                    index = next;
+                }
+            }
+        }
+
+        /// @brief Moves the timers in the innermost wheel's `slot` to the batch list
+        auto batch_slot(usize slot) noexcept -> void {
+            auto index = std::exchange(m_heads[0][slot], detail::timer_wheel::k_null);
+            m_occupied[0] &= ~(1_u64 << slot);
+
+            while(index != detail::timer_wheel::k_null) {
+                const auto next = m_nodes[index].next;
+                link(index, detail::timer_wheel::k_batch_level, u8{0});
+                index = next;
+            }
+        }
+
+        template<typename TFunc>
+        auto deliver_batch(TFunc& on_expired) -> usize {
+            auto delivered = 0_usize;
+            while(m_batch_head != detail::timer_wheel::k_null) {
+                const auto index = m_batch_head;
+                unlink(index);
+
+                auto& node = m_nodes[index];
+                const auto id = timer_id{index, node.generation};
+                auto payload = std::move(*node.payload);
+                free_node(index);
+                --m_size;
+                ++delivered;
+
+                on_expired(id, std::move(payload));
+            }
+
+            return delivered;
+        }
+    };
+
+} // namespace hyperion
+
+#if defined(HYPERION_ENABLE_TESTING) && HYPERION_ENABLE_TESTING
+
+    #include <boost/ut.hpp>
+
+    #include <map>
+    #include <random>
+    #include <stdexcept>
+
+namespace hyperion::_test::platform::timer_wheel {
+
+    // NOLINTNEXTLINE(google-build-using-namespace)
+    using namespace boost::ut;
+
+    using wheel = hyperion::timer_wheel<usize>;
+    using namespace std::chrono_literals;
+
+    // NOLINTNEXTLINE(cert-err58-cpp)
+    static const suite<"hyperion::platform::timer_wheel"> timer_wheel_tests = [] {
+        "expires_in_order"_test = [] {
+            const auto start = wheel::clock::now();
+            wheel timers{1ms, start};
+
+            // spans the innermost wheel, cascades from the second and third, and beyond
+            const auto delays = std::array<usize, 8>{5, 1, 63, 64, 65, 4095, 4096, 300000};
+            for(const auto delay : delays) {
+                timers.schedule_at(start + std::chrono::milliseconds{delay}, delay);
+            }
+            expect(that % timers.size() == delays.size());
+
+            std::vector<usize> fired;
+            auto late = false;
+            for(auto tick = 1_usize; tick <= 300000_usize; ++tick) {
+                timers.advance(start + std::chrono::milliseconds{tick}, [&](timer_id, usize delay) {
+                    late = late || delay != tick;
+                    fired.push_back(delay);
+                });
+            }
+
+            expect(that % !late);
+            expect(fired == std::vector<usize>{1, 5, 63, 64, 65, 4095, 4096, 300000});
+            expect(that % timers.empty());
+        };
+
+        "cancel"_test = [] {
+            const auto start = wheel::clock::now();
+            wheel timers{1ms, start};
+
+            const auto first = timers.schedule_after(10ms, 1_usize);
+            const auto second = timers.schedule_after(10000ms, 2_usize);
+            expect(that % timers.cancel(first));
+            expect(that % !timers.cancel(first));
+            expect(that % timers.size() == 1_usize);
+
+            // the freed storage is reused, but the stale ID must not cancel the new timer
+            const auto third = timers.schedule_after(20ms, 3_usize);
+            expect(that % third.index == first.index);
+            expect(that % !timers.cancel(first));
+
+            std::vector<usize> fired;
+            timers.advance(start + 1h, [&](timer_id, usize value) { fired.push_back(value); });
+            expect(fired == std::vector<usize>{3, 2});
+            expect(that % !timers.cancel(second));
+        };
+
+        "next_expiry"_test = [] {
+            const auto start = wheel::clock::now();
+            wheel timers{1ms, start};
+            expect(that % !timers.next_expiry().has_value());
+
+            timers.schedule_at(start + 10ms, 0_usize);
+            expect(timers.next_expiry() == std::optional{start + 10ms});
+
+            timers.schedule_at(start + 500ms, 1_usize);
+            expect(that % timers.advance(start + 9ms, [](timer_id, usize) {}) == 0_usize);
+            expect(that % timers.advance(start + 10ms, [](timer_id, usize) {}) == 1_usize);
+
+            // the next event is the cascade of the second timer, which is never after its expiry
+            const auto next = timers.next_expiry();
+            expect(that % next.has_value());
+            expect(*next <= start + 500ms);
+            expect(*next > start + 10ms);
+
+            // an idle jump far past every slot boundary delivers the timer exactly once
+            expect(that % timers.advance(start + 24h, [](timer_id, usize) {}) == 1_usize);
+            expect(that % timers.empty());
+        };
+
+        "handler_reentrancy"_test = [] {
+            const auto start = wheel::clock::now();
+            wheel timers{1ms, start};
+
+            const auto first = timers.schedule_at(start + 5ms, 1_usize);
+            const auto second = timers.schedule_at(start + 5ms, 2_usize);
+            std::vector<usize> fired;
+            timers.advance(start + 5ms, [&](timer_id id, usize value) {
+                fired.push_back(value);
+                // cancel whichever timer in this batch hasn't been delivered yet
+                timers.cancel(id == first ? second : first);
+                timers.schedule_after(1ms, value + 10_usize);
+            });
+            expect(that % fired.size() == 1_usize);
+
+            timers.advance(start + 6ms, [&](timer_id, usize value) { fired.push_back(value); });
+            expect(that % fired.size() == 2_usize);
+            expect(that % fired[1] == fired[0] + 10_usize);
+        };
+
+        "throwing_handler"_test = [] {
+            const auto start = wheel::clock::now();
+            wheel timers{1ms, start};
+            timers.schedule_at(start + 1ms, 1_usize);
+            timers.schedule_at(start + 1ms, 2_usize);
+
+            auto threw = false;
+            try {
+                timers.advance(start + 1ms,
+                               [](timer_id, usize) { throw std::runtime_error{"failed"}; });
+            }
+            catch(const std::runtime_error&) {
+                threw = true;
+            }
+            expect(that % threw);
+            expect(that % timers.size() == 1_usize);
+            expect(timers.next_expiry() == std::optional{timers.now()});
+            expect(that % timers.advance(start + 1ms, [](timer_id, usize) {}) == 1_usize);
+        };
+
+        "randomized"_test = [] {
+            const auto start = wheel::clock::now();
+            wheel timers{1ms, start};
+            std::mt19937_64 rng{42_u64}; // NOLINT(cert-msc32-c, cert-msc51-cpp)
+            std::uniform_int_distribution<usize> delay{0_usize, 20000_usize};
+
+            std::map<usize, timer_id> pending;
+            auto late = false;
+            auto delivered = 0_usize;
+            auto cancelled = 0_usize;
+            for(auto tick = 0_usize; tick < 30000_usize; tick += 7_usize) {
+                const auto now = start + std::chrono::milliseconds{tick};
+                timers.advance(now, [&](timer_id, usize deadline) {
+                    late = late || deadline > tick || deadline + 7_usize <= tick;
+                    pending.erase(deadline);
+                    ++delivered;
+                });
+
+                for(auto count = 0_usize; count < 8_usize; ++count) {
+                    const auto deadline = tick + 1_usize + delay(rng);
+                    if(pending.contains(deadline)) {
+                        continue;
+                    }
+                    pending.emplace(deadline,
+                                    timers.schedule_at(start + std::chrono::milliseconds{deadline},
+                                                       deadline));
+                }
+
+                if(!pending.empty() && delay(rng) % 3_usize == 0_usize) {
+                    const auto victim = pending.begin();
+                    expect(that % timers.cancel(victim->second));
+                    pending.erase(victim);
+                    ++cancelled;
+                }
+                late = late || timers.size() != pending.size();
+            }
+
+            expect(that % !late);
+            expect(that % delivered > 0_usize);
+            expect(that % cancelled > 0_usize);
+        };
+    };
+
+} // namespace hyperion::_test::platform::timer_wheel
+
+#endif // defined(HYPERION_ENABLE_TESTING) && HYPERION_ENABLE_TESTING
+
+#endif // HYPERION_PLATFORM_TIMER_WHEEL_H
@@ -42,11 +42,67 @@ auto boost::ut::cfg<boost::ut::override> = boost::ut::runner<boost::ut::reporter
 
 _Pragma("GCC diagnostic pop");
 
+#include <hyperion/platform/assert.h>
+#include <hyperion/platform/atomic128.h>
+#include <hyperion/platform/btree.h>
+#include <hyperion/platform/coarse_clock.h>
+#include <hyperion/platform/compact_optional.h>
 #include <hyperion/platform/compare.h>
+#include <hyperion/platform/expected.h>
+#include <hyperion/platform/filter.h>
+#include <hyperion/platform/fixed_string.h>
+#include <hyperion/platform/flat_map.h>
+#include <hyperion/platform/flight_recorder.h>
+#include <hyperion/platform/futex.h>
+#include <hyperion/platform/hash.h>
+#include <hyperion/platform/logging.h>
+#include <hyperion/platform/mirrored_ring_buffer.h>
+#include <hyperion/platform/numa.h>
+#include <hyperion/platform/process_stats.h>
+#include <hyperion/platform/rcu_cell.h>
+#include <hyperion/platform/reclamation.h>
+#include <hyperion/platform/roaring.h>
+#include <hyperion/platform/scratch.h>
+#include <hyperion/platform/seqlock.h>
+#include <hyperion/platform/serialization.h>
+#include <hyperion/platform/sketch.h>
+#include <hyperion/platform/slot_map.h>
+#include <hyperion/platform/string_interner.h>
+#include <hyperion/platform/tagged_ptr.h>
+#include <hyperion/platform/thread_caching_allocator.h>
+#include <hyperion/platform/timer_wheel.h>
 
 #else
 
+#include <hyperion/platform/assert.h>
+#include <hyperion/platform/atomic128.h>
+#include <hyperion/platform/btree.h>
+#include <hyperion/platform/coarse_clock.h>
+#include <hyperion/platform/compact_optional.h>
 #include <hyperion/platform/compare.h>
+#include <hyperion/platform/expected.h>
+#include <hyperion/platform/filter.h>
+#include <hyperion/platform/fixed_string.h>
+#include <hyperion/platform/flat_map.h>
+#include <hyperion/platform/flight_recorder.h>
+#include <hyperion/platform/futex.h>
+#include <hyperion/platform/hash.h>
+#include <hyperion/platform/logging.h>
+#include <hyperion/platform/mirrored_ring_buffer.h>
+#include <hyperion/platform/numa.h>
+#include <hyperion/platform/process_stats.h>
+#include <hyperion/platform/rcu_cell.h>
+#include <hyperion/platform/reclamation.h>
+#include <hyperion/platform/roaring.h>
+#include <hyperion/platform/scratch.h>
+#include <hyperion/platform/seqlock.h>
+#include <hyperion/platform/serialization.h>
+#include <hyperion/platform/sketch.h>
+#include <hyperion/platform/slot_map.h>
+#include <hyperion/platform/string_interner.h>
+#include <hyperion/platform/tagged_ptr.h>
+#include <hyperion/platform/thread_caching_allocator.h>
+#include <hyperion/platform/timer_wheel.h>
 #include <boost/ut.hpp>
 
 #endif // HYPERION_PLATFORM_COMPILER_IS_CLANG
@@ -14,6 +14,11 @@ option("hyperion_enable_tracy", function()
     set_default(false)
 end)
 
+option("hyperion_enable_flight_recorder", function()
+    add_defines("HYPERION_ENABLE_FLIGHT_RECORDER=1", {public = true})
+    set_default(false)
+end)
+
 if has_config("hyperion_enable_tracy") then
     add_requires("tracy", {
         system = false,
@@ -42,6 +47,35 @@ local hyperion_platform_headers = {
     "$(projectdir)/include/hyperion/platform/ignore.h",
     "$(projectdir)/include/hyperion/platform/types.h",
     "$(projectdir)/include/hyperion/platform/compare.h",
+    "$(projectdir)/include/hyperion/platform/reclamation.h",
+    "$(projectdir)/include/hyperion/platform/rcu_cell.h",
+    "$(projectdir)/include/hyperion/platform/seqlock.h",
+    "$(projectdir)/include/hyperion/platform/cpu.h",
+    "$(projectdir)/include/hyperion/platform/futex.h",
+    "$(projectdir)/include/hyperion/platform/atomic128.h",
+    "$(projectdir)/include/hyperion/platform/tagged_ptr.h",
+    "$(projectdir)/include/hyperion/platform/timer_wheel.h",
+    "$(projectdir)/include/hyperion/platform/coarse_clock.h",
+    "$(projectdir)/include/hyperion/platform/logging.h",
+    "$(projectdir)/include/hyperion/platform/assert.h",
+    "$(projectdir)/include/hyperion/platform/expected.h",
+    "$(projectdir)/include/hyperion/platform/compact_optional.h",
+    "$(projectdir)/include/hyperion/platform/slot_map.h",
+    "$(projectdir)/include/hyperion/platform/roaring.h",
+    "$(projectdir)/include/hyperion/platform/mirrored_ring_buffer.h",
+    "$(projectdir)/include/hyperion/platform/fixed_string.h",
+    "$(projectdir)/include/hyperion/platform/string_interner.h",
+    "$(projectdir)/include/hyperion/platform/flat_map.h",
+    "$(projectdir)/include/hyperion/platform/filter.h",
+    "$(projectdir)/include/hyperion/platform/hash.h",
+    "$(projectdir)/include/hyperion/platform/sketch.h",
+    "$(projectdir)/include/hyperion/platform/btree.h",
+    "$(projectdir)/include/hyperion/platform/serialization.h",
+    "$(projectdir)/include/hyperion/platform/numa.h",
+    "$(projectdir)/include/hyperion/platform/scratch.h",
+    "$(projectdir)/include/hyperion/platform/thread_caching_allocator.h",
+    "$(projectdir)/include/hyperion/platform/process_stats.h",
+    "$(projectdir)/include/hyperion/platform/flight_recorder.h",
 }
 
 target("hyperion_platform", function()
@@ -58,7 +92,12 @@ target("hyperion_platform", function()
         settings.set_compiler_settings(target)
     end)
 
+    if not is_plat("windows") then
+        add_syslinks("pthread", {public = true})
+    end
+
     add_options("hyperion_enable_tracy", {public = true})
+    add_options("hyperion_enable_flight_recorder", {public = true})
     if has_package("tracy") then
         add_packages("tracy", {public = true})
     end